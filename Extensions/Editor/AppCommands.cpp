@@ -164,6 +164,10 @@ public:
 void RunUnitTests()
 {
   Zilch::Sha1Builder::RunUnitTests();
+  Z::gJobs->RunTaskUnitTests();
+  OcclusionBuffer::RunUnitTests();
+  GraphicalEntrySorter::RunUnitTests();
+  RunReplicaBaselineUnitTests();
   new UnitTestDelayRunner(Z::gEditor);
 }
 
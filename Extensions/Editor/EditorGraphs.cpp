@@ -159,10 +159,32 @@ void AddGraph(Editor* editor)
   editor->AddManagedWidget(graph, DockArea::Floating, true);
 }
 
+// Records the next frames of every thread's profile scopes to a trace file that
+// can be opened in chrome://tracing (or Perfetto)
+void CaptureProfile()
+{
+  Profile::ProfileSystem* profileSystem = Profile::ProfileSystem::Instance;
+  if(profileSystem->IsCapturing())
+  {
+    DoNotifyWarning("Capture Profile", "A profile capture is already in progress");
+    return;
+  }
+
+  const uint cCaptureFrameCount = 120;
+  String directory = FilePath::Combine(GetUserDocumentsDirectory(), "ZeroEditor", "Profiles");
+  CreateDirectoryAndParents(directory);
+
+  String fileName = BuildString("Profile", GetTimeAndDateStamp(), ".json");
+  String filePath = FilePath::Combine(directory, fileName);
+  profileSystem->CaptureFrames(cCaptureFrameCount, filePath);
+  ZPrint("Capturing %u frames of profile scopes to '%s'\n", cCaptureFrameCount, filePath.c_str());
+}
+
 void SetupGraphCommands(Cog* configCog, CommandManager* commands)
 {
   commands->AddCommand("Performance", BindCommandFunction(AddPerformance));
   commands->AddCommand("Graph", BindCommandFunction(AddGraph));
+  commands->AddCommand("CaptureProfile", BindCommandFunction(CaptureProfile));
 }
 
 }
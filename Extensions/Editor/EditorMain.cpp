@@ -894,6 +894,7 @@ void CreateEditor(Cog* config, StringParam fileToOpen, StringParam newProjectNam
   BindArchiveCommands(config, commands);
   BindGraphicsCommands(config, commands);
   BindCreationCommands(config, commands);
+  BindPhysicsTestCommands(config, commands);
   BindDocumentationCommands(config, commands);
   BindProjectCommands(config, commands);
   BindContentCommands(config, commands);
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+#include "Widget/Command.hpp"
+#include "Widget/CommandBinding.hpp"
+#include "Engine/Configuration.hpp"
+
+namespace Zero
+{
+
+namespace PhysicsBenchmark
+{
+
+const uint cStackCount = 16;
+const uint cStackHeight = 20;
+const uint cFrameCount = 300;
+const real cTimeStep = real(1.0 / 60.0);
+const uint cIntegrationFrameCount = 60;
+
+}//namespace PhysicsBenchmark
+
+// Builds a space full of box stacks that constraint solving dominates.
+Space* CreateSolverBenchmarkSpace(bool deterministic)
+{
+  Space* space = Z::gFactory->CreateSpace(CoreArchetypes::DefaultSpace, CreationFlags::Editing, nullptr);
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  physicsSpace->SetDeterministic(deterministic);
+
+  // A large static ground for every stack to rest on
+  space->CreateAt(CoreArchetypes::Cube, Vec3(0, -0.5f, 0), Vec3(200, 1, 200));
+
+  uint stacksPerRow = (uint)Math::Sqrt((real)PhysicsBenchmark::cStackCount);
+  for(uint stack = 0; stack < PhysicsBenchmark::cStackCount; ++stack)
+  {
+    real x = real(stack % stacksPerRow) * 4.0f;
+    real z = real(stack / stacksPerRow) * 4.0f;
+    for(uint h = 0; h < PhysicsBenchmark::cStackHeight; ++h)
+    {
+      Cog* cog = space->CreateAt(CoreArchetypes::Cube, Vec3(x, real(h) + 0.5f, z));
+      cog->AddComponentByName("RigidBody");
+    }
+  }
+
+  return space;
+}
+
+// Returns the average time in milliseconds that a step took.
+double BenchmarkSolver(PhysicsSolverType::Enum solverType, bool deterministic)
+{
+  Space* space = CreateSolverBenchmarkSpace(deterministic);
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+
+  // The config is a shared resource, so change a runtime clone of it instead
+  // (changing the resource itself would mark the project's content as modified)
+  HandleOf<PhysicsSolverConfig> config = physicsSpace->GetPhysicsSolverConfig()->RuntimeClone();
+  config->SetSolverType(solverType);
+  physicsSpace->SetPhysicsSolverConfig(config);
+
+  Timer timer;
+  timer.Reset();
+  for(uint i = 0; i < PhysicsBenchmark::cFrameCount; ++i)
+    physicsSpace->IterateTimestep(PhysicsBenchmark::cTimeStep);
+  double totalTime = timer.UpdateAndGetTime();
+
+  space->Destroy();
+  return totalTime * 1000.0 / PhysicsBenchmark::cFrameCount;
+}
+
+void BenchmarkPhysicsSolvers()
+{
+  ZPrint("Solver benchmark: %d stacks of %d boxes, %d steps\n", PhysicsBenchmark::cStackCount,
+         PhysicsBenchmark::cStackHeight, PhysicsBenchmark::cFrameCount);
+  ZPrint("  Basic: %.3fms\n", BenchmarkSolver(PhysicsSolverType::Basic, true));
+  ZPrint("  Normal: %.3fms\n", BenchmarkSolver(PhysicsSolverType::Normal, true));
+  ZPrint("  Threaded (deterministic): %.3fms\n", BenchmarkSolver(PhysicsSolverType::Threaded, true));
+  ZPrint("  Threaded: %.3fms\n", BenchmarkSolver(PhysicsSolverType::Threaded, false));
+}
+
+// Returns the average time in milliseconds that integrating the bodies took per step.
+double BenchmarkIntegration(uint bodyCount)
+{
+  Space* space = Z::gFactory->CreateSpace(CoreArchetypes::DefaultSpace, CreationFlags::Editing, nullptr);
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  // Every body needs to stay awake to be integrated
+  physicsSpace->SetAllowSleep(false);
+
+  // Bodies without colliders so that nothing but integration has any work to do
+  for(uint i = 0; i < bodyCount; ++i)
+  {
+    Cog* cog = space->CreateAt(CoreArchetypes::Transform, Vec3(real(i % 100), real(i / 100), 0));
+    cog->AddComponentByName("RigidBody");
+  }
+  physicsSpace->PushBroadPhaseQueue();
+
+  Timer timer;
+  double totalTime = 0;
+  for(uint i = 0; i < PhysicsBenchmark::cIntegrationFrameCount; ++i)
+  {
+    timer.Reset();
+    physicsSpace->IntegrateBodiesVelocity(PhysicsBenchmark::cTimeStep);
+    physicsSpace->IntegrateBodiesPosition(PhysicsBenchmark::cTimeStep);
+    totalTime += timer.UpdateAndGetTime();
+
+    // Flush the queued transform updates outside of the timed section
+    physicsSpace->PushBroadPhaseQueue();
+  }
+
+  space->Destroy();
+  return totalTime * 1000.0 / PhysicsBenchmark::cIntegrationFrameCount;
+}
+
+void BenchmarkPhysicsIntegration()
+{
+  const uint cBodyCounts[] = {10000, 50000, 100000};
+
+  ZPrint("Integration benchmark: %d steps\n", PhysicsBenchmark::cIntegrationFrameCount);
+  for(uint i = 0; i < 3; ++i)
+  {
+    uint bodyCount = cBodyCounts[i];
+    double time = BenchmarkIntegration(bodyCount);
+    ZPrint("  %d bodies: %.3fms (%.1fns per body)\n", bodyCount, time, time * 1000000.0 / bodyCount);
+  }
+}
+
+void BindPhysicsTestCommands(Cog* configCog, CommandManager* commands)
+{
+  bool devConfig = Z::gEngine->GetConfigCog()->has(Zero::DeveloperConfig) != nullptr;
+  if(devConfig)
+  {
+    commands->AddCommand("BenchmarkPhysicsSolvers", BindCommandFunction(BenchmarkPhysicsSolvers));
+    commands->AddCommand("BenchmarkPhysicsIntegration", BindCommandFunction(BenchmarkPhysicsIntegration));
+  }
+}
+
+}//namespace Zero
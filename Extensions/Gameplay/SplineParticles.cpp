@@ -133,7 +133,7 @@ int SplineParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
   for(int p = 0; p < particlesToEmit; ++p)
   {
     // Create a new particle
-    Particle* newParticle = particleList->AllocateParticle();
+    Particle newParticle = particleList->AddParticle();
     
     // Generate a normalized time to sample the curve and clamp if specified
     float t = gRandom.FloatVariance(mSpawnT, mSpawnTVariance);
@@ -173,33 +173,31 @@ int SplineParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
                   normal * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = gRandom.FloatVariance(mSize, mSizeVariance);
+    newParticle.SetTime(0);
+    newParticle.SetSize(gRandom.FloatVariance(mSize, mSizeVariance));
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.SetVelocity(Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent);
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.SetPosition(Math::TransformPoint(transform, startingPoint));
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.SetPosition(newParticle.GetPosition() + offsetDelta * (float)p);
     }
 
-    newParticle->Lifetime = gRandom.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.SetLifetime(gRandom.FloatVariance(mLifetime, mLifetimeVariance));
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.SetColor(Vec4(1, 1, 1, 1));
 
-    newParticle->WanderAngle = gRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.SetWanderAngle(gRandom.FloatRange(0.0f, 2 * Math::cTwoPi));
 
     if(mRandomSpin)
-      newParticle->Rotation = gRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.SetRotation(gRandom.FloatRange(0.0f, 2 * Math::cTwoPi));
     else
-      newParticle->Rotation = 0;
+      newParticle.SetRotation(0);
 
-    newParticle->RotationalVelocity = gRandom.FloatVariance(Math::DegToRad(mSpin), 
-      Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
+    newParticle.SetRotationalVelocity(gRandom.FloatVariance(Math::DegToRad(mSpin), 
+      Math::DegToRad(mSpinVariance)));
   }
 
   return particlesToEmit;
@@ -314,10 +312,11 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt,
   Vec3 crossA, previousNormal;
   GenerateOrthonormalBasis(startTangent, &crossA, &previousNormal);
 
-  forRange(Particle* p, particleList->All())
+  uint particleCount = particleList->Size();
+  for(uint i = 0; i < particleCount; ++i)
   {
     // How far (in meters) the particle has traveled
-    float distanceTraveled = p->Time * mSpeed;
+    float distanceTraveled = particleList->mTime[i] * mSpeed;
 
     // The percentage of the spline the particle has traveled
     float percentTraveled = distanceTraveled / curveLength;
@@ -356,18 +355,20 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt,
     // In world / local space
     splineSample = Math::TransformPoint(transform, splineSample);
 
+    Vec3 position = particleList->GetPosition(i);
     if(mMode == SplineAnimatorMode::Exact)
     {
       // Update the velocity so that Beam rendering still works
-      p->Velocity = (splineSample - p->Position);
-      p->Position = splineSample;
+      particleList->SetVelocity(i, splineSample - position);
+      particleList->SetPosition(i, splineSample);
     }
     else // mMode == SplineAnimatorMode::Spring
     {
-      Vec3 detX = f * p->Position + dt * p->Velocity + hhoo * splineSample;
-      Vec3 detV = p->Velocity + hoo * (splineSample - p->Position);
-      p->Position = detX * detInv;
-      p->Velocity = detV * detInv;
+      Vec3 velocity = particleList->GetVelocity(i);
+      Vec3 detX = f * position + dt * velocity + hhoo * splineSample;
+      Vec3 detV = velocity + hoo * (splineSample - position);
+      particleList->SetPosition(i, detX * detInv);
+      particleList->SetVelocity(i, detV * detInv);
     }
   }
 }
@@ -394,12 +395,13 @@ void SplineParticleAnimator::SetSpeed(float speed)
   float timeToFinish = curveLength / speed;
   
   // Re-base each particles lifetime so that 
-  forRange(Particle* p, data->AllParticles())
+  ParticleList& particleList = data->mParticleList;
+  for(uint i = 0; i < particleList.Size(); ++i)
   {
-    float percentAlive = p->Time / p->Lifetime;
+    float percentAlive = particleList.mTime[i] / particleList.mLifetime[i];
 
-    p->Time = percentAlive * timeToFinish;
-    p->Lifetime = timeToFinish;
+    particleList.mTime[i] = percentAlive * timeToFinish;
+    particleList.mLifetime[i] = timeToFinish;
   }
 }
 
@@ -12,6 +12,9 @@
 namespace Zero
 {
 
+// Graphs with a few blended animations are cheap to evaluate, so each task takes a good number of them
+const uint cMinAnimationGraphsPerTask = 32;
+
 //-------------------------------------------------------------- Animation Graph
 AnimationGraph::DebugPreviewFunction AnimationGraph::mOnPreviewPressed = NULL;
 AnimationGraph::DebugPreviewFunction AnimationGraph::mOnGraphCreated = NULL;
@@ -30,6 +33,7 @@ ZilchDefineType(AnimationGraph, builder, type)
 
   ZilchBindGetterSetterProperty(Active);
   ZilchBindFieldProperty(mTimeScale);
+  ZilchBindFieldProperty(mParallelUpdate);
 
   ZeroBindEvent(Events::AnimationBlendEnded, AnimationGraphEvent);
   ZeroBindEvent(Events::AnimationEnded, AnimationGraphEvent);
@@ -52,12 +56,18 @@ ZilchDefineType(AnimationGraph, builder, type)
 AnimationGraph::AnimationGraph()
 {
   mFrameId = 0;
+  mEvaluated = false;
+  mBatch = nullptr;
+  mBatchIndex = 0;
 }
 
 //******************************************************************************
 AnimationGraph::~AnimationGraph()
 {
+  if(mBatch)
+    mBatch->Remove(this);
   DeleteObjectsInContainer(mBlendTracks);
+  DeleteObjectsInContainer(mEventsToSend);
 }
 
 //******************************************************************************
@@ -67,6 +77,7 @@ void AnimationGraph::Serialize(Serializer& stream)
   // Loaded for old projects
   SerializeEnumName(AnimationPlayMode, mPlayMode);
   SerializeName(mTimeScale);
+  SerializeNameDefault(mParallelUpdate, false);
   // Loaded for old projects
   SerializeResourceName(mAnimation, AnimationManager);
   SerializeNameDefault(mDebugPreviewId, (u64)0);
@@ -98,7 +109,7 @@ void AnimationGraph::OnAllObjectsCreated(CogInitializer& initializer)
 //******************************************************************************
 void AnimationGraph::Initialize(CogInitializer& initializer)
 {
-  ConnectThisTo(initializer.mSpace, Events::LogicUpdate, OnUpdate);
+  AnimationGraphBatch::GetBatch(initializer.mSpace)->Add(this);
 
   if(mOnGraphCreated && !GetSpace()->IsEditorMode())
     mOnGraphCreated(this);
@@ -106,44 +117,63 @@ void AnimationGraph::Initialize(CogInitializer& initializer)
   ConnectThisTo(MetaDatabase::GetInstance(), Events::MetaModified, OnMetaModified);
 }
 
+//******************************************************************************
+void AnimationGraph::OnDestroy(uint flags)
+{
+  if(mBatch)
+    mBatch->Remove(this);
+}
+
 //******************************************************************************
 void AnimationGraph::SetDefaults()
 {
   mActive = true;
   mTimeScale = 1.0f;
+  mParallelUpdate = false;
   mPlayMode = AnimationPlayMode::PlayOnce;
   mAnimation = AnimationManager::GetDefault();
 }
 
 //******************************************************************************
 void AnimationGraph::Update(float dt)
+{
+  Evaluate(dt);
+  ApplyEvaluated();
+}
+
+//******************************************************************************
+void AnimationGraph::Evaluate(float dt)
 {
   if (mActiveNode)
   {
-    // Static so we can re-use memory and avoid extra allocations
-    static Array<AnimationGraphEvent*> eventsToSend;
-    eventsToSend.Clear();
-
     // Update the root node
-    mActiveNode = mActiveNode->Update(this, dt, mFrameId++, eventsToSend);
-
-    // Apply the frame if we're given anything back
-    if (mActiveNode)
-      ApplyFrame(mActiveNode->mFrameData);
+    mActiveNode = mActiveNode->Update(this, dt, mFrameId++, mEventsToSend);
+    mEvaluated = true;
+  }
+}
 
-    // Dispatch all events from the animation graph
-    forRange(AnimationGraphEvent* eventToSend, eventsToSend.All())
-    {
-      GetOwner()->DispatchEvent(eventToSend->EventId, eventToSend);
-      delete eventToSend;
-    }
+//******************************************************************************
+void AnimationGraph::ApplyEvaluated()
+{
+  if (!mEvaluated)
+    return;
+  mEvaluated = false;
 
-    // Send the post animation event
-    Event eventToSend;
-    GetOwner()->DispatchEvent(Events::AnimationPostUpdate, &eventToSend);
+  // Apply the frame if we're given anything back
+  if (mActiveNode)
+    ApplyFrame(mActiveNode->mFrameData);
 
-    return;
+  // Dispatch all events from the animation graph
+  forRange(AnimationGraphEvent* eventToSend, mEventsToSend.All())
+  {
+    GetOwner()->DispatchEvent(eventToSend->EventId, eventToSend);
+    delete eventToSend;
   }
+  mEventsToSend.Clear();
+
+  // Send the post animation event
+  Event eventToSend;
+  GetOwner()->DispatchEvent(Events::AnimationPostUpdate, &eventToSend);
 }
 
 //******************************************************************************
@@ -169,7 +199,7 @@ void AnimationGraph::ApplyFrame(AnimationFrame& frame)
       {
         Any& newValue = frameData.Value;
         if(!blendTrack->Object.IsNull() && newValue.IsHoldingValue())
-          blendTrack->Property->SetValue(blendTrack->Object, newValue);
+          blendTrack->Setter(*blendTrack, newValue);
       }
     }
     else
@@ -358,6 +388,145 @@ ChainNode* AnimationGraph::CreateChainNode()
   return new ChainNode();
 }
 
+//-------------------------------------------------------- Animation Graph Batch
+struct EvaluateAnimationGraphsTask
+{
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+    {
+      AnimationGraph* animGraph = mBatch->mUpdating[i];
+      if(animGraph && animGraph->mActive)
+        animGraph->Evaluate(mBatch->mDt);
+    }
+  }
+
+  AnimationGraphBatch* mBatch;
+};
+
+//******************************************************************************
+ZilchDefineType(AnimationGraphBatch, builder, type)
+{
+}
+
+//******************************************************************************
+AnimationGraphBatch::AnimationGraphBatch(Space* space)
+{
+  mRemovedCount = 0;
+  mDt = 0.0f;
+  mApplying = false;
+  ConnectThisTo(space, Events::LogicUpdate, OnLogicUpdate);
+}
+
+//******************************************************************************
+AnimationGraphBatch::~AnimationGraphBatch()
+{
+  forRange(AnimationGraph* animGraph, mGraphs.All())
+  {
+    if(animGraph)
+      animGraph->mBatch = nullptr;
+  }
+}
+
+//******************************************************************************
+AnimationGraphBatch* AnimationGraphBatch::GetBatch(Space* space)
+{
+  if(space->mAnimationGraphs == nullptr)
+    space->mAnimationGraphs = new AnimationGraphBatch(space);
+  return space->mAnimationGraphs;
+}
+
+//******************************************************************************
+void AnimationGraphBatch::Add(AnimationGraph* animGraph)
+{
+  ErrorIf(animGraph->mBatch != nullptr, "AnimationGraph was already added.");
+  animGraph->mBatch = this;
+  animGraph->mBatchIndex = mGraphs.Size();
+  mGraphs.PushBack(animGraph);
+}
+
+//******************************************************************************
+void AnimationGraphBatch::Remove(AnimationGraph* animGraph)
+{
+  ErrorIf(mGraphs[animGraph->mBatchIndex] != animGraph, "AnimationGraph is not in this batch.");
+  mGraphs[animGraph->mBatchIndex] = nullptr;
+  animGraph->mBatch = nullptr;
+  ++mRemovedCount;
+
+  // Event handlers of an earlier graph destroyed this one before it was applied
+  if(mApplying)
+  {
+    uint index = mUpdating.FindIndex(animGraph);
+    if(index != Array<AnimationGraph*>::InvalidIndex)
+      mUpdating[index] = nullptr;
+  }
+}
+
+//******************************************************************************
+void AnimationGraphBatch::OnLogicUpdate(UpdateEvent* e)
+{
+  // Close the gaps left by removed graphs
+  if(mRemovedCount != 0)
+  {
+    uint count = 0;
+    for(uint i = 0; i < mGraphs.Size(); ++i)
+    {
+      AnimationGraph* animGraph = mGraphs[i];
+      if(animGraph == nullptr)
+        continue;
+      animGraph->mBatchIndex = count;
+      mGraphs[count++] = animGraph;
+    }
+    mGraphs.Resize(count);
+    mRemovedCount = 0;
+  }
+
+  // Graphs are checked for being active when their turn comes, since the events
+  // of an earlier graph can activate or deactivate them
+  mUpdating.Assign(mGraphs.All());
+  mDt = e->Dt;
+  mApplying = true;
+
+  uint index = 0;
+  while(index < mUpdating.Size())
+  {
+    // Destroyed by the events of an earlier graph
+    AnimationGraph* animGraph = mUpdating[index];
+    if(animGraph == nullptr)
+    {
+      ++index;
+      continue;
+    }
+
+    if(!animGraph->mParallelUpdate)
+    {
+      if(animGraph->mActive)
+        animGraph->Update(mDt);
+      ++index;
+      continue;
+    }
+
+    // Every graph up to the next one that has to be updated on its own
+    uint runEnd = index + 1;
+    while(runEnd < mUpdating.Size() && (mUpdating[runEnd] == nullptr || mUpdating[runEnd]->mParallelUpdate))
+      ++runEnd;
+
+    EvaluateAnimationGraphsTask task;
+    task.mBatch = this;
+    Z::gJobs->ParallelFor(index, runEnd, task, cMinAnimationGraphsPerTask);
+
+    // Setting properties and sending events has to happen on the main thread
+    for(; index < runEnd; ++index)
+    {
+      if(mUpdating[index])
+        mUpdating[index]->ApplyEvaluated();
+    }
+  }
+
+  mApplying = false;
+  mUpdating.Clear();
+}
+
 //------------------------------------------------------------- Simple Animation
 ZilchDefineType(SimpleAnimation, builder, type)
 {
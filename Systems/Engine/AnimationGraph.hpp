@@ -12,6 +12,8 @@
 namespace Zero
 {
 
+class AnimationGraphBatch;
+
 //-------------------------------------------------------------- Animation Graph
 /// The AnimationGraph component controls animation for an individual game
 /// object. It stores all needed per instance (vs what is shared in the
@@ -31,6 +33,7 @@ public:
   void Initialize(CogInitializer& initializer) override;
   void Serialize(Serializer& stream) override;
   void OnAllObjectsCreated(CogInitializer& initializer) override;
+  void OnDestroy(uint flags = 0) override;
   void SetDefaults() override;
 
   void ResetAnimationNode();
@@ -75,12 +78,19 @@ public:
 private:
   friend class ObjectTrack;
   friend class Animator;
+  friend class AnimationGraphBatch;
 
   /// Updates the root node on each from and applies it to the object tree.
   void Update(float dt);
   void OnUpdate(UpdateEvent* e);
   void ApplyFrame(AnimationFrame& frame);
 
+  /// Updates the node tree without touching any other object, the events it
+  /// queued are sent when the frame is applied.
+  void Evaluate(float dt);
+  /// Applies the evaluated frame and sends the queued events.
+  void ApplyEvaluated();
+
   /// We need to re-link all objects whenever the meta database has been
   /// modified. This should only ever happen if this object is in the editor.
   void OnMetaModified(MetaLibraryEvent* e);
@@ -91,6 +101,12 @@ private:
   /// A scalar to the entire animation graph.
   float mTimeScale;
 
+  /// Whether the graph can be evaluated on the task workers with the other
+  /// graphs in the space. Its frame is still applied and its events still sent
+  /// in order, but it is evaluated before the events of the graphs updated
+  /// ahead of it are sent, so their handlers only affect it on the next frame.
+  bool mParallelUpdate;
+
   /// Used to avoid double updates of animation nodes.
   uint mFrameId;
 
@@ -100,6 +116,50 @@ private:
   /// Still around for updater's.
   AnimationPlayMode::Enum mPlayMode;
   HandleOf<Animation> mAnimation;
+
+  /// Events queued by the nodes during Evaluate.
+  Array<AnimationGraphEvent*> mEventsToSend;
+  /// Whether Evaluate updated a node that has to be applied.
+  bool mEvaluated;
+
+  /// The space's batch that updates this graph and our index in it.
+  AnimationGraphBatch* mBatch;
+  uint mBatchIndex;
+};
+
+//-------------------------------------------------------- Animation Graph Batch
+/// Updates every AnimationGraph in a space on the space's logic update instead
+/// of each graph connecting to it. Graphs are updated in the order they were
+/// added, each one evaluated then applied as if it were connected itself.
+/// Evaluating a graph (advancing node times, sampling tracks, and blending)
+/// only touches the graph's own nodes and frames, so consecutive graphs that
+/// allow a parallel update are evaluated together across the task workers, then
+/// applied and their events sent on the main thread in order.
+class AnimationGraphBatch : public EventObject
+{
+public:
+  ZilchDeclareType(TypeCopyMode::ReferenceType);
+
+  AnimationGraphBatch(Space* space);
+  ~AnimationGraphBatch();
+
+  /// Returns the space's batch, creating it for the first graph.
+  static AnimationGraphBatch* GetBatch(Space* space);
+
+  void Add(AnimationGraph* animGraph);
+  void Remove(AnimationGraph* animGraph);
+
+  void OnLogicUpdate(UpdateEvent* e);
+
+  /// Removed graphs leave an empty slot until the next update so that the
+  /// order of the remaining graphs never changes.
+  Array<AnimationGraph*> mGraphs;
+  uint mRemovedCount;
+
+  /// Graphs being updated this logic update.
+  Array<AnimationGraph*> mUpdating;
+  float mDt;
+  bool mApplying;
 };
 
 //------------------------------------------------------------- Simple Animation
@@ -38,11 +38,18 @@ AnimationNode* BuildBasic(AnimationGraph* animGraph, Animation* animation,
                           float t, AnimationPlayMode::Enum playMode);
 
 //------------------------------------------------------------------ Blend Track
+struct BlendTrack;
+
+/// Sets the blended value on the track's object. Resolved when the track is
+/// linked so that common properties are set directly instead of through meta.
+typedef void (*BlendTrackSetter)(BlendTrack& track, AnyParam value);
+
 struct BlendTrack
 {
   uint Index;
   Property* Property;
   Handle Object;
+  BlendTrackSetter Setter;
 };
 
 typedef HashMap<String, BlendTrack*> BlendTracks;
@@ -158,9 +158,9 @@ ZilchDefineType(Cog, builder, type)
   ZilchBindMethod(FindRootArchetype);
 
   // Events
-  ZilchBindMethod(DispatchEvent);
-  ZilchBindMethod(DispatchUp);
-  ZilchBindMethod(DispatchDown);
+  ZilchBindOverloadedMethod(DispatchEvent, ZilchInstanceOverload(void, StringParam, Event*));
+  ZilchBindOverloadedMethod(DispatchUp, ZilchInstanceOverload(void, StringParam, Event*));
+  ZilchBindOverloadedMethod(DispatchDown, ZilchInstanceOverload(void, StringParam, Event*));
 
   // Other
   ZilchBindGetter(MarkedForDestruction);
@@ -1957,19 +1957,55 @@ void Cog::DispatchEvent(StringParam eventId, Event* event)
   GetDispatcher()->Dispatch(eventId, event);
 }
 
+//**************************************************************************************************
+void Cog::DispatchEvent(const InternedEventName& eventId, Event* event)
+{
+  GetDispatcher()->Dispatch(eventId, event);
+}
+
 //**************************************************************************************************
 void Cog::DispatchUp(StringParam eventId, Event* event)
+{
+  // Validate and look up the name once for the whole walk
+  if (EventDispatcher::ValidateDispatch(eventId, event))
+    DispatchUpValidated(FindEventNameId(eventId), eventId, event);
+}
+
+//**************************************************************************************************
+void Cog::DispatchUp(const InternedEventName& eventId, Event* event)
+{
+  if (EventDispatcher::ValidateDispatch(eventId, event))
+    DispatchUpValidated(eventId.mId, eventId, event);
+}
+
+//**************************************************************************************************
+void Cog::DispatchDown(StringParam eventId, Event* event)
+{
+  // Validate and look up the name once for the whole walk
+  if (EventDispatcher::ValidateDispatch(eventId, event))
+    DispatchDownValidated(FindEventNameId(eventId), eventId, event);
+}
+
+//**************************************************************************************************
+void Cog::DispatchDown(const InternedEventName& eventId, Event* event)
+{
+  if (EventDispatcher::ValidateDispatch(eventId, event))
+    DispatchDownValidated(eventId.mId, eventId, event);
+}
+
+//**************************************************************************************************
+void Cog::DispatchUpValidated(EventNameId id, StringParam eventId, Event* event)
 {
   Cog* parent = GetParent();
   if (parent)
   {
-    parent->DispatchEvent(eventId, event);
-    parent->DispatchUp(eventId, event);
+    parent->GetDispatcher()->DispatchValidated(id, eventId, event);
+    parent->DispatchUpValidated(id, eventId, event);
   }
 }
 
 //**************************************************************************************************
-void Cog::DispatchDown(StringParam eventId, Event* event)
+void Cog::DispatchDownValidated(EventNameId id, StringParam eventId, Event* event)
 {
   Hierarchy* hierarchy = this->has(Hierarchy);
   if (hierarchy)
@@ -1981,8 +2017,8 @@ void Cog::DispatchDown(StringParam eventId, Event* event)
 
     forRange(Cog* child, children.All())
     {
-      child->DispatchEvent(eventId, event);
-      child->DispatchDown(eventId, event);
+      child->GetDispatcher()->DispatchValidated(id, eventId, event);
+      child->DispatchDownValidated(id, eventId, event);
     }
   }
 }
@@ -1993,6 +2029,12 @@ bool Cog::HasReceivers(StringParam eventId)
   return GetDispatcher()->HasReceivers(eventId);
 }
 
+//**************************************************************************************************
+bool Cog::HasReceivers(const InternedEventName& eventId)
+{
+  return GetDispatcher()->HasReceivers(eventId);
+}
+
 //**************************************************************************************************
 EventDispatcher* Cog::GetDispatcherObject()
 {
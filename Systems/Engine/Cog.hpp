@@ -339,15 +339,19 @@ public:
   //------------------------------------------------------------------------------------ Events
   /// Dispatches an event on this object
   void DispatchEvent(StringParam eventId, Event* event);
+  void DispatchEvent(const InternedEventName& eventId, Event* event);
 
   /// Dispatches an event up the tree on each parent recursively (pre-order traversal)
   void DispatchUp(StringParam eventId, Event* event);
+  void DispatchUp(const InternedEventName& eventId, Event* event);
 
   /// Dispatches an event down the tree on all children recursively (pre-order traversal)
   void DispatchDown(StringParam eventId, Event* event);
+  void DispatchDown(const InternedEventName& eventId, Event* event);
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const InternedEventName& eventId);
 
   //----- Internals
   EventDispatcher* GetDispatcherObject();
@@ -434,6 +438,10 @@ private:
   /// Compositions can not be copied.
   Cog(const Cog&);
   void operator=(const Cog&);
+
+  /// Walks of an event that was already validated and had its name looked up.
+  void DispatchUpValidated(EventNameId id, StringParam eventId, Event* event);
+  void DispatchDownValidated(EventNameId id, StringParam eventId, Event* event);
 };
 
 String CogDisplayName(HandleParam object);
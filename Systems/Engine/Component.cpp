@@ -164,6 +164,13 @@ void Component::DispatchEvent(StringParam eventId, Event* event)
   mOwner->GetDispatcher()->Dispatch(eventId, event);
 }
 
+//**************************************************************************************************
+void Component::DispatchEvent(const InternedEventName& eventId, Event* event)
+{
+  ReturnIf(!mOwner,, "The Owner was null (is this being called from a constructor or destructor?)");
+  mOwner->GetDispatcher()->Dispatch(eventId, event);
+}
+
 
 //------------------------------------------------------------------------- Component Handle Manager
 //**************************************************************************************************
@@ -122,6 +122,7 @@ public:
 
   /// Event functionality.
   virtual void DispatchEvent(StringParam eventId, Event* event);
+  virtual void DispatchEvent(const InternedEventName& eventId, Event* event);
   EventDispatcher* GetDispatcherObject() { return GetDispatcher(); }
   EventReceiver* GetReceiverObject() { return GetReceiver(); }
 
@@ -147,6 +147,9 @@ void Engine::Run(bool autoShutdown)
 //******************************************************************************
 void Engine::Update()
 {
+  // The last frame ends here (before the engine scope is opened) so that captures only contain whole frames
+  Profile::ProfileSystem::Instance->EndFrame();
+
   ProfileScope("Engine");
 
   Z::gTracker->ClearDeletedObjects();
@@ -162,6 +165,9 @@ void Engine::Update()
     mSystems[i]->Update();
   }
 
+  // Script heaps may be used from any thread, so their memory stats are gathered here on the main thread
+  Zilch::HeapSlabAllocator::UpdateMemoryStats();
+
   float dt = mTimeSystem ? mTimeSystem->mEngineDt : 0.0f;
   mTimePassed += dt;
   UpdateEvent toSend(dt, dt, mTimePassed, 0);
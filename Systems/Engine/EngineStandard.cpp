@@ -47,6 +47,7 @@ ZilchDefineEnum(StoreResult);
 ZilchDefineEnum(StreamType);
 ZilchDefineEnum(TabWidth);
 ZilchDefineEnum(TimeMode);
+ZilchDefineEnum(UpdatePhase);
 ZilchDefineEnum(Verbosity);
 ZilchDefineEnum(WindowState);
 ZilchDefineEnum(WindowStyleFlags);
@@ -151,6 +152,7 @@ ZilchDefineStaticLibrary(EngineLibrary)
   ZilchInitializeEnum(StreamType);
   ZilchInitializeEnum(TabWidth);
   ZilchInitializeEnum(TimeMode);
+  ZilchInitializeEnum(UpdatePhase);
   ZilchInitializeEnum(Verbosity);
   ZilchInitializeEnum(WindowState);
   ZilchInitializeEnum(WindowStyleFlags);
@@ -256,6 +258,7 @@ ZilchDefineStaticLibrary(EngineLibrary)
   ZilchInitializeType(Engine);
   ZilchInitializeType(GameSession);
 
+  ZilchInitializeType(AnimationGraphBatch);
   ZilchInitializeType(AnimationNode);
   ZilchInitializeType(PoseNode);
   ZilchInitializeType(BasicAnimation);
@@ -33,6 +33,7 @@ class Hierarchy;
 class KeyboardEvent;
 class UpdateEvent;
 class ActionSpace;
+class AnimationGraphBatch;
 class SavingEvent;
 class DocumentResource;
 
@@ -82,6 +83,7 @@ private:
 #include "CogMetaComposition.hpp"
 //#include "Cog.hpp"
 #include "CogMeta.hpp"
+#include "UpdateList.hpp"
 #include "Space.hpp"
 #include "DocumentResource.hpp"
 #include "ZilchResource.hpp"
@@ -35,12 +35,204 @@ OsEvent* Job::InitializeOsEvent()
   return mOsEvent;
 }
 
-//-----------------------------------------------------------------------------
+//------------------------------------------------------------------- Task Deque
+TaskDeque::TaskDeque()
+  : mTop(0),
+    mBottom(0)
+{
+}
+
+bool TaskDeque::Push(Task* task)
+{
+  s64 bottom = mBottom.Load();
+  s64 top = mTop.Load();
+  if(bottom - top >= cCapacity)
+    return false;
+
+  AtomicStore(&mTasks[bottom & (cCapacity - 1)], task);
+
+  // Publish the task to the thieves
+  mBottom.Store(bottom + 1);
+  return true;
+}
+
+Task* TaskDeque::Pop()
+{
+  // Reserve the bottom task before looking at the top (the exchange is a full
+  // barrier so a thief either sees the new bottom or we see its new top)
+  s64 bottom = mBottom.Load() - 1;
+  mBottom.Exchange(bottom);
+  s64 top = mTop.Load();
+
+  if(top > bottom)
+  {
+    // Empty
+    mBottom.Store(bottom + 1);
+    return nullptr;
+  }
+
+  Task* task = (Task*)AtomicLoad(&mTasks[bottom & (cCapacity - 1)]);
+  if(top != bottom)
+    return task;
+
+  // This was the last task so we have to race the thieves for it
+  if(!mTop.CompareExchangeBool(top + 1, top))
+    task = nullptr;
+  mBottom.Store(bottom + 1);
+  return task;
+}
+
+Task* TaskDeque::Steal()
+{
+  s64 top = mTop.Load();
+  s64 bottom = mBottom.Load();
+  if(top >= bottom)
+    return nullptr;
+
+  Task* task = (Task*)AtomicLoad(&mTasks[top & (cCapacity - 1)]);
+
+  // Someone else (the owner or another thief) took it first
+  if(!mTop.CompareExchangeBool(top + 1, top))
+    return nullptr;
+  return task;
+}
+
+s64 TaskDeque::Size()
+{
+  s64 size = mBottom.Load() - mTop.Load();
+  return size > 0 ? size : 0;
+}
+
+//------------------------------------------------------------------ Task Worker
+// How many tasks are allocated at once when a worker's pool runs out
+const uint cTaskBlockSize = 256;
+
+// How many times an idle worker looks for a task before going to sleep
+const uint cTaskIdleSpinCount = 64;
+
+// The worker running on this thread (null if this thread can't run tasks)
+ZeroThreadLocal TaskWorker* tTaskWorker = nullptr;
+
+TaskWorker::TaskWorker(JobSystem* system, uint index)
+{
+  mSystem = system;
+  mIndex = index;
+  mStealIndex = index;
+  mFreeTasks = nullptr;
+  mRemoteFreeTasks = nullptr;
+}
+
+TaskWorker::~TaskWorker()
+{
+  forRange(Task* block, mTaskBlocks.All())
+    delete[] block;
+}
+
+Task* TaskWorker::AllocateTask()
+{
+  // Take back everything the other workers have freed
+  if(mFreeTasks == nullptr)
+    mFreeTasks = (Task*)AtomicExchange(&mRemoteFreeTasks, nullptr);
+
+  if(mFreeTasks == nullptr)
+  {
+    Task* block = new Task[cTaskBlockSize];
+    mTaskBlocks.PushBack(block);
+    for(uint i = 0; i < cTaskBlockSize; ++i)
+    {
+      block[i].mOwner = this;
+      block[i].mNextFree = mFreeTasks;
+      mFreeTasks = &block[i];
+    }
+  }
+
+  Task* task = mFreeTasks;
+  mFreeTasks = task->mNextFree;
+  return task;
+}
+
+void TaskWorker::FreeTask(Task* task)
+{
+  if(tTaskWorker == this)
+  {
+    task->mNextFree = mFreeTasks;
+    mFreeTasks = task;
+    return;
+  }
+
+  // Another worker finished our task. Only we ever remove from the remote list
+  // (and we always take the whole list) so pushing with a compare exchange is safe
+  void* head;
+  do
+  {
+    head = AtomicLoad(&mRemoteFreeTasks);
+    task->mNextFree = (Task*)head;
+  } while(!AtomicCompareExchangeBool(&mRemoteFreeTasks, task, head));
+}
+
+OsInt TaskWorker::ThreadEntry()
+{
+  tTaskWorker = this;
+  Profile::ProfileSystem::Instance->SetThreadName("Task");
+
+  uint spinCount = 0;
+  while(mSystem->mTaskWorkersActive.Load())
+  {
+    Task* task = mSystem->FindTask(this);
+    if(task != nullptr)
+    {
+      mSystem->ExecuteTask(task);
+      spinCount = 0;
+      continue;
+    }
+
+    if(++spinCount < cTaskIdleSpinCount)
+    {
+      Os::Sleep(0);
+      continue;
+    }
+    spinCount = 0;
+
+    // We have to say we're sleeping before checking one last time, otherwise
+    // a task could be pushed after our check but before anyone knows to wake us
+    ++mSystem->mSleepingTaskWorkers;
+    task = mSystem->FindTask(this);
+    if(task != nullptr)
+    {
+      --mSystem->mSleepingTaskWorkers;
+      mSystem->ExecuteTask(task);
+      continue;
+    }
+
+    mSystem->mTaskWake.WaitAndDecrement();
+    --mSystem->mSleepingTaskWorkers;
+  }
+
+  tTaskWorker = nullptr;
+  return 0;
+}
+
+//------------------------------------------------------------------- Job System
 namespace Z
 {
   JobSystem* gJobs = nullptr;
 }
 
+// Each worker should get about this many chunks of a parallel for
+const uint cParallelForChunksPerWorker = 4;
+
+// A parallel for range is only split while its worker has fewer tasks than this
+const s64 cParallelForSplitThreshold = 2;
+
+struct ParallelForData
+{
+  JobSystem::RangeFunction mFunction;
+  void* mFunctor;
+  uint mBegin;
+  uint mEnd;
+  uint mChunkSize;
+};
+
 JobSystem::JobSystem()
 {
   mWorkerThreadsActive = true;
@@ -53,10 +245,38 @@ JobSystem::JobSystem()
     thread.Initialize(&Thread::ObjectEntryCreator<JobSystem,&JobSystem::WorkerThreadEntry>, this, "Background");
     thread.Resume();
   }
+
+  // The thread creating the job system (the main thread) is always task worker 0
+  mTaskWorkersActive = true;
+  mTaskWorkers.PushBack(new TaskWorker(this, 0));
+  tTaskWorker = mTaskWorkers.Front();
+
+  if(ThreadingEnabled)
+  {
+    uint processorCount = Os::GetProcessorCount();
+    for(uint i = 1; i < processorCount; ++i)
+      mTaskWorkers.PushBack(new TaskWorker(this, i));
+
+    for(uint i = 1; i < mTaskWorkers.Size(); ++i)
+    {
+      Thread& thread = mTaskWorkers[i]->mThread;
+      thread.Initialize(&Thread::ObjectEntryCreator<TaskWorker, &TaskWorker::ThreadEntry>, mTaskWorkers[i], "TaskWorker");
+      thread.Resume();
+    }
+  }
 }
 
 JobSystem::~JobSystem()
 {
+  // Stop the task workers (there should be no tasks left, everyone waits on their tasks)
+  mTaskWorkersActive = false;
+  for(uint i = 1; i < mTaskWorkers.Size(); ++i)
+    mTaskWake.Increment();
+  for(uint i = 1; i < mTaskWorkers.Size(); ++i)
+    mTaskWorkers[i]->mThread.WaitForCompletion();
+  tTaskWorker = nullptr;
+  DeleteObjectsInContainer(mTaskWorkers);
+
   mWorkerThreadsActive = false;
 
   mLock.Lock();
@@ -133,6 +353,8 @@ void JobSystem::JobFinished(Job* job)
 
 OsInt JobSystem::WorkerThreadEntry()
 {
+  Profile::ProfileSystem::Instance->SetThreadName("Job");
+
   for(;;)
   {
     mJobCounter.WaitAndDecrement();
@@ -169,4 +391,383 @@ void JobSystem::AddJob(Job* job)
   mJobCounter.Increment();
 }
 
+Task* JobSystem::CreateTask(TaskFunction function, TaskCounter* counter)
+{
+  TaskWorker* worker = tTaskWorker;
+  ErrorIf(worker == nullptr, "Tasks can only be created on the main thread or from inside of a task");
+
+  Task* task = worker->AllocateTask();
+  task->mFunction = function;
+  task->mParent = nullptr;
+  task->mCounter = counter;
+  task->mUnfinished = 1;
+
+  if(counter != nullptr)
+    ++counter->mCount;
+  return task;
+}
+
+Task* JobSystem::CreateChildTask(Task* parent, TaskFunction function)
+{
+  Task* task = CreateTask(function);
+  task->mParent = parent;
+  ++parent->mUnfinished;
+  return task;
+}
+
+void JobSystem::RunTask(Task* task)
+{
+  // If our deque is full then just run it now
+  if(!tTaskWorker->mDeque.Push(task))
+  {
+    ExecuteTask(task);
+    return;
+  }
+
+  if(mSleepingTaskWorkers.Load() > 0)
+    mTaskWake.Increment();
+}
+
+void JobSystem::WaitForTasks(TaskCounter& counter)
+{
+  TaskWorker* worker = tTaskWorker;
+
+  while(!counter.IsDone())
+  {
+    // Threads that aren't workers can't run tasks, so they just wait
+    Task* task = nullptr;
+    if(worker != nullptr)
+      task = FindTask(worker);
+
+    if(task != nullptr)
+      ExecuteTask(task);
+    else
+      Os::Sleep(0);
+  }
+}
+
+uint JobSystem::GetTaskWorkerCount()
+{
+  return mTaskWorkers.Size();
+}
+
+uint JobSystem::GetTaskWorkerIndex()
+{
+  TaskWorker* worker = tTaskWorker;
+  return worker != nullptr ? worker->mIndex : 0;
+}
+
+Task* JobSystem::FindTask(TaskWorker* worker)
+{
+  Task* task = worker->mDeque.Pop();
+  if(task != nullptr)
+    return task;
+
+  // Try to steal from every other worker (starting where we last left off)
+  uint workerCount = mTaskWorkers.Size();
+  for(uint i = 1; i < workerCount; ++i)
+  {
+    worker->mStealIndex = (worker->mStealIndex + 1) % workerCount;
+    if(worker->mStealIndex == worker->mIndex)
+      continue;
+
+    task = mTaskWorkers[worker->mStealIndex]->mDeque.Steal();
+    if(task != nullptr)
+      return task;
+  }
+  return nullptr;
+}
+
+void JobSystem::ExecuteTask(Task* task)
+{
+  task->mFunction(task);
+  FinishTask(task);
+}
+
+void JobSystem::FinishTask(Task* task)
+{
+  // Still waiting on children
+  if(--task->mUnfinished != 0)
+    return;
+
+  Task* parent = task->mParent;
+  TaskCounter* counter = task->mCounter;
+  task->mOwner->FreeTask(task);
+
+  if(parent != nullptr)
+    FinishTask(parent);
+  if(counter != nullptr)
+    --counter->mCount;
+}
+
+void JobSystem::RunParallelFor(uint begin, uint end, uint minChunkSize, RangeFunction function, void* functor)
+{
+  if(end <= begin)
+    return;
+
+  uint count = end - begin;
+  uint chunkSize = Math::Max(Math::Max(minChunkSize, 1u), count / (mTaskWorkers.Size() * cParallelForChunksPerWorker));
+
+  // Nothing to split up (or we can't run tasks on this thread)
+  if(count <= chunkSize || mTaskWorkers.Size() == 1 || tTaskWorker == nullptr)
+  {
+    function(functor, begin, end);
+    return;
+  }
+
+  TaskCounter counter;
+  Task* task = CreateTask(&JobSystem::ParallelForTask, &counter);
+  ParallelForData& data = task->GetData<ParallelForData>();
+  data.mFunction = function;
+  data.mFunctor = functor;
+  data.mBegin = begin;
+  data.mEnd = end;
+  data.mChunkSize = chunkSize;
+
+  RunTask(task);
+  WaitForTasks(counter);
+}
+
+void JobSystem::ParallelForTask(Task* task)
+{
+  ParallelForData& data = task->GetData<ParallelForData>();
+  JobSystem* system = tTaskWorker->mSystem;
+  TaskDeque& deque = tTaskWorker->mDeque;
+
+  uint begin = data.mBegin;
+  uint end = data.mEnd;
+  while(begin < end)
+  {
+    // Give the back half of our range away if there's nothing left for thieves to take
+    if(end - begin > data.mChunkSize * 2 && deque.Size() < cParallelForSplitThreshold)
+    {
+      uint middle = begin + (end - begin) / 2;
+      Task* child = system->CreateChildTask(task, &JobSystem::ParallelForTask);
+      ParallelForData& childData = child->GetData<ParallelForData>();
+      childData = data;
+      childData.mBegin = middle;
+      childData.mEnd = end;
+      system->RunTask(child);
+      end = middle;
+      continue;
+    }
+
+    // Take everything that's left rather than leaving a piece smaller than a chunk behind
+    uint chunkEnd = begin + data.mChunkSize;
+    if(end - begin < data.mChunkSize * 2)
+      chunkEnd = end;
+    data.mFunction(data.mFunctor, begin, chunkEnd);
+    begin = chunkEnd;
+  }
+}
+
+//------------------------------------------------------------------- Unit Tests
+namespace TaskUnitTests
+{
+
+// Tasks are never dereferenced by the deque, so each marker byte is used as a fake task
+Task* GetMarker(Array<byte>& markers, uint index)
+{
+  return (Task*)&markers[index];
+}
+
+uint GetMarkerIndex(Array<byte>& markers, Task* task)
+{
+  return (uint)((byte*)task - markers.Data());
+}
+
+struct StealData
+{
+  TaskDeque* mDeque;
+  Array<byte>* mMarkers;
+  s32* mTaken;
+  Atomic<s32>* mDone;
+};
+
+// Steals from the deque until the owner is done with it
+void StealTask(Task* task)
+{
+  StealData& data = task->GetData<StealData>();
+  for(;;)
+  {
+    bool done = data.mDone->Load() != 0;
+    Task* stolen = data.mDeque->Steal();
+    if(stolen != nullptr)
+      AtomicPreIncrement(&data.mTaken[GetMarkerIndex(*data.mMarkers, stolen)]);
+    else if(done)
+      return;
+  }
+}
+
+struct VisitRanges
+{
+  // Every range visited is expected to be at least minChunkSize long
+  VisitRanges(uint end, uint minChunkSize)
+  {
+    mMinChunkSize = minChunkSize;
+    mVisits.Resize(end, 0);
+  }
+
+  void operator()(uint start, uint end)
+  {
+    if(end - start < mMinChunkSize)
+      ++mShortRanges;
+    for(uint i = start; i < end; ++i)
+      AtomicPreIncrement(&mVisits[i]);
+  }
+
+  uint mMinChunkSize;
+  Array<s32> mVisits;
+  Atomic<s32> mShortRanges;
+};
+
+struct NestedRanges
+{
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+    {
+      VisitRanges inner(1000, 1);
+      Z::gJobs->ParallelFor(0, 1000, inner);
+      for(uint j = 0; j < 1000; ++j)
+        mTotal += inner.mVisits[j];
+    }
+  }
+
+  Atomic<s32> mTotal;
+};
+
+void CountTask(Task* task)
+{
+  Atomic<s32>* count = task->GetData<Atomic<s32>*>();
+  ++(*count);
+}
+
+void ParentTask(Task* task)
+{
+  Atomic<s32>* count = task->GetData<Atomic<s32>*>();
+  ++(*count);
+
+  // Children can be added while the parent is running
+  for(uint i = 0; i < 32; ++i)
+  {
+    Task* child = Z::gJobs->CreateChildTask(task, &CountTask);
+    child->GetData<Atomic<s32>*>() = count;
+    Z::gJobs->RunTask(child);
+  }
+}
+
+}//namespace TaskUnitTests
+
+void JobSystem::RunTaskUnitTests()
+{
+  using namespace TaskUnitTests;
+  ErrorIf(tTaskWorker != mTaskWorkers.Front(), "Task unit tests must be run from the main thread");
+
+  // The deque is too large to put on the stack
+  TaskDeque* deque = new TaskDeque();
+  Array<byte> markers;
+  markers.Resize(TaskDeque::cCapacity + 1);
+
+  // The owner pops the newest task and thieves steal the oldest
+  ErrorIf(deque->Pop() != nullptr || deque->Steal() != nullptr, "An empty TaskDeque returned a task");
+  deque->Push(GetMarker(markers, 0));
+  deque->Push(GetMarker(markers, 1));
+  deque->Push(GetMarker(markers, 2));
+  ErrorIf(deque->Size() != 3, "TaskDeque has the wrong size");
+  ErrorIf(deque->Pop() != GetMarker(markers, 2), "TaskDeque::Pop didn't return the newest task");
+  ErrorIf(deque->Steal() != GetMarker(markers, 0), "TaskDeque::Steal didn't return the oldest task");
+  ErrorIf(deque->Pop() != GetMarker(markers, 1), "TaskDeque::Pop didn't return the last task");
+  ErrorIf(deque->Pop() != nullptr || deque->Size() != 0, "TaskDeque should be empty");
+
+  // Filling the deque (with the indices wrapping around the ring) and draining it in order
+  for(uint i = 0; i < TaskDeque::cCapacity; ++i)
+    ErrorIf(!deque->Push(GetMarker(markers, i)), "TaskDeque was full before reaching its capacity");
+  ErrorIf(deque->Push(GetMarker(markers, TaskDeque::cCapacity)), "TaskDeque accepted a task past its capacity");
+  for(uint i = 0; i < TaskDeque::cCapacity; ++i)
+    ErrorIf(deque->Steal() != GetMarker(markers, i), "TaskDeque::Steal returned tasks out of order");
+  ErrorIf(deque->Steal() != nullptr, "TaskDeque should be empty");
+
+  // The owner pushes and pops while every other task worker steals, each task must be taken exactly once
+  const uint cStealTaskCount = 100000;
+  markers.Resize(cStealTaskCount);
+  Array<s32> taken;
+  taken.Resize(cStealTaskCount, 0);
+  Atomic<s32> done;
+  done = 0;
+
+  TaskCounter thieves;
+  for(uint i = 1; i < mTaskWorkers.Size(); ++i)
+  {
+    Task* task = CreateTask(&StealTask, &thieves);
+    StealData& data = task->GetData<StealData>();
+    data.mDeque = deque;
+    data.mMarkers = &markers;
+    data.mTaken = taken.Data();
+    data.mDone = &done;
+    RunTask(task);
+  }
+
+  uint pushed = 0;
+  while(pushed < cStealTaskCount)
+  {
+    // If the thieves fall behind and the deque fills up the owner takes the task itself
+    for(uint i = 0; i < 64 && pushed < cStealTaskCount; ++i, ++pushed)
+    {
+      if(!deque->Push(GetMarker(markers, pushed)))
+        AtomicPreIncrement(&taken[pushed]);
+    }
+    for(uint i = 0; i < 32; ++i)
+    {
+      Task* popped = deque->Pop();
+      if(popped != nullptr)
+        AtomicPreIncrement(&taken[GetMarkerIndex(markers, popped)]);
+    }
+  }
+  while(Task* popped = deque->Pop())
+    AtomicPreIncrement(&taken[GetMarkerIndex(markers, popped)]);
+
+  done = 1;
+  WaitForTasks(thieves);
+  for(uint i = 0; i < cStealTaskCount; ++i)
+    ErrorIf(taken[i] != 1, "A task in the TaskDeque was taken %d times", taken[i]);
+  delete deque;
+
+  // ParallelFor visits every index exactly once and never splits off a range smaller than the minimum
+  const uint cMinChunkSizes[] = {1, 7, 64, 5000};
+  for(uint i = 0; i < sizeof(cMinChunkSizes) / sizeof(uint); ++i)
+  {
+    VisitRanges ranges(10007, cMinChunkSizes[i]);
+    ParallelFor(0, 10007, ranges, cMinChunkSizes[i]);
+    for(uint j = 0; j < ranges.mVisits.Size(); ++j)
+      ErrorIf(ranges.mVisits[j] != 1, "ParallelFor visited index %d %d times", j, ranges.mVisits[j]);
+    ErrorIf(ranges.mShortRanges.Load() != 0, "ParallelFor split off a range smaller than the minimum chunk size");
+  }
+
+  // Ranges that don't start at zero and empty ranges
+  VisitRanges offsetRanges(300, 1);
+  ParallelFor(100, 300, offsetRanges);
+  for(uint i = 0; i < 300; ++i)
+    ErrorIf(offsetRanges.mVisits[i] != (i < 100 ? 0 : 1), "ParallelFor visited outside of its range");
+  ParallelFor(5, 5, offsetRanges);
+  ParallelFor(9, 2, offsetRanges);
+  ErrorIf(offsetRanges.mVisits[5] != 1 || offsetRanges.mVisits[9] != 1, "ParallelFor ran an empty range");
+
+  // ParallelFor from inside of a ParallelFor
+  NestedRanges nested;
+  nested.mTotal = 0;
+  ParallelFor(0, 16, nested);
+  ErrorIf(nested.mTotal.Load() != 16 * 1000, "Nested ParallelFor missed part of its range");
+
+  // The counter isn't done until the parent and all of its children are
+  Atomic<s32> count;
+  count = 0;
+  TaskCounter counter;
+  Task* parent = CreateTask(&ParentTask, &counter);
+  parent->GetData<Atomic<s32>*>() = &count;
+  RunTask(parent);
+  WaitForTasks(counter);
+  ErrorIf(count.Load() != 33, "WaitForTasks returned before every child task was finished");
+}
+
 }//zero
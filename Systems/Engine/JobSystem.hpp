@@ -39,7 +39,112 @@ public:
   Link<Job> link;
 };
 
+class Task;
+class TaskWorker;
+typedef void (*TaskFunction)(Task* task);
+
+//------------------------------------------------------------------ Task Counter
+/// Counts the unfinished tasks that were created with it. Usually lives on the
+/// stack of whoever is going to wait on the tasks.
+class TaskCounter
+{
+public:
+  TaskCounter() : mCount(0) {}
+
+  bool IsDone() { return mCount.Load() == 0; }
+
+  Atomic<s32> mCount;
+};
+
+//------------------------------------------------------------------------- Task
+// How many bytes of user data fit inside of a task
+const uint cTaskDataSize = 80;
+
+/// A small unit of work run by the task workers. Tasks are pooled by the worker
+/// that created them and are freed as soon as they (and all of their children)
+/// are finished, so a task should never be referenced after it has been run.
+class Task
+{
+public:
+  /// The user data stored inline in the task.
+  template <typename T>
+  T& GetData()
+  {
+    StaticAssert(TaskDataFits, sizeof(T) <= cTaskDataSize, "Task data is too large");
+    return *(T*)mData;
+  }
+
+  TaskFunction mFunction;
+  /// The parent isn't finished until all of its children are finished.
+  Task* mParent;
+  /// Decremented when this task and all of its children are finished.
+  TaskCounter* mCounter;
+  /// The worker whose pool this task was allocated from.
+  TaskWorker* mOwner;
+  Task* mNextFree;
+  /// This task plus all of its unfinished children.
+  Atomic<s32> mUnfinished;
+  // Stored as u64s so the data is aligned for pointers
+  u64 mData[cTaskDataSize / sizeof(u64)];
+};
+
+//------------------------------------------------------------------- Task Deque
+/// Chase-Lev work stealing deque. Only the owning worker pushes and pops from
+/// the bottom, any other worker can steal from the top.
+class TaskDeque
+{
+public:
+  static const s64 cCapacity = 4096;
+
+  TaskDeque();
+
+  /// Returns false if the deque is full.
+  bool Push(Task* task);
+  Task* Pop();
+  Task* Steal();
+  /// An estimate of how many tasks are in the deque (only exact for the owner).
+  s64 Size();
+
+private:
+  Atomic<s64> mTop;
+  Atomic<s64> mBottom;
+  void* volatile mTasks[cCapacity];
+};
+
+//------------------------------------------------------------------ Task Worker
+/// A thread that runs tasks (the main thread is also a worker). Each worker has
+/// its own deque and its own pool of tasks.
+class TaskWorker
+{
+public:
+  TaskWorker(JobSystem* system, uint index);
+  ~TaskWorker();
+
+  Task* AllocateTask();
+  void FreeTask(Task* task);
+
+  OsInt ThreadEntry();
+
+  JobSystem* mSystem;
+  uint mIndex;
+  uint mStealIndex;
+  TaskDeque mDeque;
+  Thread mThread;
+
+private:
+  // Tasks freed by this worker
+  Task* mFreeTasks;
+  // Tasks that other workers finished and gave back to us
+  void* volatile mRemoteFreeTasks;
+  Array<Task*> mTaskBlocks;
+};
+
 //------------------------------------------------------------------- Job System
+/// Runs jobs and tasks on background threads. Jobs are long running (possibly
+/// blocking) operations like loading that each get their own turn on the
+/// background threads. Tasks are small units of work that are spread over one
+/// worker per core by work stealing, and whoever waits on a task helps run them.
+/// Tasks can only be created on the main thread or from inside of another task.
 class JobSystem
 {
 public:
@@ -49,6 +154,38 @@ public:
   void AddJob(Job* job);
   OsInt WorkerThreadEntry();
 
+  /// Creates a task that will decrement the counter (if given) when it and all
+  /// of its children are done. The task must be run with RunTask.
+  Task* CreateTask(TaskFunction function, TaskCounter* counter = nullptr);
+  /// Creates a task that must finish before the parent is considered finished.
+  /// Must be called before the parent is run or while the parent is running.
+  Task* CreateChildTask(Task* parent, TaskFunction function);
+  void RunTask(Task* task);
+  /// Runs other tasks on this thread until every task on the counter is done.
+  void WaitForTasks(TaskCounter& counter);
+
+  /// Calls functor(start, end) over sub ranges of [begin, end) on all task workers
+  /// and returns once the entire range is done. Ranges are split lazily, so a range
+  /// is only broken up further while the other workers are looking for work.
+  /// No sub range is ever smaller than minChunkSize (unless the whole range is).
+  template <typename RangeFunctor>
+  void ParallelFor(uint begin, uint end, RangeFunctor& functor, uint minChunkSize = 1)
+  {
+    RunParallelFor(begin, end, minChunkSize, &CallRangeFunctor<RangeFunctor>, &functor);
+  }
+
+  /// How many threads run tasks (including the main thread).
+  uint GetTaskWorkerCount();
+  /// The index of the task worker on the calling thread, from 0 to the worker count.
+  /// The main thread (and any thread that can't run tasks) is 0.
+  uint GetTaskWorkerIndex();
+
+  /// Checks the task deques, ParallelFor and child tasks on the running task
+  /// workers. Errors on any failure (must be called from the main thread).
+  void RunTaskUnitTests();
+
+  typedef void (*RangeFunction)(void* functor, uint start, uint end);
+
 private:
   ThreadLock mLock;
   InList<Job> PendingJobs;
@@ -59,6 +196,26 @@ private:
   void JobFinished(Job* job);
   bool mWorkerThreadsActive;
   friend class Job;
+
+  template <typename RangeFunctor>
+  static void CallRangeFunctor(void* functor, uint start, uint end)
+  {
+    (*(RangeFunctor*)functor)(start, end);
+  }
+
+  void RunParallelFor(uint begin, uint end, uint minChunkSize, RangeFunction function, void* functor);
+  static void ParallelForTask(Task* task);
+
+  friend class TaskWorker;
+  Task* FindTask(TaskWorker* worker);
+  void ExecuteTask(Task* task);
+  void FinishTask(Task* task);
+
+  Array<TaskWorker*> mTaskWorkers;
+  // Idle task workers sleep on this once they run out of tasks to steal
+  Semaphore mTaskWake;
+  Atomic<s32> mSleepingTaskWorkers;
+  Atomic<bool> mTaskWorkersActive;
 };
 
 namespace Z
@@ -48,6 +48,16 @@ void LerpKeyFrame(KeyFrame& out, KeyFrame& keyOne, KeyFrame& keyTwo, float t)
   out.KeyValue = LerpValue(keyOne.KeyValue, keyTwo.KeyValue, t);
 }
 
+//******************************************************************************
+// If the time is between the given key and the next (or past the last key)
+template<typename keyFrames>
+bool KeyIntervalContains(keyFrames& mKeyFrames, uint key, float time)
+{
+  if(mKeyFrames[key].Time > time)
+    return false;
+  return key == mKeyFrames.Size() - 1 || mKeyFrames[key + 1].Time >= time;
+}
+
 //******************************************************************************
 template<typename keyFrames, typename keyFrameType>
 void InterpolateKeyFrame(float time, uint& keyFrameIndex, keyFrames& mKeyFrames,
@@ -58,13 +68,15 @@ void InterpolateKeyFrame(float time, uint& keyFrameIndex, keyFrames& mKeyFrames,
 
   // Since keys are not spaced at regular intervals we need to search
   // for the keyframes that will be interpolated between.  The track data is
-  // used to store what the last keyframe was to prevent searching the entire
-  // track.
+  // used to store what the last keyframe was (a cursor) which is almost always
+  // still the interval, or the one right after it. Anything else (looping back
+  // to the start or scrubbing) is a binary search rather than a walk over the keys.
 
   if(mKeyFrames.Size() == 0)
     return;
 
-  if(CurKey >= mKeyFrames.Size())
+  uint lastKey = mKeyFrames.Size() - 1;
+  if(CurKey > lastKey)
     CurKey = 0;
 
   // If it's to the left of the first frame, use the key value of the first frame
@@ -74,16 +86,30 @@ void InterpolateKeyFrame(float time, uint& keyFrameIndex, keyFrames& mKeyFrames,
     return;
   }
 
-  // Search Forward in the keyframes for the interval
-  while(CurKey!= mKeyFrames.Size() - 1 && 
-    mKeyFrames[ CurKey + 1 ].Time < animTime )
-    ++CurKey;
-
-  // Search Backward in the keyframes for the interval
-  while(CurKey!= 0 && mKeyFrames[ CurKey ].Time > animTime )
-    --CurKey;
+  if(!KeyIntervalContains(mKeyFrames, CurKey, animTime))
+  {
+    if(CurKey != lastKey && KeyIntervalContains(mKeyFrames, CurKey + 1, animTime))
+    {
+      ++CurKey;
+    }
+    else
+    {
+      // Find the first key after the time, the interval starts at the key before it
+      uint begin = 1;
+      uint end = mKeyFrames.Size();
+      while(begin < end)
+      {
+        uint middle = begin + (end - begin) / 2;
+        if(mKeyFrames[middle].Time < animTime)
+          begin = middle + 1;
+        else
+          end = middle;
+      }
+      CurKey = begin - 1;
+    }
+  }
 
-  if(CurKey == mKeyFrames.Size()  - 1)
+  if(CurKey == lastKey)
   {
     // Past the last keyframe for this path so use the last frame and the
     // transform data so the animation is clamped to the last frame
@@ -110,6 +136,75 @@ void InterpolateKeyFrame(float time, uint& keyFrameIndex, keyFrames& mKeyFrames,
   keyFrameIndex = CurKey;
 }
 
+//******************************************************************************
+void SetMetaProperty(BlendTrack& track, AnyParam value)
+{
+  track.Property->SetValue(track.Object, value);
+}
+
+//******************************************************************************
+// Bone animations are almost entirely transform tracks, so they skip meta
+void SetTransformTranslation(BlendTrack& track, AnyParam value)
+{
+  if(Transform* transform = track.Object.Get<Transform*>())
+    transform->SetTranslation(*(const Vec3*)value.GetData());
+}
+
+//******************************************************************************
+void SetTransformRotation(BlendTrack& track, AnyParam value)
+{
+  if(Transform* transform = track.Object.Get<Transform*>())
+    transform->SetRotation(*(const Quat*)value.GetData());
+}
+
+//******************************************************************************
+void SetTransformScale(BlendTrack& track, AnyParam value)
+{
+  if(Transform* transform = track.Object.Get<Transform*>())
+    transform->SetScale(*(const Vec3*)value.GetData());
+}
+
+//******************************************************************************
+void SetAreaSize(BlendTrack& track, AnyParam value)
+{
+  if(Area* area = track.Object.Get<Area*>())
+    area->SetSize(*(const Vec2*)value.GetData());
+}
+
+//******************************************************************************
+// Fields have no setter to run (colors, speeds, and so on), so the value is
+// copied straight into the object's memory
+void SetField(BlendTrack& track, AnyParam value)
+{
+  Field* field = (Field*)track.Property;
+  if(byte* memory = track.Object.Dereference())
+    memcpy(memory + field->Offset, value.GetData(), field->PropertyType->GetCopyableSize());
+}
+
+//******************************************************************************
+BlendTrackSetter GetBlendTrackSetter(Property* prop)
+{
+  if(prop->Owner == ZilchTypeId(Transform))
+  {
+    if(prop->Name == "Translation")
+      return SetTransformTranslation;
+    if(prop->Name == "Rotation")
+      return SetTransformRotation;
+    if(prop->Name == "Scale")
+      return SetTransformScale;
+  }
+
+  if(prop->Owner == ZilchTypeId(Area) && prop->Name == "Size")
+    return SetAreaSize;
+
+  // Only plain values can be copied, anything else has to be assigned through meta
+  Field* field = Type::DynamicCast<Field*>(prop);
+  if(field && !field->IsStatic && !field->PropertyType->IsCopyComplex())
+    return SetField;
+
+  return SetMetaProperty;
+}
+
 //******************************************************************************
 BlendTrack* GetBlendTrack(StringParam name, BlendTracks& tracks, HandleParam instance, Property* prop)
 {
@@ -121,6 +216,7 @@ BlendTrack* GetBlendTrack(StringParam name, BlendTracks& tracks, HandleParam ins
     blendTrack->Index = tracks.Size();
     blendTrack->Object = instance;
     blendTrack->Property = prop;
+    blendTrack->Setter = GetBlendTrackSetter(prop);
     tracks.Insert(name, blendTrack);
   }
 
@@ -70,8 +70,10 @@ void AnimatePropertyType<propertyType>::UpdateFrame(PropertyTrackPlayData& data,
   InterpolateKeyFrame(params.Time, data.mKeyframeIndex,
                       this->mKeyFrames, keyFrame);
 
-  animationFrame.Tracks[ data.mBlend->Index ].Active = true;
-  animationFrame.Tracks[ data.mBlend->Index ].Value = keyFrame.KeyValue;
+  // Copied straight into the frame's value rather than through a temporary Any
+  AnimationFrameData& frameData = animationFrame.Tracks[ data.mBlend->Index ];
+  frameData.Active = true;
+  frameData.Value.AssignFrom((const byte*)&keyFrame.KeyValue, this->TypeId);
 };
 
 //******************************************************************************
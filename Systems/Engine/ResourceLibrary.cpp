@@ -180,6 +180,59 @@ void SwapLibrary::Unload()
   mCurrentLibrary = nullptr;
 }
 
+//---------------------------------------------------------------------------- Script Library Inputs
+//**************************************************************************************************
+// Strings are hashed with their size so that moving text between them changes the hash
+static void AppendContent(Sha1Builder& builder, StringParam text)
+{
+  u64 size = (u64)text.SizeInBytes();
+  builder.Append((const byte*)&size, sizeof(size));
+  builder.Append(text.All());
+}
+
+//**************************************************************************************************
+void ScriptLibraryInputs::Build(ResourceLibrary* library, Module& dependencies)
+{
+  Clear();
+
+  Sha1Builder builder;
+  forRange(ZilchDocumentResource* script, library->mScripts)
+  {
+    // Same as compiling, templates are never added to the project
+    if(script->GetResourceTemplate() != nullptr)
+      continue;
+
+    AppendContent(builder, script->GetNameOrFilePath());
+    AppendContent(builder, script->mText);
+  }
+
+  forRange(HandleOf<Resource> resourceHandle, library->Resources.All())
+  {
+    Resource* resource = resourceHandle;
+    AppendContent(builder, resource->Name);
+    builder.Append((const byte*)&resource->mResourceId, sizeof(resource->mResourceId));
+  }
+
+  mContentHash = builder.OutputHashString();
+  mDependencies.Append(dependencies.All());
+}
+
+//**************************************************************************************************
+void ScriptLibraryInputs::Clear()
+{
+  mContentHash = String();
+  mDependencies.Clear();
+}
+
+//**************************************************************************************************
+bool ScriptLibraryInputs::operator==(const ScriptLibraryInputs& rhs) const
+{
+  // A library that never compiled has no hash
+  return !mContentHash.Empty() &&
+         mContentHash == rhs.mContentHash &&
+         mDependencies == rhs.mDependencies;
+}
+
 //--------------------------------------------------------------------------------- Resource Library
 BoundType* ResourceLibrary::sScriptType = nullptr;
 BoundType* ResourceLibrary::sFragmentType = nullptr;
@@ -540,6 +593,21 @@ bool ResourceLibrary::CompileScripts(HashSet<ResourceLibrary*>& modifiedLibrarie
       dependencies.Append(pluginLibrary);
   }
 
+  // Scripts are often marked as modified without anything changing (a script saved without changes
+  // or a dependent library recompiling the same code). When nothing the library is built from
+  // changed, the library we already built is still up to date so don't compile it again.
+  ScriptLibraryInputs inputs;
+  inputs.Build(this, dependencies);
+  if(mSwapScript.GetNewestLibrary() != nullptr && inputs == mScriptInputs)
+  {
+    // A library that was compiled but not yet committed still needs to be committed
+    if(mSwapScript.HasPendingLibrary())
+      modifiedLibrariesOut.Insert(this);
+
+    mSwapScript.mCompileStatus = ZilchCompileStatus::Compiled;
+    return true;
+  }
+
   // By this point, we've already compiled all our dependencies
   ZPrint("  Compiling %s Scripts\n", this->Name.c_str());
 
@@ -561,6 +629,7 @@ bool ResourceLibrary::CompileScripts(HashSet<ResourceLibrary*>& modifiedLibrarie
   {
     modifiedLibrariesOut.Insert(this);
     mSwapScript.mCompileStatus = ZilchCompileStatus::Compiled;
+    mScriptInputs = inputs;
     return true;
   }
 
@@ -133,6 +133,27 @@ public:
   ZilchCompileStatus::Enum mCompileStatus;
 };
 
+//---------------------------------------------------------------------------- Script Library Inputs
+/// Identifies everything the script library of a resource library is compiled from. If none
+/// of it has changed since the last successful compile, compiling again would build the same
+/// library. This only lets a session skip recompiling a library, it is not saved to disk.
+/// Any change to one script still recompiles the whole library.
+class ScriptLibraryInputs
+{
+public:
+  void Build(ResourceLibrary* library, Module& dependencies);
+  void Clear();
+
+  bool operator==(const ScriptLibraryInputs& rhs) const;
+
+  // Sha1 of the name and code of every script that is compiled, and of every resource
+  // (each is added as an extension property on its type, e.g. SpriteSource.Fireball)
+  String mContentHash;
+  // Dependencies are compiled libraries, so they are compared by identity
+  // (holding them keeps them alive so a new library can't reuse the address)
+  Array<LibraryRef> mDependencies;
+};
+
 //--------------------------------------------------------------------------------- Resource Library
 /// A Resource Library is a set of resources loaded from a
 /// resource package. Used to manage resource lifetimes.
@@ -217,6 +238,9 @@ public:
   // The fragment library that this resource library has built (may be null if it hasn't compiled yet)
   SwapLibrary mSwapFragment;
 
+  // What the newest script library was compiled from
+  ScriptLibraryInputs mScriptInputs;
+
   // A project we use for the scripts (we clear it and re-add all code files)
   // We need this to stick around for the Zilch debugger
   Project mScriptProject;
@@ -46,6 +46,9 @@ ZilchDefineType(Space, builder, type)
   ZilchBindMethod(FindAllObjectsByName);
   ZilchBindMethod(FindAllRootObjectsByName);
 
+  ZilchBindMethod(AddToUpdateList);
+  ZilchBindMethod(RemoveFromUpdateLists);
+
   ZilchBindMethod(DestroyAll);
   ZilchBindMethod(DestroyAllFromLevel);
 
@@ -70,6 +73,7 @@ Space::Space()
   mIsLoadingLevel = false;
   mInvalidObjectPositionOccurred = false;
   mMaxObjectPosition = real(1e+10);
+  mAnimationGraphs = nullptr;
 }
 
 Space::~Space()
@@ -77,6 +81,8 @@ Space::~Space()
   ErrorIf(!mCogList.Empty(), "Not all objects in space destroyed.");
   Z::gEngine->mSpaceList.Erase(this);
 
+  SafeDelete(mAnimationGraphs);
+
   // Remove ourself from the game session list
   if (GameSession* gameSession = GetGameSession())
     gameSession->InternalRemove(this);
@@ -569,6 +575,56 @@ Cog* Space::FindLastRootObjectByName(StringParam name)
   return nullptr;
 }
 
+void Space::AddToUpdateList(UpdatePhase::Enum phase, DelegateParam update)
+{
+  if(update.IsNull())
+  {
+    DoNotifyException("The delegate is null", "Cannot update a null delegate");
+    return;
+  }
+
+  Component* component = update.ThisHandle.Get<Component*>();
+  if(component == nullptr || component->GetSpace() != this)
+  {
+    DoNotifyException("Cannot add to update list",
+      "The delegate must be a method on a component in this space");
+    return;
+  }
+
+  // Script components are removed from the lists when they are destroyed,
+  // native components add themselves with their own update functions
+  if(ZilchVirtualTypeId(component)->Native)
+  {
+    DoNotifyException("Cannot add to update list", "Only script components can be added");
+    return;
+  }
+
+  // The method is given the UpdateEvent sent with the matching update event
+  Function* function = update.BoundFunction;
+  const ParameterArray& params = function->FunctionType->Parameters;
+  Type* eventType = params.Empty() ? nullptr : params[0].ParameterType;
+  if(params.Size() != 1 || !ZilchTypeId(UpdateEvent)->IsA(eventType))
+  {
+    DoNotifyException("Cannot add to update list", String::Format(
+      "The update method must take only an UpdateEvent. Function %s has the signature: %s",
+      function->Name.c_str(), function->FunctionType->ToString().c_str()));
+    return;
+  }
+
+  mUpdateLists.AddScript(component, phase, function);
+}
+
+void Space::RemoveFromUpdateLists(Component* component)
+{
+  if(component == nullptr)
+  {
+    DoNotifyException("Cannot remove from update lists", "The component is null");
+    return;
+  }
+
+  mUpdateLists.Remove(component);
+}
+
 void Space::LoadLevelAdditive(Level* level)
 {
   // Set the level redundantly because AddObjectsFromLevel can send out an event.
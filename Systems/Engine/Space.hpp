@@ -156,6 +156,16 @@ public:
   /// Number of objects in the space.
   uint GetObjectCount() { return mCogsInSpace; }
 
+  //----------------------------------------------------------------- Updating
+  /// Calls the delegate's method on its component every frame or logic update,
+  /// right before FrameUpdate / LogicUpdate is sent. Every component updated by
+  /// the same method is kept in one list, which is much faster than each of
+  /// them connecting to the update event when there are many of them.
+  void AddToUpdateList(UpdatePhase::Enum phase, DelegateParam update);
+
+  /// Stops updating the component from every update list it was added to.
+  void RemoveFromUpdateLists(Component* component);
+
   //------------------------------------------------------------ Modification
 
   //Any change that needs to be saved marks the space as modified.
@@ -212,6 +222,10 @@ public:
   HandleOf<Level> mPendingLevel;
   // Allows CameraViewports to attach viewport to a space specific GameWidget
   HandleOf<GameWidget> mGameWidgetOverride;
+  // Created by the first AnimationGraph in the space
+  AnimationGraphBatch* mAnimationGraphs;
+  // Components updated without connecting to the update events
+  SpaceUpdateLists mUpdateLists;
 
   // When editing and state change will mark the level as modified.
   bool mModified;
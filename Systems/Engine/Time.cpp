@@ -186,6 +186,7 @@ void TimeSpace::Update(float dt)
 
     {
       ProfileScopeTree("FrameUpdate", "TimeSystem", Color::PaleGoldenrod);
+      space->mUpdateLists.Update(UpdatePhase::Frame, &updateEvent);
       dispatcher->Dispatch(Events::FrameUpdate, &updateEvent);
     }
 
@@ -232,6 +233,7 @@ void TimeSpace::Step()
 
   {
     ProfileScopeTree("LogicUpdate", "TimeSystem", Color::Gainsboro);
+    GetSpace()->mUpdateLists.Update(UpdatePhase::Logic, &updateEvent);
     dispatcher->Dispatch(Events::LogicUpdate, &updateEvent);
   }
 
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file UpdateList.cpp
+/// Implementation of the per space update lists.
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Thread safe update functions are usually small, so each task takes a good
+// amount of components
+const uint cMinComponentUpdatesPerTask = 64;
+
+//------------------------------------------------------------------ Update List
+struct UpdateComponentsTask
+{
+  void operator()(uint start, uint end)
+  {
+    ComponentUpdateFunction function = mList->mFunction;
+    UpdateEvent* event = mList->mEvent;
+    Component** components = mList->mComponents.Data();
+    for(uint i = start; i < end; ++i)
+      function(components[i], event);
+  }
+
+  UpdateList* mList;
+};
+
+//******************************************************************************
+UpdateList::UpdateList(UpdatePhase::Enum phase, ComponentUpdateFunction function,
+                       Function* scriptFunction, bool threadSafe)
+{
+  mPhase = phase;
+  mFunction = function;
+  mScriptFunction = scriptFunction;
+  // Script functions always run on the main thread
+  mThreadSafe = threadSafe && scriptFunction == nullptr;
+  mRemovedCount = 0;
+  mEvent = nullptr;
+}
+
+//******************************************************************************
+void UpdateList::Add(Component* component)
+{
+  if(mIndices.ContainsKey(component))
+    return;
+
+  mIndices.Insert(component, mComponents.Size());
+  mComponents.PushBack(component);
+}
+
+//******************************************************************************
+bool UpdateList::Remove(Component* component)
+{
+  uint* index = mIndices.FindPointer(component);
+  if(index == nullptr)
+    return false;
+
+  // Only clear the slot, the list may be in the middle of updating
+  mComponents[*index] = nullptr;
+  mIndices.Erase(component);
+  ++mRemovedCount;
+  return true;
+}
+
+//******************************************************************************
+void UpdateList::Update(UpdateEvent* event)
+{
+  // Close the gaps left by removed components
+  if(mRemovedCount != 0)
+  {
+    uint count = 0;
+    for(uint i = 0; i < mComponents.Size(); ++i)
+    {
+      Component* component = mComponents[i];
+      if(component == nullptr)
+        continue;
+      mIndices[component] = count;
+      mComponents[count++] = component;
+    }
+    mComponents.Resize(count);
+    mRemovedCount = 0;
+  }
+
+  mEvent = event;
+
+  if(mThreadSafe)
+  {
+    UpdateComponentsTask task;
+    task.mList = this;
+    Z::gJobs->ParallelFor(0, mComponents.Size(), task, cMinComponentUpdatesPerTask);
+  }
+  else
+  {
+    // Components added during the update are first updated next time, and
+    // removed components are skipped since their slot is cleared
+    uint count = mComponents.Size();
+    for(uint i = 0; i < count; ++i)
+    {
+      Component* component = mComponents[i];
+      if(component == nullptr)
+        continue;
+
+      if(mScriptFunction)
+        UpdateScript(component);
+      else
+        mFunction(component, event);
+    }
+  }
+
+  mEvent = nullptr;
+}
+
+//******************************************************************************
+void UpdateList::UpdateScript(Component* component)
+{
+  ExceptionReport report;
+  Call call(mScriptFunction);
+
+  // Same as script event connections, the method may take a less derived event
+  call.DisableParameterChecks();
+
+  call.SetHandle(Call::This, component);
+  call.SetHandle(0, mEvent);
+  call.Invoke(report);
+
+  // Stop updating a component that threw so that it doesn't throw every frame,
+  // the same as a script event connection being disabled
+  if(report.HasThrownExceptions())
+    Remove(component);
+}
+
+//------------------------------------------------------------ Space Update Lists
+//******************************************************************************
+SpaceUpdateLists::SpaceUpdateLists()
+{
+}
+
+//******************************************************************************
+SpaceUpdateLists::~SpaceUpdateLists()
+{
+  DeleteObjectsInContainer(mLists);
+}
+
+//******************************************************************************
+void SpaceUpdateLists::Add(Component* component, UpdatePhase::Enum phase,
+                           ComponentUpdateFunction function, bool threadSafe)
+{
+  UpdateList* list = FindList(phase, function, nullptr);
+  if(list == nullptr)
+  {
+    list = new UpdateList(phase, function, nullptr, threadSafe);
+    mLists.PushBack(list);
+  }
+
+  list->Add(component);
+}
+
+//******************************************************************************
+void SpaceUpdateLists::AddScript(Component* component, UpdatePhase::Enum phase, Function* function)
+{
+  UpdateList* list = FindList(phase, nullptr, function);
+  if(list == nullptr)
+  {
+    list = new UpdateList(phase, nullptr, function, false);
+    mLists.PushBack(list);
+  }
+
+  list->Add(component);
+}
+
+//******************************************************************************
+void SpaceUpdateLists::Remove(Component* component, UpdatePhase::Enum phase,
+                              ComponentUpdateFunction function)
+{
+  if(UpdateList* list = FindList(phase, function, nullptr))
+    list->Remove(component);
+}
+
+//******************************************************************************
+void SpaceUpdateLists::Remove(Component* component)
+{
+  forRange(UpdateList* list, mLists.All())
+    list->Remove(component);
+}
+
+//******************************************************************************
+void SpaceUpdateLists::Update(UpdatePhase::Enum phase, UpdateEvent* event)
+{
+  // Script components are removed when scripts recompile, so drop the empty
+  // lists of script methods that may no longer exist
+  for(uint i = 0; i < mLists.Size();)
+  {
+    UpdateList* list = mLists[i];
+    if(list->mScriptFunction && list->mIndices.Empty())
+    {
+      mLists.EraseAt(i);
+      delete list;
+    }
+    else
+    {
+      ++i;
+    }
+  }
+
+  // Lists created during the update are first updated next time
+  uint count = mLists.Size();
+  for(uint i = 0; i < count; ++i)
+  {
+    UpdateList* list = mLists[i];
+    if(list->mPhase == phase)
+      list->Update(event);
+  }
+}
+
+//******************************************************************************
+UpdateList* SpaceUpdateLists::FindList(UpdatePhase::Enum phase,
+                                       ComponentUpdateFunction function,
+                                       Function* scriptFunction)
+{
+  forRange(UpdateList* list, mLists.All())
+  {
+    if(list->mPhase == phase && list->mFunction == function &&
+       list->mScriptFunction == scriptFunction)
+      return list;
+  }
+  return nullptr;
+}
+
+}//namespace Zero
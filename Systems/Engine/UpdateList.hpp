@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file UpdateList.hpp
+/// Declaration of the per space update lists.
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+class UpdateEvent;
+
+/// Which of the space's updates an update list is called on, Frame is called
+/// with the FrameUpdate event and Logic with the LogicUpdate event.
+DeclareEnum2(UpdatePhase, Frame, Logic);
+
+/// Native update function called on every component in an update list.
+typedef void (*ComponentUpdateFunction)(Component* component, UpdateEvent* event);
+
+/// Calls a member function as a ComponentUpdateFunction.
+template<typename ComponentType, void (ComponentType::*Function)(UpdateEvent*)>
+void CallComponentUpdate(Component* component, UpdateEvent* event)
+{
+  (static_cast<ComponentType*>(component)->*Function)(event);
+}
+
+#define ZeroUpdateFunction(ComponentType, FunctionName) \
+  (&CallComponentUpdate<ComponentType, &ComponentType::FunctionName>)
+
+//------------------------------------------------------------------ Update List
+/// Every component in a space that is updated by the same function (the same
+/// native function or the same script method) on one phase. The components
+/// are kept contiguously and updated in the order they were added.
+class UpdateList
+{
+public:
+  UpdateList(UpdatePhase::Enum phase, ComponentUpdateFunction function,
+             Function* scriptFunction, bool threadSafe);
+
+  void Add(Component* component);
+  bool Remove(Component* component);
+  void Update(UpdateEvent* event);
+
+  UpdatePhase::Enum mPhase;
+  ComponentUpdateFunction mFunction;
+  /// Called instead of the native function for script components.
+  Function* mScriptFunction;
+  /// Thread safe types only touch their own component in the update
+  /// function, so their components are updated across the job workers.
+  bool mThreadSafe;
+
+  /// Removed components leave an empty slot until the next update so that
+  /// the order of the remaining components never changes.
+  Array<Component*> mComponents;
+  HashMap<Component*, uint> mIndices;
+  uint mRemovedCount;
+  UpdateEvent* mEvent;
+
+private:
+  void UpdateScript(Component* component);
+};
+
+//------------------------------------------------------------ Space Update Lists
+/// The update lists of a space. Components that join a list are updated by
+/// the TimeSpace right before the matching update event is dispatched, with
+/// one function call each instead of an EventConnection each. The lists are
+/// updated in the order they were created. Connecting to LogicUpdate and
+/// FrameUpdate still works the same for everything else.
+class SpaceUpdateLists
+{
+public:
+  SpaceUpdateLists();
+  ~SpaceUpdateLists();
+
+  /// Adds a native component, all components added with the same function
+  /// and phase are in the same list.
+  void Add(Component* component, UpdatePhase::Enum phase,
+           ComponentUpdateFunction function, bool threadSafe = false);
+  /// Adds a script component, updated by calling the given method on it.
+  void AddScript(Component* component, UpdatePhase::Enum phase, Function* function);
+
+  /// Removes the component from one list.
+  void Remove(Component* component, UpdatePhase::Enum phase, ComponentUpdateFunction function);
+  /// Removes the component from every list it was added to.
+  void Remove(Component* component);
+
+  /// Updates every list of the phase.
+  void Update(UpdatePhase::Enum phase, UpdateEvent* event);
+
+  Array<UpdateList*> mLists;
+
+private:
+  UpdateList* FindList(UpdatePhase::Enum phase, ComponentUpdateFunction function,
+                       Function* scriptFunction);
+};
+
+}//namespace Zero
@@ -96,8 +96,13 @@ void ZilchManager::InternalCompile()
     }
   }
 
-  // If there are no pending libraries, nothing was compiled
-  ErrorIf(mPendingLibraries.Empty(), "If the mShouldAttemptCompile flag was set, we should always have pending libraries (even at startup with no scripts)!");
+  // If there are no pending libraries, nothing was compiled because every library
+  // that was marked as modified was built from the same code as its current library
+  if(mPendingLibraries.Empty())
+  {
+    mLastCompileResult = CompileResult::CompilationSucceeded;
+    return;
+  }
 
   // Since we binary cache archetypes (in a way that is NOT saving the data tree, but rather a 'known serialization format'
   // then if we moved any properties around in any script it would completely destroy how the archetypes were cached
@@ -36,6 +36,8 @@ ZilchDefineType(Camera, builder, type)
   ZilchBindGetter(WorldTranslation);
   ZilchBindGetter(WorldDirection);
   ZilchBindGetter(WorldUp);
+  ZilchBindGetter(OcclusionCulledCount);
+  ZilchBindGetter(OcclusionVisibleCount);
 
   ZilchBindMethod(GetFrustum);
 }
@@ -59,6 +61,8 @@ void Camera::Initialize(CogInitializer& initializer)
   mDirtyPerspective = true;
   mViewportInterface = nullptr;
   mVisibilityId = (uint)-1;
+  mOcclusionCulledCount = 0;
+  mOcclusionVisibleCount = 0;
   mRenderQueuesDataNeeded = false;
 }
 
@@ -170,6 +174,18 @@ Vec3 Camera::GetWorldUp()
   return Math::Multiply(mTransform->GetWorldRotation(), Vec3::cYAxis);
 }
 
+//**************************************************************************************************
+uint Camera::GetOcclusionCulledCount()
+{
+  return mOcclusionCulledCount;
+}
+
+//**************************************************************************************************
+uint Camera::GetOcclusionVisibleCount()
+{
+  return mOcclusionVisibleCount;
+}
+
 //**************************************************************************************************
 float Camera::GetAspectRatio()
 {
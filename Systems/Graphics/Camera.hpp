@@ -64,6 +64,11 @@ public:
   /// The upright direction of the Camera (perpendicular to facing direction), in world space.
   Vec3 GetWorldUp();
 
+  /// How many Graphicals in the view frustum were hidden by occluders last frame.
+  uint GetOcclusionCulledCount();
+  /// How many Graphicals in the view frustum were not hidden by occluders last frame.
+  uint GetOcclusionVisibleCount();
+
   // Internal
 
   // Set by CameraViewport, not an exposed property.
@@ -95,6 +100,9 @@ public:
   ViewportInterface* mViewportInterface;
   // Used to identify which cameras have visibility of Graphicals.
   uint mVisibilityId;
+  // Set by GraphicsSpace every frame.
+  uint mOcclusionCulledCount;
+  uint mOcclusionVisibleCount;
 
   // Needed by GraphicsSpace to access graphical entries.
   Array<uint> mRenderGroupCounts;
@@ -183,6 +183,12 @@ String Graphical::GetDefaultMaterialName()
   return MaterialManager::GetInstance()->DefaultResourceName;
 }
 
+//**************************************************************************************************
+const Array<Vec3>* Graphical::GetOccluderTriangles()
+{
+  return nullptr;
+}
+
 //**************************************************************************************************
 bool Graphical::GetVisible()
 {
@@ -327,6 +333,7 @@ void Graphical::UpdateBroadPhaseAabb()
     data.mAabb = GetWorldAabb();
 
     mGraphicsSpace->mBroadPhase.UpdateProxy(mProxy, data);
+    mGraphicsSpace->mCullBounds.Update(this, mGraphicsSpace->mBroadPhase.GetFatAabb(mProxy));
   }
 }
 
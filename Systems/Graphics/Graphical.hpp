@@ -66,6 +66,10 @@ public:
   virtual bool TestFrustum(const Frustum& frustum, CastInfo& castInfo);
   virtual void AddToSpace();
   virtual String GetDefaultMaterialName();
+  // Local space triangles (three positions per triangle) that are rasterized to hide other Graphicals
+  // when the GraphicsSpace is occlusion culling, null if this Graphical is not an occluder.
+  // Called before occlusion culling starts, the triangles are only read from the task workers.
+  virtual const Array<Vec3>* GetOccluderTriangles();
 
   // Properties
 
@@ -131,6 +135,8 @@ public:
 
   Link<Graphical> SpaceLink;
   BroadPhaseProxy mProxy;
+  // Index into the GraphicsSpace's flat culling bounds (only valid while in the broad phase)
+  uint mBoundsIndex;
   Transform* mTransform;
   GraphicsSpace* mGraphicsSpace;
 
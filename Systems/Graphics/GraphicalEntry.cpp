@@ -47,6 +47,88 @@ void GraphicalEntry::SetRenderGroupSortValue(s32 sortValue)
   mSort |= (u64)sortValue << 32;
 }
 
+//**************************************************************************************************
+// Below this many entries the sort isn't worth splitting up between task workers
+const uint cMinParallelSortEntries = 16384;
+
+//**************************************************************************************************
+// Spreads the blocks of a radix sort across the task workers
+struct JobSystemParallelFor
+{
+  template <typename RangeFunctor>
+  void operator()(uint begin, uint end, RangeFunctor& functor)
+  {
+    Z::gJobs->ParallelFor(begin, end, functor);
+  }
+};
+
+//**************************************************************************************************
+void GraphicalEntrySorter::Sort(GraphicalEntry* entries, uint count)
+{
+  if (count < 2)
+    return;
+
+  mScratch.Resize(count);
+
+  if (count < cMinParallelSortEntries)
+  {
+    RadixSort(entries, count, mScratch.Data(), GraphicalEntrySortKey());
+    return;
+  }
+
+  JobSystemParallelFor parallelFor;
+  RadixSortBlocks(entries, count, mScratch.Data(), mBlockCounts, GraphicalEntrySortKey(), parallelFor);
+}
+
+//**************************************************************************************************
+void GraphicalEntrySorter::Sort(GraphicalEntryRange entries)
+{
+  Sort(entries.Begin(), entries.Length());
+}
+
+//**************************************************************************************************
+void GraphicalEntrySorter::RunUnitTests()
+{
+  // Enough for several blocks per task worker, with a last block that isn't full
+  const uint count = cMinParallelSortEntries * 2 + 1000;
+
+  // A few RenderGroups with many equal sort values, the data pointer records the original order
+  Array<GraphicalEntry> entries;
+  entries.Resize(count);
+  uint state = count;
+  for (uint i = 0; i < count; ++i)
+  {
+    state = state * 1664525 + 1013904223;
+    u64 group = state % 8;
+    state = state * 1664525 + 1013904223;
+    u64 value = state % 1024;
+    entries[i].mData = (GraphicalEntryData*)(size_t)i;
+    entries[i].mSort = group << 32 | value;
+    entries[i].mRenderGroupId = 0;
+  }
+
+  Array<GraphicalEntry> expected(entries);
+  Timer timer;
+  timer.Reset();
+  Zero::Sort(expected.All());
+  double sortTime = timer.UpdateAndGetTime();
+
+  GraphicalEntrySorter sorter;
+  timer.Reset();
+  sorter.Sort(entries.All());
+  double radixTime = timer.UpdateAndGetTime();
+
+  for (uint i = 0; i < count; ++i)
+  {
+    ErrorIf(entries[i].mSort != expected[i].mSort, "Parallel radix sort does not match the comparison sort");
+    if (i > 0 && entries[i - 1].mSort == entries[i].mSort)
+      ErrorIf(entries[i - 1].mData > entries[i].mData, "Parallel radix sort is not stable");
+  }
+
+  ZPrint("GraphicalEntrySorter %u entries: Sort %.3fms, parallel radix sort %.3fms\n",
+         count, sortTime * 1000.0, radixTime * 1000.0);
+}
+
 //**************************************************************************************************
 ZilchDefineType(GraphicalSortEvent, builder, type)
 {
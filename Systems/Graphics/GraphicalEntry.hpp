@@ -59,6 +59,32 @@ public:
 
 typedef Array<GraphicalEntry>::range GraphicalEntryRange;
 
+// Gives the radix sort the packed sort value of an entry
+// (RenderGroup sort id in the high 32 bits, graphical sort value in the low 32 bits)
+struct GraphicalEntrySortKey
+{
+  u64 operator()(const GraphicalEntry& entry) const { return entry.mSort; }
+};
+
+// Stable radix sort of GraphicalEntries on their full sort value, so that all of a camera's entries
+// end up grouped by RenderGroup and sorted within each group in one sort.
+// Large counts are split into blocks that are counted and scattered on every task worker.
+// The scratch memory is kept so nothing is allocated once it has grown.
+class GraphicalEntrySorter
+{
+public:
+  void Sort(GraphicalEntry* entries, uint count);
+  void Sort(GraphicalEntryRange entries);
+
+  // Sorts enough entries to be split across the task workers, errors if the result doesn't
+  // match a comparison sort and prints how long both took (must be called from the main thread)
+  static void RunUnitTests();
+
+  Array<GraphicalEntry> mScratch;
+  // Counts of every digit for every block, then the scatter offsets of the current pass
+  Array<RadixHistogram> mBlockCounts;
+};
+
 /// Sent for RenderGroups that require custom logic for sort values.
 class GraphicalSortEvent : public Event
 {
@@ -12,6 +12,84 @@ namespace Events
   DefineEvent(UpdateSkeletons);
 }
 
+// Smallest amount of work given to a task worker when culling and making entries
+const uint cMinCullBlocksPerTask = 64;
+const uint cMinEntryGraphicalsPerTask = 64;
+const uint cMinOccludersPerTask = 4;
+
+//**************************************************************************************************
+// Tests blocks of the space's culling bounds against a camera's frustum
+struct FrustumCullTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    VisibilityBuffer& buffer = mSpace->mVisibilityBuffers[Z::gJobs->GetTaskWorkerIndex()];
+    mSpace->mCullBounds.CullFrustum(*mFrustum, blockStart, blockEnd, buffer.mVisible);
+  }
+
+  GraphicsSpace* mSpace;
+  Frustum* mFrustum;
+};
+
+//**************************************************************************************************
+// Makes the entries of the Graphicals that passed the frustum test
+struct VisibleEntryTask
+{
+  void operator()(uint start, uint end)
+  {
+    VisibilityBuffer& buffer = mSpace->mVisibilityBuffers[Z::gJobs->GetTaskWorkerIndex()];
+    for (uint i = start; i < end; ++i)
+    {
+      Graphical* graphical = mSpace->mVisibleCulled[i];
+      if (mOcclusionBuffer != nullptr && mOcclusionBuffer->IsOccluded(graphical->GetWorldAabb()))
+      {
+        ++buffer.mOccludedCount;
+        continue;
+      }
+
+      mSpace->AddToVisibleGraphicals(*graphical, *mCamera, mCameraPos, mCameraDir, buffer, mFrustum);
+    }
+  }
+
+  GraphicsSpace* mSpace;
+  Camera* mCamera;
+  Vec3 mCameraPos;
+  Vec3 mCameraDir;
+  Frustum* mFrustum;
+  // Null when the camera is not occlusion culling
+  OcclusionBuffer* mOcclusionBuffer;
+};
+
+//**************************************************************************************************
+// Clips and sets up the triangles of occluders for rasterizing
+struct OccluderSetupTask
+{
+  void operator()(uint start, uint end)
+  {
+    uint workerIndex = Z::gJobs->GetTaskWorkerIndex();
+    for (uint i = start; i < end; ++i)
+    {
+      Graphical* occluder = mSpace->mOccluders[i];
+      const Array<Vec3>& triangles = *mSpace->mOccluderTriangles[i];
+      mSpace->mOcclusionBuffer.AddOccluder(occluder->mTransform->GetWorldMatrix(), triangles, workerIndex);
+    }
+  }
+
+  GraphicsSpace* mSpace;
+};
+
+//**************************************************************************************************
+// Rasterizes rows of tiles of the occlusion buffer
+struct OcclusionRasterTask
+{
+  void operator()(uint tileRowStart, uint tileRowEnd)
+  {
+    mOcclusionBuffer->RasterizeTileRows(tileRowStart, tileRowEnd);
+  }
+
+  OcclusionBuffer* mOcclusionBuffer;
+};
+
 //**************************************************************************************************
 ZilchDefineType(GraphicsSpace, builder, type)
 {
@@ -23,6 +101,7 @@ ZilchDefineType(GraphicsSpace, builder, type)
   ZeroBindDependency(Space);
 
   ZilchBindFieldProperty(mActive);
+  ZilchBindFieldProperty(mOcclusionCulling);
   ZilchBindFieldProperty(mRandomSeed)->AddAttribute(PropertyAttributes::cInvalidatesObject);
   ZilchBindFieldProperty(mSeed)->ZeroFilterEquality(mRandomSeed, bool, false);
 }
@@ -31,6 +110,7 @@ ZilchDefineType(GraphicsSpace, builder, type)
 void GraphicsSpace::Serialize(Serializer& stream)
 {
   SerializeNameDefault(mActive, true);
+  SerializeNameDefault(mOcclusionCulling, false);
   SerializeNameDefault(mRandomSeed, false);
   SerializeNameDefault(mSeed, 0u);
 }
@@ -82,6 +162,7 @@ void GraphicsSpace::RemoveGraphical(Graphical* graphical)
   GraphicalList::Unlink(graphical);
   if (graphical->mProxy.ToVoidPointer() != nullptr)
   {
+    mCullBounds.Remove(graphical);
     mBroadPhase.RemoveProxy(graphical->mProxy);
     graphical->mProxy = BroadPhaseProxy();
   }
@@ -134,6 +215,7 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
       data.mClientData = &graphical;
       data.mAabb = graphical.GetWorldAabb();
       mBroadPhase.CreateProxy(graphical.mProxy, data);
+      mCullBounds.Add(&graphical, mBroadPhase.GetFatAabb(graphical.mProxy));
     }
   }
 
@@ -145,6 +227,8 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
   uint renderGroupCount = mGraphicsEngine->GetRenderGroupCount();
   ErrorIf(renderGroupCount == 0, "No render groups, core resources must be missing.");
 
+  mVisibilityBuffers.Resize(Z::gJobs->GetTaskWorkerCount());
+
   // for each view object in use
   forRange (Camera& camera, mCameras.All())
   {
@@ -158,19 +242,84 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
     for (uint i = 0; i < camera.mRenderGroupCounts.Size(); ++i)
       camera.mRenderGroupCounts[i] = 0;
 
+    forRange (VisibilityBuffer& buffer, mVisibilityBuffers.All())
+      buffer.Clear(renderGroupCount);
+
     Vec3 cameraPos = camera.mTransform->GetWorldTranslation();
     Mat3 rotation = Math::ToMatrix3(camera.mTransform->GetWorldRotation());
     Vec3 cameraDir = -rotation.BasisZ();
 
-    Frustum frustum = camera.GetFrustum(camera.mViewportInterface->GetAspectRatio());
+    float aspectRatio = camera.mViewportInterface->GetAspectRatio();
+    Frustum frustum = camera.GetFrustum(aspectRatio);
+    bool occlusionCulling = mOcclusionCulling && camera.mPerspectiveMode == PerspectiveMode::Perspective;
+
+    // Visibility culled graphicals, the flat bounds are tested against the frustum on every task worker
+    FrustumCullTask cullTask;
+    cullTask.mSpace = this;
+    cullTask.mFrustum = &frustum;
+    Z::gJobs->ParallelFor(0, mCullBounds.GetBlockCount(), cullTask, cMinCullBlocksPerTask);
+
+    // MidPhaseQuery can fill in the cached world matrix of a Transform, which can't
+    // be done from multiple threads, so every cache must be filled in before making entries
+    mVisibleCulled.Clear();
+    mOccluders.Clear();
+    mOccluderTriangles.Clear();
+    forRange (VisibilityBuffer& buffer, mVisibilityBuffers.All())
+    {
+      forRange (Graphical* graphical, buffer.mVisible.All())
+      {
+        graphical->mTransform->GetWorldMatrix();
+        mVisibleCulled.PushBack(graphical);
 
-    // Visibility culled graphicals
-    forRangeBroadphaseTree (GraphicsBroadPhase, mBroadPhase, Frustum, frustum)
-      AddToVisibleGraphicals(*range.Front(), camera, cameraPos, cameraDir, &frustum);
+        // Occluder triangles are cached by their Graphical the first time they're asked for
+        const Array<Vec3>* triangles = occlusionCulling ? graphical->GetOccluderTriangles() : nullptr;
+        if (triangles != nullptr)
+        {
+          mOccluders.PushBack(graphical);
+          mOccluderTriangles.PushBack(triangles);
+        }
+      }
+    }
+
+    // Every occluder is rasterized before anything is tested against the occlusion buffer
+    OcclusionBuffer* occlusionBuffer = nullptr;
+    if (mOccluders.Empty() == false)
+    {
+      Mat4 viewToPerspective;
+      BuildPerspectiveTransformZero(viewToPerspective, Math::DegToRad(camera.mFieldOfView), aspectRatio, camera.mNearPlane, camera.mFarPlane);
+      mOcclusionBuffer.Clear(viewToPerspective * camera.GetViewTransform(), camera.mNearPlane, mVisibilityBuffers.Size());
+
+      OccluderSetupTask setupTask;
+      setupTask.mSpace = this;
+      Z::gJobs->ParallelFor(0, mOccluders.Size(), setupTask, cMinOccludersPerTask);
+
+      if (mOcclusionBuffer.GetTriangleCount() != 0)
+      {
+        OcclusionRasterTask rasterTask;
+        rasterTask.mOcclusionBuffer = &mOcclusionBuffer;
+        Z::gJobs->ParallelFor(0, cOcclusionTilesY, rasterTask);
+        occlusionBuffer = &mOcclusionBuffer;
+      }
+    }
+
+    VisibleEntryTask entryTask;
+    entryTask.mSpace = this;
+    entryTask.mCamera = &camera;
+    entryTask.mCameraPos = cameraPos;
+    entryTask.mCameraDir = cameraDir;
+    entryTask.mFrustum = &frustum;
+    entryTask.mOcclusionBuffer = occlusionBuffer;
+    Z::gJobs->ParallelFor(0, mVisibleCulled.Size(), entryTask, cMinEntryGraphicalsPerTask);
+
+    camera.mOcclusionCulledCount = 0;
+    forRange (VisibilityBuffer& buffer, mVisibilityBuffers.All())
+      camera.mOcclusionCulledCount += buffer.mOccludedCount;
+    camera.mOcclusionVisibleCount = mVisibleCulled.Size() - camera.mOcclusionCulledCount;
 
     // Not culled
+    VisibilityBuffer& mainBuffer = mVisibilityBuffers[Z::gJobs->GetTaskWorkerIndex()];
     forRange (Graphical& graphical, mGraphicalsNeverCulled.All())
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir, mainBuffer);
 
     // Get DebugGraphical entries, not broadphased
     // DebugGraphicals exist for one frame and are not placed in broadphase
@@ -180,23 +329,27 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
       if (debugGraphical->mDebugObjects.Size() == 0)
         continue;
 
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir, mainBuffer);
+    }
+
+    // Merge the entries of every worker, the RenderGroup sort id is the high part of every sort value,
+    // so one sort of the camera's range leaves all entries organized by RenderGroup and sorted within it
+    // If a custom sort is enabled, it can then be re-sorted within that RenderGroup
+    forRange (VisibilityBuffer& buffer, mVisibilityBuffers.All())
+    {
+      mVisibleGraphicals.Append(buffer.mEntries.All());
+      for (uint i = 0; i < renderGroupCount; ++i)
+        camera.mRenderGroupCounts[i] += buffer.mGroupCounts[i];
     }
 
+    mEntrySorter.Sort(mVisibleGraphicals.SubRange(lastIndex, mVisibleGraphicals.Size() - lastIndex));
+
     uint index = mVisibleGraphicals.Size();
     IndexRange indexRange(lastIndex, index);
     lastIndex = index;
 
-    uint start = indexRange.start;
-    uint size = indexRange.end - indexRange.start;
-
     camera.mGraphicalIndexRanges.PushBack(indexRange);
 
-    // Sort entries of this camera
-    // This sort will have all entries correctly organized by RenderGroup
-    // If a custom sort is enabled, it can then be re-sorted within that RenderGroup
-    Sort(mVisibleGraphicals.SubRange(start, size));
-
     // Check for any RenderGroup with a custom sort and find its range of elements
     for (uint i = 0, rangeStart = 0; i < camera.mRenderGroupCounts.Size(); ++i)
     {
@@ -209,7 +362,7 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
         sortEvent.mGraphicalEntries = mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart);
         sortEvent.mRenderGroup = renderGroup;
         camera.mViewportInterface->SendSortEvent(&sortEvent);
-        Sort(mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart));
+        mEntrySorter.Sort(sortEvent.mGraphicalEntries);
       }
 
       rangeStart = rangeEnd;
@@ -370,6 +523,9 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
     node.Extract(frameBlock);
   }
 
+  // fill the skinning matrices reserved by the extracted SkinnedModels
+  mSkeletonPoses.Evaluate(renderQueues.mSkinningBuffer);
+
   // only process view blocks from this graphics space
   for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
   {
@@ -392,7 +548,7 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
 }
 
 //**************************************************************************************************
-void GraphicsSpace::AddToVisibleGraphicals(Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum)
+void GraphicsSpace::AddToVisibleGraphicals(Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, VisibilityBuffer& buffer, Frustum* frustum)
 {
   if (GetOwner()->IsEditorMode() && graphical.GetOwner()->GetEditorViewportHidden())
     return;
@@ -402,7 +558,9 @@ void GraphicsSpace::AddToVisibleGraphicals(Graphical& graphical, Camera& camera,
 
   graphical.mVisibleFlags.SetFlag(camera.mVisibilityId);
 
-  Array<GraphicalEntry> entries;
+  // Called from multiple task workers, everything written must belong to this graphical or the worker's buffer
+  Array<GraphicalEntry>& entries = buffer.mQueryEntries;
+  entries.Clear();
   graphical.MidPhaseQuery(entries, camera, frustum);
   forRange (GraphicalEntry& entry, entries.All())
   {
@@ -427,9 +585,9 @@ void GraphicsSpace::AddToVisibleGraphicals(Graphical& graphical, Camera& camera,
         entry.SetGraphicalSortValue(graphicalSortValue);
 
         // Materials will not refer to RenderGroups that have not been given an id.
-        mVisibleGraphicals.PushBack(entry);
-        // Add to RenderGroup counters so they can be accessed by index later.
-        ++camera.mRenderGroupCounts[renderGroup->mSortId];
+        // Entries are counted per RenderGroup so their ranges are known once they are sorted.
+        buffer.mEntries.PushBack(entry);
+        ++buffer.mGroupCounts[renderGroup->mSortId];
 
         renderGroup = renderGroup->GetParentRenderGroup();
 
@@ -54,7 +54,7 @@ public:
   void RenderTasksUpdate(RenderTasks& renderTasks);
   void RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& renderQueues);
 
-  void AddToVisibleGraphicals(Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum = nullptr);
+  void AddToVisibleGraphicals(Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, VisibilityBuffer& buffer, Frustum* frustum = nullptr);
   void CreateDebugGraphicals();
 
   Link<GraphicsSpace> EngineLink;
@@ -73,6 +73,10 @@ public:
   /// If graphics for this Space should be running.
   bool mActive;
 
+  /// If Graphicals completely hidden behind occluders (such as Models marked as occluders) should not be drawn.
+  /// Occluders are rasterized on the cpu for every perspective Camera.
+  bool mOcclusionCulling;
+
   // Using only 8 graphicals currently to handle wireframe/fill/thick-line/text and on-top flag
   // Will need to be more generic when custom materials can be added to debug objects
   DebugGraphical* mDebugDrawGraphicals[8];
@@ -89,6 +93,21 @@ public:
   void SendVisibilityEvents();
 
   GraphicsBroadPhase mBroadPhase;
+  // Flat copy of the broad phase's bounds that is frustum culled in parallel
+  GraphicalBoundsArray mCullBounds;
+  // One buffer per task worker
+  Array<VisibilityBuffer> mVisibilityBuffers;
+  // All culled Graphicals that passed the frustum test for the current camera
+  Array<Graphical*> mVisibleCulled;
+  // Occluders that passed the frustum test for the current camera
+  Array<Graphical*> mOccluders;
+  // Local triangles of each occluder
+  Array<const Array<Vec3>*> mOccluderTriangles;
+  OcclusionBuffer mOcclusionBuffer;
+  // Sorts each camera's entries into RenderGroup order
+  GraphicalEntrySorter mEntrySorter;
+  // Skeletons used by the SkinnedModels extracted this frame
+  SkeletonPoseBatch mSkeletonPoses;
 
   Array<GraphicalEntry> mVisibleGraphicals;
 
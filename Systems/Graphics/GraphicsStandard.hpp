@@ -71,6 +71,8 @@ public:
 
 // Base Graphicals
 #include "Graphical.hpp"
+#include "VisibilityCulling.hpp"
+#include "OcclusionCulling.hpp"
 #include "ParticleSystem.hpp"
 #include "ParticleAnimators.hpp"
 
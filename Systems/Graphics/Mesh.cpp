@@ -544,6 +544,7 @@ Mesh::Mesh()
 {
   mRenderData = nullptr;
   mPrimitiveType = PrimitiveType::Triangles;
+  mOccluderTrianglesValid = false;
 }
 
 //**************************************************************************************************
@@ -554,6 +555,8 @@ void Mesh::Unload()
   mVertices.ClearAttributes();
   mVertices.ClearData();
   mIndices.Clear();
+  mOccluderTriangles.Deallocate();
+  mOccluderTrianglesValid = false;
 }
 
 //**************************************************************************************************
@@ -597,6 +600,9 @@ void Mesh::UploadInternal(bool updateAabb, bool updateTree)
       BuildAabbAndTree<false>();
   }
 
+  mOccluderTriangles.Deallocate();
+  mOccluderTrianglesValid = false;
+
   Z::gEngine->has(GraphicsEngine)->AddMesh(this);
 
   SendModified();
@@ -797,6 +803,33 @@ bool Mesh::TestFrustum(const Frustum& frustum)
   return false;
 }
 
+//**************************************************************************************************
+const Array<Vec3>& Mesh::GetOccluderTriangles()
+{
+  if (mOccluderTrianglesValid)
+    return mOccluderTriangles;
+
+  mOccluderTriangles.Clear();
+  if (mPrimitiveType == PrimitiveType::Triangles)
+  {
+    uint primitiveCount = GetPrimitiveCount();
+    mOccluderTriangles.Reserve(primitiveCount * 3);
+    for (uint i = 0; i < primitiveCount; ++i)
+    {
+      Vec3 points[3];
+      if (GetPrimitiveData(i, VertexSemantic::Position, VertexElementType::Real, 3, points) == false)
+        continue;
+
+      mOccluderTriangles.PushBack(points[0]);
+      mOccluderTriangles.PushBack(points[1]);
+      mOccluderTriangles.PushBack(points[2]);
+    }
+  }
+
+  mOccluderTrianglesValid = true;
+  return mOccluderTriangles;
+}
+
 //**************************************************************************************************
 uint GetIndexSize(IndexElementType::Enum indexType)
 {
@@ -219,6 +219,9 @@ public:
   void BuildAabbAndTree();
   bool TestRay(GraphicsRayCast& raycast, Mat4 worldTransform);
   bool TestFrustum(const Frustum& frustum);
+  // Local space positions of every triangle (three per triangle) for occlusion culling.
+  // Built the first time they're asked for and kept until the mesh is uploaded or unloaded.
+  const Array<Vec3>& GetOccluderTriangles();
 
   template <typename T>
   bool GetPrimitiveData(uint primitiveIndex, VertexSemantic::Enum semantic, VertexElementType::Enum type, uint count, T* data);
@@ -229,6 +232,8 @@ public:
   Mat4 mBindOffsetInv;
   Array<MeshBone> mBones;
   AvlDynamicAabbTree<uint> mTree;
+  Array<Vec3> mOccluderTriangles;
+  bool mOccluderTrianglesValid;
 };
 
 //**************************************************************************************************
@@ -15,6 +15,7 @@ ZilchDefineType(Model, builder, type)
   ZeroBindSetup(SetupMode::DefaultSerialization);
 
   ZilchBindGetterSetterProperty(Mesh);
+  ZilchBindFieldProperty(mOccluder);
 }
 
 //**************************************************************************************************
@@ -29,6 +30,7 @@ void Model::Serialize(Serializer& stream)
 {
   Graphical::Serialize(stream);
   SerializeResourceName(mMesh, MeshManager);
+  SerializeNameDefault(mOccluder, false);
 }
 
 //**************************************************************************************************
@@ -82,6 +84,17 @@ bool Model::TestFrustum(const Frustum& frustum, CastInfo& castInfo)
   return mMesh->TestFrustum(localFrustum);
 }
 
+//**************************************************************************************************
+const Array<Vec3>* Model::GetOccluderTriangles()
+{
+  Mesh* mesh = mMesh;
+  if (mOccluder == false || mesh->mPrimitiveType != PrimitiveType::Triangles)
+    return nullptr;
+
+  // Cached on the mesh so it's only read once per upload for every Model using it
+  return &mesh->GetOccluderTriangles();
+}
+
 //**************************************************************************************************
 Mesh* Model::GetMesh()
 {
@@ -24,12 +24,17 @@ public:
   void ExtractViewData(ViewNode& viewNode, ViewBlock& viewBlock, FrameBlock& frameBlock) override;
   bool TestRay(GraphicsRayCast& rayCast, CastInfo& castInfo) override;
   bool TestFrustum(const Frustum& frustum, CastInfo& castInfo) override;
+  const Array<Vec3>* GetOccluderTriangles() override;
 
   /// Mesh that the graphical will render.
   Mesh* GetMesh();
   void SetMesh(Mesh* newMesh);
   HandleOf<Mesh> mMesh;
 
+  /// If the mesh hides the Graphicals behind it when the GraphicsSpace is occlusion culling.
+  /// Meant for simple meshes like walls and floors, every triangle is rasterized for each camera.
+  bool mOccluder;
+
   // Internal
 
   void OnMeshModified(ResourceEvent* event);
@@ -0,0 +1,351 @@
+// Copyright 2017, DigiPen Institute of Technology
+
+#include "Precompiled.hpp"
+
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+
+namespace Zero
+{
+
+using Math::Simd::SimVec;
+namespace Simd = Math::Simd;
+
+//**************************************************************************************************
+void OcclusionBuffer::Clear(Mat4Param worldToClip, float nearPlane, uint workerCount)
+{
+  mWorldToClip = worldToClip;
+  mNearPlane = nearPlane;
+
+  // Pixels are cleared as each row of tiles is rasterized
+  mDepth.Resize(cOcclusionBufferWidth * cOcclusionBufferHeight);
+  mTileDepth.Resize(cOcclusionTilesX * cOcclusionTilesY);
+
+  mWorkerTriangles.Resize(workerCount);
+  forRange (Array<OccluderTriangle>& triangles, mWorkerTriangles.All())
+    triangles.Clear();
+}
+
+//**************************************************************************************************
+void OcclusionBuffer::AddOccluder(Mat4Param localToWorld, const Array<Vec3>& triangles, uint workerIndex)
+{
+  Mat4 localToClip = mWorldToClip * localToWorld;
+  Array<OccluderTriangle>& setupTriangles = mWorkerTriangles[workerIndex];
+
+  for (uint i = 0; i + 2 < triangles.Size(); i += 3)
+  {
+    Vec4 clip[3];
+    uint behindCount = 0;
+    for (uint j = 0; j < 3; ++j)
+    {
+      Vec3 position = triangles[i + j];
+      clip[j] = Math::Transform(localToClip, Vec4(position.x, position.y, position.z, 1.0f));
+      if (clip[j].w < mNearPlane)
+        ++behindCount;
+    }
+
+    if (behindCount == 3)
+      continue;
+
+    if (behindCount == 0)
+    {
+      AddClipTriangle(clip[0], clip[1], clip[2], setupTriangles);
+      continue;
+    }
+
+    // Clip against the near plane, leaves a triangle or a quad
+    Vec4 polygon[4];
+    uint pointCount = 0;
+    for (uint j = 0; j < 3; ++j)
+    {
+      const Vec4& a = clip[j];
+      const Vec4& b = clip[(j + 1) % 3];
+      float distanceA = a.w - mNearPlane;
+      float distanceB = b.w - mNearPlane;
+
+      if (distanceA >= 0.0f)
+        polygon[pointCount++] = a;
+      if ((distanceA >= 0.0f) != (distanceB >= 0.0f))
+        polygon[pointCount++] = a + (b - a) * (distanceA / (distanceA - distanceB));
+    }
+
+    for (uint j = 1; j + 1 < pointCount; ++j)
+      AddClipTriangle(polygon[0], polygon[j], polygon[j + 1], setupTriangles);
+  }
+}
+
+//**************************************************************************************************
+uint OcclusionBuffer::GetTriangleCount()
+{
+  uint count = 0;
+  forRange (Array<OccluderTriangle>& triangles, mWorkerTriangles.All())
+    count += triangles.Size();
+  return count;
+}
+
+//**************************************************************************************************
+void OcclusionBuffer::RasterizeTileRows(uint tileRowStart, uint tileRowEnd)
+{
+  for (uint tileRow = tileRowStart; tileRow < tileRowEnd; ++tileRow)
+  {
+    int rowStart = tileRow * cOcclusionTileSize;
+    int rowEnd = rowStart + cOcclusionTileSize;
+
+    float* rows = &mDepth[rowStart * cOcclusionBufferWidth];
+    memset(rows, 0, cOcclusionTileSize * cOcclusionBufferWidth * sizeof(float));
+
+    forRange (Array<OccluderTriangle>& triangles, mWorkerTriangles.All())
+    {
+      forRange (OccluderTriangle& triangle, triangles.All())
+      {
+        if (triangle.mMaxY >= rowStart && triangle.mMinY < rowEnd)
+          RasterizeTriangle(triangle, rowStart, rowEnd);
+      }
+    }
+
+    // Furthest depth of each tile, if something is behind that it's behind the whole tile
+    for (uint tileX = 0; tileX < cOcclusionTilesX; ++tileX)
+    {
+      SimVec furthest = Simd::Set(Math::PositiveMax());
+      for (uint y = 0; y < cOcclusionTileSize; ++y)
+      {
+        float* pixels = rows + y * cOcclusionBufferWidth + tileX * cOcclusionTileSize;
+        for (uint x = 0; x < cOcclusionTileSize; x += 4)
+          furthest = Simd::Min(furthest, Simd::UnAlignedLoad(pixels + x));
+      }
+
+      float lanes[4];
+      Simd::UnAlignedStore(furthest, lanes);
+      float tileDepth = Math::Min(Math::Min(lanes[0], lanes[1]), Math::Min(lanes[2], lanes[3]));
+      mTileDepth[tileRow * cOcclusionTilesX + tileX] = tileDepth;
+    }
+  }
+}
+
+//**************************************************************************************************
+bool OcclusionBuffer::IsOccluded(const Aabb& aabb)
+{
+  float minX = Math::PositiveMax();
+  float minY = Math::PositiveMax();
+  float maxX = -Math::PositiveMax();
+  float maxY = -Math::PositiveMax();
+  float closestDepth = 0.0f;
+
+  for (uint i = 0; i < 8; ++i)
+  {
+    Vec4 corner;
+    corner.x = (i & 1) ? aabb.mMax.x : aabb.mMin.x;
+    corner.y = (i & 2) ? aabb.mMax.y : aabb.mMin.y;
+    corner.z = (i & 4) ? aabb.mMax.z : aabb.mMin.z;
+    corner.w = 1.0f;
+
+    Vec4 clip = Math::Transform(mWorldToClip, corner);
+    // Bounds that cross the near plane are right in front of the camera
+    if (clip.w < mNearPlane)
+      return false;
+
+    float depth = 1.0f / clip.w;
+    float x = (clip.x * depth * 0.5f + 0.5f) * cOcclusionBufferWidth;
+    float y = (clip.y * depth * 0.5f + 0.5f) * cOcclusionBufferHeight;
+    minX = Math::Min(minX, x);
+    minY = Math::Min(minY, y);
+    maxX = Math::Max(maxX, x);
+    maxY = Math::Max(maxY, y);
+    closestDepth = Math::Max(closestDepth, depth);
+  }
+
+  // Nothing was rasterized outside of the buffer
+  if (maxX < 0.0f || maxY < 0.0f || minX >= cOcclusionBufferWidth || minY >= cOcclusionBufferHeight)
+    return false;
+
+  int pixelMinX = (int)Math::Clamp(minX, 0.0f, float(cOcclusionBufferWidth - 1));
+  int pixelMinY = (int)Math::Clamp(minY, 0.0f, float(cOcclusionBufferHeight - 1));
+  int pixelMaxX = (int)Math::Clamp(maxX, 0.0f, float(cOcclusionBufferWidth - 1));
+  int pixelMaxY = (int)Math::Clamp(maxY, 0.0f, float(cOcclusionBufferHeight - 1));
+
+  for (int tileY = pixelMinY / cOcclusionTileSize; tileY <= pixelMaxY / (int)cOcclusionTileSize; ++tileY)
+  {
+    for (int tileX = pixelMinX / cOcclusionTileSize; tileX <= pixelMaxX / (int)cOcclusionTileSize; ++tileX)
+    {
+      // The whole tile is in front of the bounds
+      if (mTileDepth[tileY * cOcclusionTilesX + tileX] > closestDepth)
+        continue;
+
+      // Otherwise only the pixels that the bounds cover have to be in front
+      int startX = Math::Max(pixelMinX, tileX * (int)cOcclusionTileSize);
+      int startY = Math::Max(pixelMinY, tileY * (int)cOcclusionTileSize);
+      int endX = Math::Min(pixelMaxX, tileX * (int)cOcclusionTileSize + (int)cOcclusionTileSize - 1);
+      int endY = Math::Min(pixelMaxY, tileY * (int)cOcclusionTileSize + (int)cOcclusionTileSize - 1);
+      for (int y = startY; y <= endY; ++y)
+      {
+        for (int x = startX; x <= endX; ++x)
+        {
+          if (mDepth[y * cOcclusionBufferWidth + x] <= closestDepth)
+            return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+//**************************************************************************************************
+void OcclusionBuffer::AddClipTriangle(const Vec4& p0, const Vec4& p1, const Vec4& p2, Array<OccluderTriangle>& triangles)
+{
+  const Vec4* points[3] = {&p0, &p1, &p2};
+  float x[3], y[3], depth[3];
+  for (uint i = 0; i < 3; ++i)
+  {
+    depth[i] = 1.0f / points[i]->w;
+    x[i] = (points[i]->x * depth[i] * 0.5f + 0.5f) * cOcclusionBufferWidth;
+    y[i] = (points[i]->y * depth[i] * 0.5f + 0.5f) * cOcclusionBufferHeight;
+  }
+
+  float minX = Math::Min(x[0], Math::Min(x[1], x[2]));
+  float minY = Math::Min(y[0], Math::Min(y[1], y[2]));
+  float maxX = Math::Max(x[0], Math::Max(x[1], x[2]));
+  float maxY = Math::Max(y[0], Math::Max(y[1], y[2]));
+  if (maxX < 0.0f || maxY < 0.0f || minX >= cOcclusionBufferWidth || minY >= cOcclusionBufferHeight)
+    return;
+
+  // Setup is done in double and relative to the triangle's first pixel, triangles clipped by the
+  // near plane can project far outside of the buffer and lose all precision in the edge constants
+  double area = ((double)x[1] - x[0]) * ((double)y[2] - y[0]) - ((double)x[2] - x[0]) * ((double)y[1] - y[0]);
+  if (Math::Abs(area) < 0.0001)
+    return;
+
+  // Always wind counter clockwise so the inside of every edge is positive
+  if (area < 0.0)
+  {
+    Math::Swap(x[1], x[2]);
+    Math::Swap(y[1], y[2]);
+    Math::Swap(depth[1], depth[2]);
+    area = -area;
+  }
+
+  OccluderTriangle& triangle = triangles.PushBack();
+  triangle.mMinX = (int)Math::Clamp(minX, 0.0f, float(cOcclusionBufferWidth - 1)) & ~3;
+  triangle.mMinY = (int)Math::Clamp(minY, 0.0f, float(cOcclusionBufferHeight - 1));
+  triangle.mMaxX = (int)Math::Clamp(maxX, 0.0f, float(cOcclusionBufferWidth - 1));
+  triangle.mMaxY = (int)Math::Clamp(maxY, 0.0f, float(cOcclusionBufferHeight - 1));
+
+  double originX = triangle.mMinX;
+  double originY = triangle.mMinY;
+  for (uint i = 0; i < 3; ++i)
+  {
+    uint next = (i + 1) % 3;
+    double a = (double)y[i] - y[next];
+    double b = (double)x[next] - x[i];
+    double c = (double)x[i] * y[next] - (double)x[next] * y[i];
+    triangle.mEdgeA[i] = (float)a;
+    triangle.mEdgeB[i] = (float)b;
+    triangle.mEdgeC[i] = (float)(a * originX + b * originY + c);
+  }
+
+  double depthA = (((double)depth[1] - depth[0]) * ((double)y[2] - y[0]) - ((double)depth[2] - depth[0]) * ((double)y[1] - y[0])) / area;
+  double depthB = (((double)x[1] - x[0]) * ((double)depth[2] - depth[0]) - ((double)x[2] - x[0]) * ((double)depth[1] - depth[0])) / area;
+  double depthC = depth[0] - depthA * x[0] - depthB * y[0];
+  triangle.mDepthA = (float)depthA;
+  triangle.mDepthB = (float)depthB;
+  triangle.mDepthC = (float)(depthA * originX + depthB * originY + depthC);
+}
+
+//**************************************************************************************************
+void OcclusionBuffer::RasterizeTriangle(const OccluderTriangle& triangle, int rowStart, int rowEnd)
+{
+  int yStart = Math::Max(triangle.mMinY, rowStart);
+  int yEnd = Math::Min(triangle.mMaxY, rowEnd - 1);
+
+  // Samples are at pixel centers, four pixels of a row at a time
+  SimVec pixelOffsets = Simd::Set4(0.5f, 1.5f, 2.5f, 3.5f);
+  SimVec zero = Simd::ZeroOutVec();
+  SimVec edgeA0 = Simd::Set(triangle.mEdgeA[0]);
+  SimVec edgeA1 = Simd::Set(triangle.mEdgeA[1]);
+  SimVec edgeA2 = Simd::Set(triangle.mEdgeA[2]);
+  SimVec depthA = Simd::Set(triangle.mDepthA);
+
+  for (int y = yStart; y <= yEnd; ++y)
+  {
+    float localY = float(y - triangle.mMinY) + 0.5f;
+    SimVec rowEdge0 = Simd::Set(triangle.mEdgeB[0] * localY + triangle.mEdgeC[0]);
+    SimVec rowEdge1 = Simd::Set(triangle.mEdgeB[1] * localY + triangle.mEdgeC[1]);
+    SimVec rowEdge2 = Simd::Set(triangle.mEdgeB[2] * localY + triangle.mEdgeC[2]);
+    SimVec rowDepth = Simd::Set(triangle.mDepthB * localY + triangle.mDepthC);
+
+    float* depthRow = &mDepth[y * cOcclusionBufferWidth];
+    for (int x = triangle.mMinX; x <= triangle.mMaxX; x += 4)
+    {
+      SimVec localX = Simd::Add(Simd::Set(float(x - triangle.mMinX)), pixelOffsets);
+      SimVec edge0 = Simd::MultiplyAdd(localX, edgeA0, rowEdge0);
+      SimVec edge1 = Simd::MultiplyAdd(localX, edgeA1, rowEdge1);
+      SimVec edge2 = Simd::MultiplyAdd(localX, edgeA2, rowEdge2);
+      SimVec inside = Simd::AndVec(Simd::GreaterEqual(edge0, zero), Simd::GreaterEqual(edge1, zero));
+      inside = Simd::AndVec(inside, Simd::GreaterEqual(edge2, zero));
+      if (_mm_movemask_ps(inside) == 0)
+        continue;
+
+      // Keep the closest depth of every covered pixel
+      SimVec depth = Simd::MultiplyAdd(localX, depthA, rowDepth);
+      SimVec current = Simd::UnAlignedLoad(depthRow + x);
+      Simd::UnAlignedStore(Simd::Select(current, Simd::Max(current, depth), inside), depthRow + x);
+    }
+  }
+}
+
+//**************************************************************************************************
+void AddOccluderQuad(Array<Vec3>& triangles, Vec3Param p0, Vec3Param p1, Vec3Param p2, Vec3Param p3)
+{
+  triangles.PushBack(p0);
+  triangles.PushBack(p1);
+  triangles.PushBack(p2);
+  triangles.PushBack(p0);
+  triangles.PushBack(p2);
+  triangles.PushBack(p3);
+}
+
+//**************************************************************************************************
+void OcclusionBuffer::RunUnitTests()
+{
+  // Camera at the origin looking down -z, the aspect ratio matches the buffer
+  Mat4 worldToClip;
+  BuildPerspectiveTransformZero(worldToClip, Math::DegToRad(90.0f), 2.0f, 0.1f, 100.0f);
+
+  OcclusionBuffer buffer;
+  buffer.Clear(worldToClip, 0.1f, 1);
+  buffer.RasterizeTileRows(0, cOcclusionTilesY);
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, 0, -20), Vec3(1))), "Nothing should be occluded by an empty buffer");
+
+  // A small wall straight ahead
+  Array<Vec3> wall;
+  AddOccluderQuad(wall, Vec3(-2, -2, -10), Vec3(2, -2, -10), Vec3(2, 2, -10), Vec3(-2, 2, -10));
+  buffer.Clear(worldToClip, 0.1f, 1);
+  buffer.AddOccluder(Mat4::cIdentity, wall, 0);
+  ErrorIf(buffer.GetTriangleCount() != 2, "The wall should not have been clipped");
+  buffer.RasterizeTileRows(0, cOcclusionTilesY);
+
+  ErrorIf(!buffer.IsOccluded(Aabb(Vec3(0, 0, -20), Vec3(1))), "Bounds completely behind the wall should be occluded");
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(4, 0, -20), Vec3(1))), "Bounds partially visible past the wall should not be occluded");
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, 0, -5), Vec3(0.5f))), "Bounds in front of the wall should not be occluded");
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, 0, 0), Vec3(1))), "Bounds crossing the near plane should not be occluded");
+
+  // Moving the wall with its transform
+  buffer.Clear(worldToClip, 0.1f, 1);
+  buffer.AddOccluder(Mat4::GenerateTranslation(Vec3(20, 0, 0)), wall, 0);
+  buffer.RasterizeTileRows(0, cOcclusionTilesY);
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, 0, -20), Vec3(1))), "The wall was not moved by its transform");
+
+  // A floor that goes behind the camera has to be clipped against the near plane
+  Array<Vec3> floor;
+  AddOccluderQuad(floor, Vec3(-100, -1, 10), Vec3(100, -1, 10), Vec3(100, -1, -100), Vec3(-100, -1, -100));
+  buffer.Clear(worldToClip, 0.1f, 1);
+  buffer.AddOccluder(Mat4::cIdentity, floor, 0);
+  ErrorIf(buffer.GetTriangleCount() == 0, "The clipped floor should have been kept");
+  buffer.RasterizeTileRows(0, cOcclusionTilesY);
+
+  ErrorIf(!buffer.IsOccluded(Aabb(Vec3(0, -5, -20), Vec3(1))), "Bounds below the floor should be occluded");
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, 3, -20), Vec3(1))), "Bounds above the floor should not be occluded");
+  ErrorIf(buffer.IsOccluded(Aabb(Vec3(0, -1, -0.5f), Vec3(1))), "Bounds crossing the near plane should not be occluded");
+}
+
+} // namespace Zero
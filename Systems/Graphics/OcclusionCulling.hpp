@@ -0,0 +1,73 @@
+// Copyright 2017, DigiPen Institute of Technology
+
+#pragma once
+
+namespace Zero
+{
+
+// Resolution of the software depth buffer, the width must be a multiple of 4 for the simd rasterizer
+const uint cOcclusionBufferWidth = 256;
+const uint cOcclusionBufferHeight = 128;
+// Pixels per side of a tile in the hierarchical depth, a row of tiles is the unit of work for rasterizing
+const uint cOcclusionTileSize = 8;
+const uint cOcclusionTilesX = cOcclusionBufferWidth / cOcclusionTileSize;
+const uint cOcclusionTilesY = cOcclusionBufferHeight / cOcclusionTileSize;
+
+//**************************************************************************************************
+// Screen space triangle set up for rasterizing. Edge functions are positive inside the triangle
+// and depth is the inverse of clip w, which is linear in screen space (larger is closer).
+class OccluderTriangle
+{
+public:
+  float mEdgeA[3];
+  float mEdgeB[3];
+  float mEdgeC[3];
+  float mDepthA;
+  float mDepthB;
+  float mDepthC;
+  // Pixel bounds, min x is aligned to 4 pixels
+  int mMinX, mMaxX;
+  int mMinY, mMaxY;
+};
+
+//**************************************************************************************************
+// Low resolution depth buffer that occluder meshes are rasterized into on the cpu so that
+// Graphicals completely hidden behind them can be skipped before any of their entries are made.
+// Only perspective cameras are supported since the depth stored is the inverse of view depth.
+// Occluders are transformed on any task worker into that worker's own triangle list,
+// then every row of tiles is rasterized independently so no two tasks ever write the same pixels.
+class OcclusionBuffer
+{
+public:
+  // Starts a new camera, nothing is occluded until triangles are added and rasterized
+  void Clear(Mat4Param worldToClip, float nearPlane, uint workerCount);
+
+  // Clips and sets up the triangles of an occluder (three local space positions per triangle)
+  void AddOccluder(Mat4Param localToWorld, const Array<Vec3>& triangles, uint workerIndex);
+  uint GetTriangleCount();
+
+  // Rasterizes every triangle that touches the given rows of tiles and builds their tile depths
+  void RasterizeTileRows(uint tileRowStart, uint tileRowEnd);
+
+  // If the bounds are completely behind the rasterized occluders
+  bool IsOccluded(const Aabb& aabb);
+
+  // Rasterizes a few simple scenes and errors if any bounds are culled incorrectly
+  static void RunUnitTests();
+
+  Mat4 mWorldToClip;
+  float mNearPlane;
+
+  // Inverse depth of every pixel, zero where nothing was rasterized
+  Array<float> mDepth;
+  // Furthest (smallest) inverse depth of every tile
+  Array<float> mTileDepth;
+  // Triangles set up by each task worker
+  Array< Array<OccluderTriangle> > mWorkerTriangles;
+
+private:
+  void AddClipTriangle(const Vec4& p0, const Vec4& p1, const Vec4& p2, Array<OccluderTriangle>& triangles);
+  void RasterizeTriangle(const OccluderTriangle& triangle, int rowStart, int rowEnd);
+};
+
+} // namespace Zero
@@ -17,84 +17,215 @@ namespace Tags
   DefineTag(Particle);
 }
 
-//////////Helper functions///////////////
-void PushFront(Particle*& front, Particle* particle)
+//--------------------------------------------------------------------- Particle
+ZilchDefineType(Particle, builder, type)
 {
-  particle->Next = front;
-  front = particle;
+  ZilchBindDestructor();
+  ZilchBindDefaultConstructor();
+  ZilchBindGetterSetterProperty(Time);
+  ZilchBindGetterSetterProperty(Lifetime);
+  ZilchBindGetterSetterProperty(Size);
+  ZilchBindGetterSetterProperty(Rotation);
+  ZilchBindGetterSetterProperty(RotationalVelocity);
+  ZilchBindGetterSetterProperty(Position);
+  ZilchBindGetterSetterProperty(Velocity);
+  ZilchBindGetterSetterProperty(Color);
+  ZilchBindGetterSetterProperty(WanderAngle);
 }
 
-//--------------------------------------------------------------------- Particle
-ZilchDefineType(Particle, builder, type)
+float Particle::GetTime()
 {
-  type->HandleManager = ZilchManagerId(PointerManager);
-  ZilchBindFieldProperty(Time);
-  ZilchBindFieldProperty(Lifetime);
-  ZilchBindFieldProperty(Size);
-  ZilchBindFieldProperty(Rotation);
-  ZilchBindFieldProperty(RotationalVelocity);
-  ZilchBindFieldProperty(Position);
-  ZilchBindFieldProperty(Velocity);
-  ZilchBindFieldProperty(Color);
-  ZilchBindFieldProperty(WanderAngle);
+  return mList->mTime[mIndex];
+}
+
+void Particle::SetTime(float time)
+{
+  mList->mTime[mIndex] = time;
+}
+
+float Particle::GetLifetime()
+{
+  return mList->mLifetime[mIndex];
+}
+
+void Particle::SetLifetime(float lifetime)
+{
+  mList->mLifetime[mIndex] = lifetime;
+}
+
+float Particle::GetSize()
+{
+  return mList->mSize[mIndex];
+}
+
+void Particle::SetSize(float size)
+{
+  mList->mSize[mIndex] = size;
+}
+
+float Particle::GetRotation()
+{
+  return mList->mRotation[mIndex];
+}
+
+void Particle::SetRotation(float rotation)
+{
+  mList->mRotation[mIndex] = rotation;
+}
+
+float Particle::GetRotationalVelocity()
+{
+  return mList->mRotationalVelocity[mIndex];
+}
+
+void Particle::SetRotationalVelocity(float rotationalVelocity)
+{
+  mList->mRotationalVelocity[mIndex] = rotationalVelocity;
+}
+
+Vec3 Particle::GetPosition()
+{
+  return mList->GetPosition(mIndex);
+}
+
+void Particle::SetPosition(Vec3Param position)
+{
+  mList->SetPosition(mIndex, position);
+}
+
+Vec3 Particle::GetVelocity()
+{
+  return mList->GetVelocity(mIndex);
+}
+
+void Particle::SetVelocity(Vec3Param velocity)
+{
+  mList->SetVelocity(mIndex, velocity);
+}
+
+Vec4 Particle::GetColor()
+{
+  return mList->mColor[mIndex];
+}
+
+void Particle::SetColor(Vec4Param color)
+{
+  mList->mColor[mIndex] = color;
+}
+
+float Particle::GetWanderAngle()
+{
+  return mList->mWanderAngle[mIndex];
+}
+
+void Particle::SetWanderAngle(float wanderAngle)
+{
+  mList->mWanderAngle[mIndex] = wanderAngle;
 }
 
 //---------------------------------------------------------------- Particle List
-Memory::Pool* ParticleList::Memory = NULL;
+ParticleList::ParticleList()
+{
+  mCount = 0;
+}
 
-void ParticleList::Initialize()
+Particle ParticleList::AddParticle()
 {
-  Particles = NULL;
-  Destroyed = NULL;
-  mActiveParticles = 0;
+  uint index = mCount;
+  ++mCount;
+
+  // The arrays only grow on every fourth particle, the rest of the time the slot was padding
+  uint paddedSize = GetBlockCount() * 4;
+  if(paddedSize > mTime.Size())
+    ResizeArrays(paddedSize);
+
+  mTime[index] = 0.0f;
+  mLifetime[index] = 0.0f;
+  mSize[index] = 0.0f;
+  mRotation[index] = 0.0f;
+  mRotationalVelocity[index] = 0.0f;
+  mPositionX[index] = 0.0f;
+  mPositionY[index] = 0.0f;
+  mPositionZ[index] = 0.0f;
+  mVelocityX[index] = 0.0f;
+  mVelocityY[index] = 0.0f;
+  mVelocityZ[index] = 0.0f;
+  mWanderAngle[index] = 0.0f;
+  mColor[index] = Vec4(1, 1, 1, 1);
+
+  return Particle(this, index);
+}
+
+void ParticleList::RemoveParticle(uint index)
+{
+  ErrorIf(index >= mCount, "Particle index is invalid.");
+
+  uint lastIndex = mCount - 1;
+  mTime[index] = mTime[lastIndex];
+  mLifetime[index] = mLifetime[lastIndex];
+  mSize[index] = mSize[lastIndex];
+  mRotation[index] = mRotation[lastIndex];
+  mRotationalVelocity[index] = mRotationalVelocity[lastIndex];
+  mPositionX[index] = mPositionX[lastIndex];
+  mPositionY[index] = mPositionY[lastIndex];
+  mPositionZ[index] = mPositionZ[lastIndex];
+  mVelocityX[index] = mVelocityX[lastIndex];
+  mVelocityY[index] = mVelocityY[lastIndex];
+  mVelocityZ[index] = mVelocityZ[lastIndex];
+  mWanderAngle[index] = mWanderAngle[lastIndex];
+  mColor[index] = mColor[lastIndex];
+  --mCount;
+
+  // Only the arrays' sizes shrink, the memory is kept for the next emitted particles
+  ResizeArrays(GetBlockCount() * 4);
 }
 
-void ParticleList::AddParticle(Particle* particle)
+void ParticleList::Clear()
 {
-  ++mActiveParticles;
-  PushFront(Particles, particle);
+  mCount = 0;
+  ResizeArrays(0);
 }
 
-Particle* ParticleList::AllocateParticle()
+Vec3 ParticleList::GetPosition(uint index)
 {
-  return(Particle*)Memory->Allocate(sizeof(Particle));
+  return Vec3(mPositionX[index], mPositionY[index], mPositionZ[index]);
 }
 
-void ParticleList::FreeParticle(Particle* particle)
+void ParticleList::SetPosition(uint index, Vec3Param position)
 {
-  --mActiveParticles;
-  Memory->Deallocate(particle, sizeof(Particle));
+  mPositionX[index] = position.x;
+  mPositionY[index] = position.y;
+  mPositionZ[index] = position.z;
 }
 
-void ParticleList::DestroyParticle(Particle* particle)
+Vec3 ParticleList::GetVelocity(uint index)
 {
-  PushFront(Destroyed, particle);
+  return Vec3(mVelocityX[index], mVelocityY[index], mVelocityZ[index]);
 }
 
-void ParticleList::ClearDestroyed()
+void ParticleList::SetVelocity(uint index, Vec3Param velocity)
 {
-  Particle* curParticle = Destroyed;
-  while(curParticle != NULL)
-  {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
-  }
-  Destroyed = NULL;
+  mVelocityX[index] = velocity.x;
+  mVelocityY[index] = velocity.y;
+  mVelocityZ[index] = velocity.z;
 }
 
-void ParticleList::FreeParticles()
+void ParticleList::ResizeArrays(uint paddedSize)
 {
-  Particle* curParticle = Particles;
-  while(curParticle != NULL)
-  {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
-  }
-  Particles = NULL;
-  ErrorIf(Destroyed != 0, "Particle on destroy.");
-  ErrorIf(mActiveParticles != 0, "Particle system memory error.");
+  // New padding is zero so the simd kernels never see uninitialized values
+  mTime.Resize(paddedSize, 0.0f);
+  mLifetime.Resize(paddedSize, 0.0f);
+  mSize.Resize(paddedSize, 0.0f);
+  mRotation.Resize(paddedSize, 0.0f);
+  mRotationalVelocity.Resize(paddedSize, 0.0f);
+  mPositionX.Resize(paddedSize, 0.0f);
+  mPositionY.Resize(paddedSize, 0.0f);
+  mPositionZ.Resize(paddedSize, 0.0f);
+  mVelocityX.Resize(paddedSize, 0.0f);
+  mVelocityY.Resize(paddedSize, 0.0f);
+  mVelocityZ.Resize(paddedSize, 0.0f);
+  mWanderAngle.Resize(paddedSize, 0.0f);
+  mColor.Resize(paddedSize, Vec4::cZero);
 }
 
 } // namespace Zero
@@ -17,69 +17,107 @@ namespace Tags
   DeclareTag(Particle);
 }
 
+class ParticleList;
+
 /// The particle Contains the position, size, color,
 /// and other properties of any individual particle.
+/// A particle refers to one index of a particle list, it is only valid until
+/// particles are next removed from the list (when the system updates lifetimes).
 class Particle
 {
 public:
-  ZilchDeclareType(TypeCopyMode::ReferenceType);
-
-  Particle* Next;
-  float Time;
-  float Lifetime;
-  float Size;
-  float Rotation;
-  float RotationalVelocity;
-  Vec3 Position;
-  Vec3 Velocity;
-  Vec4 Color;
-  float WanderAngle;
+  ZilchDeclareType(TypeCopyMode::ValueType);
+
+  Particle() : mList(nullptr), mIndex(0) {}
+  Particle(ParticleList* list, uint index) : mList(list), mIndex(index) {}
+
+  float GetTime();
+  void SetTime(float time);
+  float GetLifetime();
+  void SetLifetime(float lifetime);
+  float GetSize();
+  void SetSize(float size);
+  float GetRotation();
+  void SetRotation(float rotation);
+  float GetRotationalVelocity();
+  void SetRotationalVelocity(float rotationalVelocity);
+  Vec3 GetPosition();
+  void SetPosition(Vec3Param position);
+  Vec3 GetVelocity();
+  void SetVelocity(Vec3Param velocity);
+  Vec4 GetColor();
+  void SetColor(Vec4Param color);
+  float GetWanderAngle();
+  void SetWanderAngle(float wanderAngle);
+
+  ParticleList* mList;
+  uint mIndex;
 };
 
-/// This class manages a linked-list of particles.
+/// This class manages a contiguous structure of arrays of particles. Every float array is
+/// padded to a whole block of four particles so that animators can update four at a time,
+/// dead particles are removed by swapping the last particle into their place.
 class ParticleList
 {
 public:
-  Particle* AllocateParticle();
-  void FreeParticle(Particle* particle);
+  ParticleList();
 
-  void DestroyParticle(Particle* particle);
-  void ClearDestroyed();
+  /// Appends a particle with every value zero and a white color.
+  Particle AddParticle();
+  /// Swaps the last particle into the removed particle's place.
+  void RemoveParticle(uint index);
+  void Clear();
 
-  void AddParticle(Particle* particle);
-  void FreeParticles();
+  uint Size() { return mCount; }
+  bool Empty() { return mCount == 0; }
+  /// Number of groups of four particles, the last group may be partially filled.
+  uint GetBlockCount() { return (mCount + 3) / 4; }
+
+  Vec3 GetPosition(uint index);
+  void SetPosition(uint index, Vec3Param position);
+  Vec3 GetVelocity(uint index);
+  void SetVelocity(uint index, Vec3Param velocity);
 
   struct range
   {
-    typedef Particle* value_type;
-    typedef Particle*& FrontResult;
-
-    range() : mCurrentParticle(nullptr), mEndParticle(nullptr) {}
-    range(Particle* curr, Particle* endParticle = nullptr)
-    {
-      mCurrentParticle = curr;
-      mEndParticle = endParticle;
-    }
-
-    void PopFront(){mCurrentParticle = mCurrentParticle->Next;}
-    FrontResult Front(){return mCurrentParticle;}
-    bool Empty(){return mCurrentParticle == mEndParticle;}
+    typedef Particle value_type;
+    typedef Particle FrontResult;
+
+    range() : mList(nullptr), mIndex(0), mEnd(0) {}
+    range(ParticleList* list, uint start, uint end)
+      : mList(list), mIndex(start), mEnd(end) {}
+
+    void PopFront(){++mIndex;}
+    FrontResult Front(){return Particle(mList, mIndex);}
+    bool Empty(){return mIndex >= mEnd;}
     range& All() { return *this; }
-    Particle* mCurrentParticle;
-    Particle* mEndParticle;
+    ParticleList* mList;
+    uint mIndex;
+    uint mEnd;
   };
 
   range All()
   {
-    return range(Particles);
+    return range(this, 0, mCount);
   }
 
-  static Memory::Pool* Memory;
-  Particle* Particles;
-  Particle* Destroyed;
+  uint mCount;
+  Array<float> mTime;
+  Array<float> mLifetime;
+  Array<float> mSize;
+  Array<float> mRotation;
+  Array<float> mRotationalVelocity;
+  Array<float> mPositionX;
+  Array<float> mPositionY;
+  Array<float> mPositionZ;
+  Array<float> mVelocityX;
+  Array<float> mVelocityY;
+  Array<float> mVelocityZ;
+  Array<float> mWanderAngle;
+  Array<Vec4> mColor;
 
-  uint mActiveParticles;
-  void Initialize();
+private:
+  void ResizeArrays(uint paddedSize);
 };
 
 typedef ParticleList::range ParticleListRange;
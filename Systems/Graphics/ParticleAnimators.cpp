@@ -9,9 +9,158 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Precompiled.hpp"
 
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+
 namespace Zero
 {
 
+using Math::Simd::SimVec;
+namespace Simd = Math::Simd;
+
+//----------------------------------------------------------------- Simd Helpers
+// Animators update blocks of four particles at a time. Every particle's update only
+// touches that particle, so systems with enough blocks are split across the task workers.
+const uint cMinParticleBlocksPerTask = 1024;
+const uint cMinParticlesPerTask = cMinParticleBlocksPerTask * 4;
+
+// One axis of four particles in each register
+struct SoaVec3
+{
+  SimVec x;
+  SimVec y;
+  SimVec z;
+};
+
+SoaVec3 SoaSet(Vec3Param vec)
+{
+  SoaVec3 result = {Simd::Set(vec.x), Simd::Set(vec.y), Simd::Set(vec.z)};
+  return result;
+}
+
+SoaVec3 SoaLoad(const float* x, const float* y, const float* z)
+{
+  SoaVec3 result = {Simd::UnAlignedLoad(x), Simd::UnAlignedLoad(y), Simd::UnAlignedLoad(z)};
+  return result;
+}
+
+void SoaStore(const SoaVec3& vec, float* x, float* y, float* z)
+{
+  Simd::UnAlignedStore(vec.x, x);
+  Simd::UnAlignedStore(vec.y, y);
+  Simd::UnAlignedStore(vec.z, z);
+}
+
+SoaVec3 LoadPositions(ParticleList* list, uint index)
+{
+  return SoaLoad(&list->mPositionX[index], &list->mPositionY[index], &list->mPositionZ[index]);
+}
+
+void StorePositions(ParticleList* list, uint index, const SoaVec3& positions)
+{
+  SoaStore(positions, &list->mPositionX[index], &list->mPositionY[index], &list->mPositionZ[index]);
+}
+
+SoaVec3 LoadVelocities(ParticleList* list, uint index)
+{
+  return SoaLoad(&list->mVelocityX[index], &list->mVelocityY[index], &list->mVelocityZ[index]);
+}
+
+void StoreVelocities(ParticleList* list, uint index, const SoaVec3& velocities)
+{
+  SoaStore(velocities, &list->mVelocityX[index], &list->mVelocityY[index], &list->mVelocityZ[index]);
+}
+
+SoaVec3 SoaAdd(const SoaVec3& lhs, const SoaVec3& rhs)
+{
+  SoaVec3 result = {Simd::Add(lhs.x, rhs.x), Simd::Add(lhs.y, rhs.y), Simd::Add(lhs.z, rhs.z)};
+  return result;
+}
+
+SoaVec3 SoaSubtract(const SoaVec3& lhs, const SoaVec3& rhs)
+{
+  SoaVec3 result = {Simd::Subtract(lhs.x, rhs.x), Simd::Subtract(lhs.y, rhs.y), Simd::Subtract(lhs.z, rhs.z)};
+  return result;
+}
+
+SoaVec3 SoaScale(const SoaVec3& vec, SimVec scale)
+{
+  SoaVec3 result = {Simd::Multiply(vec.x, scale), Simd::Multiply(vec.y, scale), Simd::Multiply(vec.z, scale)};
+  return result;
+}
+
+// vec * scale + add
+SoaVec3 SoaMultiplyAdd(const SoaVec3& vec, SimVec scale, const SoaVec3& add)
+{
+  SoaVec3 result;
+  result.x = Simd::MultiplyAdd(vec.x, scale, add.x);
+  result.y = Simd::MultiplyAdd(vec.y, scale, add.y);
+  result.z = Simd::MultiplyAdd(vec.z, scale, add.z);
+  return result;
+}
+
+SimVec SoaDot(const SoaVec3& lhs, const SoaVec3& rhs)
+{
+  SimVec result = Simd::Multiply(lhs.x, rhs.x);
+  result = Simd::MultiplyAdd(lhs.y, rhs.y, result);
+  return Simd::MultiplyAdd(lhs.z, rhs.z, result);
+}
+
+SoaVec3 SoaCross(const SoaVec3& lhs, const SoaVec3& rhs)
+{
+  SoaVec3 result;
+  result.x = Simd::Subtract(Simd::Multiply(lhs.y, rhs.z), Simd::Multiply(lhs.z, rhs.y));
+  result.y = Simd::Subtract(Simd::Multiply(lhs.z, rhs.x), Simd::Multiply(lhs.x, rhs.z));
+  result.z = Simd::Subtract(Simd::Multiply(lhs.x, rhs.y), Simd::Multiply(lhs.y, rhs.x));
+  return result;
+}
+
+// Takes the values of onTrue where the mask is set and onFalse everywhere else
+SoaVec3 SoaSelect(const SoaVec3& onFalse, const SoaVec3& onTrue, SimVec mask)
+{
+  SoaVec3 result;
+  result.x = Simd::Select(onFalse.x, onTrue.x, mask);
+  result.y = Simd::Select(onFalse.y, onTrue.y, mask);
+  result.z = Simd::Select(onFalse.z, onTrue.z, mask);
+  return result;
+}
+
+// Same as Vec3::AttemptNormalize on each vector, vectors too small to
+// normalize are left alone and their squared length is returned
+SimVec SoaAttemptNormalize(SoaVec3& vec)
+{
+  SimVec one = Simd::Set(1.0f);
+  SimVec lengthSq = SoaDot(vec, vec);
+  SimVec valid = Simd::GreaterEqual(lengthSq, Simd::Set(Math::Epsilon() * Math::Epsilon()));
+  SimVec length = Simd::Select(lengthSq, Simd::Sqrt(lengthSq), valid);
+  vec = SoaScale(vec, Simd::Divide(one, Simd::Select(one, length, valid)));
+  return length;
+}
+
+// Same as Math::GenerateOrthonormalBasis on each vector
+void SoaGenerateOrthonormalBasis(const SoaVec3& w, SoaVec3& u, SoaVec3& v)
+{
+  // The perpendicular vector is (-y, x, 0) when x is the largest axis, otherwise it's (0, z, -y)
+  SimVec zero = Simd::ZeroOutVec();
+  SimVec absX = Simd::Abs(w.x);
+  SimVec xLargest = Simd::AndVec(Simd::GreaterEqual(absX, Simd::Abs(w.y)), Simd::GreaterEqual(absX, Simd::Abs(w.z)));
+  SimVec negativeY = Simd::Negate(w.y);
+  u.x = Simd::Select(zero, negativeY, xLargest);
+  u.y = Simd::Select(w.z, w.x, xLargest);
+  u.z = Simd::Select(negativeY, zero, xLargest);
+  SoaAttemptNormalize(u);
+
+  v = SoaCross(w, u);
+  SoaAttemptNormalize(v);
+}
+
+// Runs the task on every block of the particle list
+template <typename TaskType>
+void RunParticleTask(ParticleList* particleList, TaskType& task)
+{
+  Z::gJobs->ParallelFor(0, particleList->GetBlockCount(), task, cMinParticleBlocksPerTask);
+}
+
 //----------------------------------------------------- Linear Particle Animator
 ZilchDefineType(LinearParticleAnimator, builder, type)
 {
@@ -56,76 +205,119 @@ LinearParticleAnimator::~LinearParticleAnimator()
   AnimatorList::Unlink(this);
 }
 
+const uint cNumberOfRandomSamples = 13;
+
+// Updates whole blocks of particles
+struct LinearAnimateTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      uint index = block * 4;
+
+      //Each particle uses the next random force sample
+      uint sample = (mSampleStart + index) % cNumberOfRandomSamples;
+      SoaVec3 randomForce = SoaLoad(&mRandomForceX[sample], &mRandomForceY[sample], &mRandomForceZ[sample]);
+
+      //Apply constant and random force
+      SoaVec3 velocity = LoadVelocities(mList, index);
+      velocity = SoaMultiplyAdd(SoaAdd(mForce, randomForce), mDt, velocity);
+
+      //Integrate position
+      SoaVec3 position = SoaMultiplyAdd(velocity, mDt, LoadPositions(mList, index));
+      StorePositions(mList, index, position);
+
+      //Expand size
+      float* size = &mList->mSize[index];
+      SimVec newSize = Simd::Add(Simd::UnAlignedLoad(size), mGrowth);
+      Simd::UnAlignedStore(Simd::Max(newSize, Simd::ZeroOutVec()), size);
+
+      //Integrate rotation of particle
+      float* rotation = &mList->mRotation[index];
+      float* rotationalVelocity = &mList->mRotationalVelocity[index];
+      SimVec spin = Simd::UnAlignedLoad(rotationalVelocity);
+      Simd::UnAlignedStore(Simd::MultiplyAdd(spin, mDt, Simd::UnAlignedLoad(rotation)), rotation);
+      Simd::UnAlignedStore(Simd::Add(spin, mTorque), rotationalVelocity);
+
+      //Twist effect
+      if(mTwist)
+      {
+        SoaVec3 toCenter = SoaSubtract(mCenter, position);
+        SoaAttemptNormalize(toCenter);
+
+        SoaVec3 twistMove = SoaCross(toCenter, mTwistVector);
+        SoaVec3 inVector = SoaCross(mTwistVector, twistMove);
+        velocity = SoaMultiplyAdd(SoaAdd(twistMove, inVector), mTwistStrength, velocity);
+      }
+
+      //Damping
+      velocity = SoaScale(velocity, mDamping);
+
+      //Store updated velocity
+      StoreVelocities(mList, index, velocity);
+    }
+  }
+
+  ParticleList* mList;
+  SoaVec3 mForce;
+  SoaVec3 mCenter;
+  SoaVec3 mTwistVector;
+  SimVec mDt;
+  // Growth, torque, and twist strength are already scaled by dt
+  SimVec mGrowth;
+  SimVec mTorque;
+  SimVec mTwistStrength;
+  SimVec mDamping;
+  bool mTwist;
+
+  // The samples repeat after the last one so that four in a row can always be loaded
+  float mRandomForceX[cNumberOfRandomSamples + 3];
+  float mRandomForceY[cNumberOfRandomSamples + 3];
+  float mRandomForceZ[cNumberOfRandomSamples + 3];
+  uint mSampleStart;
+};
+
 void LinearParticleAnimator::Animate(ParticleList* particleList, float dt,
                                      Mat4Ref transform)
 {
-  Particle* p = particleList->Particles;
   Math::Random& random = mGraphicsSpace->mRandom;
 
-  Vec3 center = GetTranslationFrom(transform);
-
-  const uint cNumberOfRandomSamples = 13;
-  Vec3 randomForces[cNumberOfRandomSamples];
-  for(uint i = 0; i < cNumberOfRandomSamples; ++i)
-    randomForces[i] = random.PointOnUnitSphere() * mRandomForce;
-
-  Vec3 twistVector = mTwist;
-  float twistStrength = twistVector.AttemptNormalize();
-
-  uint i = 0;
-  i += random.IntRangeInIn(0, 5);
+  LinearAnimateTask task;
+  task.mList = particleList;
 
-  while(p != NULL)
+  for(uint i = 0; i < cNumberOfRandomSamples + 3; ++i)
   {
- 
-    float t = p->Time;
-
-    i =(i + 1) % cNumberOfRandomSamples;
-
-    Vec3 velocity = p->Velocity;
-
-    //Apply constant force
-    velocity += mForce * dt;
-
-    //Apply random force
-    velocity += randomForces[i] * dt;
-
-    //Integrate position
-    Vec3 position = p->Position;
-    position += velocity * dt;
-    p->Position = position;
-
-    //Expand size
-    p->Size += mGrowth * dt;
-    p->Size = Math::Max(p->Size, 0.0f);
-
-    //Integrate rotation of particle
-    p->Rotation += p->RotationalVelocity * dt;
-    p->RotationalVelocity = p->RotationalVelocity + mTorque * dt;
-
-    //Twist effect
-    if(twistStrength != 0.0f)
+    if(i < cNumberOfRandomSamples)
     {
-      Vec3 toCenter = center - p->Position;
-      toCenter.AttemptNormalize();
-
-      Vec3 twistMove = Cross(toCenter, twistVector);
-      Vec3 inVector = Cross(twistVector, twistMove);
-      velocity +=(twistMove + inVector) * dt * twistStrength;
+      Vec3 randomForce = random.PointOnUnitSphere() * mRandomForce;
+      task.mRandomForceX[i] = randomForce.x;
+      task.mRandomForceY[i] = randomForce.y;
+      task.mRandomForceZ[i] = randomForce.z;
     }
-    
-    //Damping
+    else
     {
-      velocity *= Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f);
+      task.mRandomForceX[i] = task.mRandomForceX[i - cNumberOfRandomSamples];
+      task.mRandomForceY[i] = task.mRandomForceY[i - cNumberOfRandomSamples];
+      task.mRandomForceZ[i] = task.mRandomForceZ[i - cNumberOfRandomSamples];
     }
+  }
+  task.mSampleStart = random.IntRangeInIn(0, 5);
 
-    //Store updated velocity
-    p->Velocity = velocity;
+  Vec3 twistVector = mTwist;
+  float twistStrength = twistVector.AttemptNormalize();
 
-    //Move to next particle.
-    p = p->Next;
+  task.mForce = SoaSet(mForce);
+  task.mCenter = SoaSet(GetTranslationFrom(transform));
+  task.mTwistVector = SoaSet(twistVector);
+  task.mDt = Simd::Set(dt);
+  task.mGrowth = Simd::Set(mGrowth * dt);
+  task.mTorque = Simd::Set(mTorque * dt);
+  task.mTwistStrength = Simd::Set(dt * twistStrength);
+  task.mDamping = Simd::Set(Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f));
+  task.mTwist = (twistStrength != 0.0f);
 
-  }
+  RunParticleTask(particleList, task);
 }
 
 //-------------------------------------------------------------- Particle Wander
@@ -162,44 +354,72 @@ ParticleWander::~ParticleWander()
   AnimatorList::Unlink(this);
 }
 
-void ParticleWander::Animate(ParticleList* particleList, float dt,
-                             Mat4Ref transform)
-{
-  Particle* p = particleList->Particles;
-  Vec3 center = GetTranslationFrom(transform);
+const uint cNumberOfWanderSamples = 13;
 
-  while(p != NULL)
+// Updates whole blocks of particles
+struct WanderTask
+{
+  void operator()(uint blockStart, uint blockEnd)
   {
-    Vec3 velocity = p->Velocity;
-    Vec3 normalizedVel = velocity;
-    float l = normalizedVel.AttemptNormalize();
-
-    if(l > 0.0f)
+    SimVec zero = Simd::ZeroOutVec();
+    for(uint block = blockStart; block < blockEnd; ++block)
     {
-      normalizedVel /= l;
+      uint index = block * 4;
+
+      SoaVec3 velocity = LoadVelocities(mList, index);
+      SoaVec3 normalizedVel = velocity;
+      SimVec moving = Simd::Greater(SoaAttemptNormalize(normalizedVel), zero);
 
       //Get the current wander value
-      float curAngle = p->WanderAngle;
-      curAngle += mGraphicsSpace->mRandom.FloatVariance(mWanderAngle, mWanderAngleVariance) * dt;
+      float* wanderAngle = &mList->mWanderAngle[index];
+      SimVec oldAngle = Simd::UnAlignedLoad(wanderAngle);
+      uint sample = (mSampleStart + index) % cNumberOfWanderSamples;
+      SimVec curAngle = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mWanderRates[sample]), mDt, oldAngle);
 
       //Get a basis(not consistent varies based on normal)
-      Vec3 a,b;
-      Math::GenerateOrthonormalBasis(normalizedVel, &a, &b);
+      SoaVec3 a, b;
+      SoaGenerateOrthonormalBasis(normalizedVel, a, b);
 
-      float wanderChange = dt * mWanderStrength;
-      Vec3 change = Math::Cos(curAngle) * wanderChange * a + 
-                    Math::Sin(curAngle) * wanderChange * b;
-      velocity += change;
+      float angles[4];
+      Simd::UnAlignedStore(curAngle, angles);
+      SimVec cosAngle = Simd::Set4(Math::Cos(angles[0]), Math::Cos(angles[1]), Math::Cos(angles[2]), Math::Cos(angles[3]));
+      SimVec sinAngle = Simd::Set4(Math::Sin(angles[0]), Math::Sin(angles[1]), Math::Sin(angles[2]), Math::Sin(angles[3]));
 
-      //Store updated wander velocity
-      p->WanderAngle = curAngle;
-      p->Velocity = velocity;
-    }
+      SoaVec3 change = SoaScale(a, Simd::Multiply(cosAngle, mWanderChange));
+      change = SoaMultiplyAdd(b, Simd::Multiply(sinAngle, mWanderChange), change);
 
-    //Move to next particle.
-    p = p->Next;
+      //Store updated wander velocity of every moving particle
+      Simd::UnAlignedStore(Simd::Select(oldAngle, curAngle, moving), wanderAngle);
+      StoreVelocities(mList, index, SoaSelect(velocity, SoaAdd(velocity, change), moving));
+    }
   }
 
+  ParticleList* mList;
+  SimVec mDt;
+  SimVec mWanderChange;
+
+  // The samples repeat after the last one so that four in a row can always be loaded
+  float mWanderRates[cNumberOfWanderSamples + 3];
+  uint mSampleStart;
+};
+
+void ParticleWander::Animate(ParticleList* particleList, float dt,
+                             Mat4Ref transform)
+{
+  Math::Random& random = mGraphicsSpace->mRandom;
+
+  WanderTask task;
+  task.mList = particleList;
+  task.mDt = Simd::Set(dt);
+  task.mWanderChange = Simd::Set(dt * mWanderStrength);
+
+  for(uint i = 0; i < cNumberOfWanderSamples; ++i)
+    task.mWanderRates[i] = random.FloatVariance(mWanderAngle, mWanderAngleVariance);
+  for(uint i = 0; i < 3; ++i)
+    task.mWanderRates[cNumberOfWanderSamples + i] = task.mWanderRates[i];
+  task.mSampleStart = random.IntRangeInIn(0, cNumberOfWanderSamples - 1);
+
+  RunParticleTask(particleList, task);
 }
 
 //--------------------------------------------------- Particle Gradient Animator
@@ -233,48 +453,61 @@ void ParticleColorAnimator::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ParticleColorAnimator::Animate(ParticleList* particleList, float dt,  Mat4Ref transform)
+// Samples the gradients for a range of particles
+struct ColorAnimateTask
 {
-  // Do nothing if neither gradients exist
-  ColorGradient* timeGradient = mTimeGradient;
-  ColorGradient* velocityGradient = mVelocityGradient;
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+    {
+      Vec4 color = Vec4(1);
 
-  if(timeGradient == nullptr && velocityGradient == nullptr)
-    return;
+      // Sample time gradient
+      if(mTimeGradient)
+      {
+        float normalizedT = mList->mTime[i] / mList->mLifetime[i];
+        color *= mTimeGradient->Sample(normalizedT);
+      }
 
-  float maxSpeedSq = mMaxParticleSpeed * mMaxParticleSpeed;
+      // Sample velocity gradient
+      if(mVelocityGradient)
+      {
+        float speedSq = Math::LengthSq(mList->GetVelocity(i));
+        float normalizedT = speedSq / mMaxSpeedSq;
 
-  // Iterate over each particle
-  Particle* p = particleList->Particles;
-  while(p != NULL)
-  {
-    Vec4 color = Vec4(1);
+        // Don't let it go above 1
+        normalizedT = Math::Min(normalizedT, 1.0f);
 
-    // Sample time gradient
-    if(timeGradient)
-    {
-      float normalizedT = p->Time / p->Lifetime;
-      color *= timeGradient->Sample(normalizedT);
-    }
+        color *= mVelocityGradient->Sample(normalizedT);
+      }
 
-    // Sample velocity gradient
-    if(velocityGradient)
-    {
-      float speedSq = Math::LengthSq(p->Velocity);
-      float normalizedT = speedSq / maxSpeedSq;
+      // Set the final color
+      mList->mColor[i] = color;
+    }
+  }
 
-      // Don't let it go above 1
-      normalizedT = Math::Min(normalizedT, 1.0f);
+  ParticleList* mList;
+  ColorGradient* mTimeGradient;
+  ColorGradient* mVelocityGradient;
+  float mMaxSpeedSq;
+};
 
-      color *= velocityGradient->Sample(normalizedT);
-    }
+void ParticleColorAnimator::Animate(ParticleList* particleList, float dt,  Mat4Ref transform)
+{
+  // Do nothing if neither gradients exist
+  ColorGradient* timeGradient = mTimeGradient;
+  ColorGradient* velocityGradient = mVelocityGradient;
 
-    // Set the final color
-    p->Color = color;
+  if(timeGradient == nullptr && velocityGradient == nullptr)
+    return;
 
-    //Move to next particle.
-    p = p->Next;
-  }
+  // Gradients are only read, so each particle can be sampled on any task worker
+  ColorAnimateTask task;
+  task.mList = particleList;
+  task.mTimeGradient = timeGradient;
+  task.mVelocityGradient = velocityGradient;
+  task.mMaxSpeedSq = mMaxParticleSpeed * mMaxParticleSpeed;
+  Z::gJobs->ParallelFor(0, particleList->Size(), task, cMinParticlesPerTask);
 }
 
 //----------------------------------------------------------- Particle Attractor
@@ -313,10 +546,41 @@ void ParticleAttractor::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
+// Updates whole blocks of particles
+struct AttractorTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    SimVec zero = Simd::ZeroOutVec();
+    SimVec one = Simd::Set(1.0f);
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      uint index = block * 4;
+
+      SoaVec3 toAttractPoint = SoaSubtract(mAttractPosition, LoadPositions(mList, index));
+      SimVec distance = SoaAttemptNormalize(toAttractPoint);
+
+      distance = Simd::Multiply(Simd::Subtract(distance, mMinDistance), mInvRange);
+
+      SimVec falloff = Simd::Clamp(Simd::Subtract(one, distance), zero, one);
+
+      SoaVec3 velocity = LoadVelocities(mList, index);
+      velocity = SoaMultiplyAdd(toAttractPoint, Simd::Multiply(falloff, mStrength), velocity);
+      StoreVelocities(mList, index, velocity);
+    }
+  }
+
+  ParticleList* mList;
+  SoaVec3 mAttractPosition;
+  SimVec mMinDistance;
+  SimVec mInvRange;
+  // Already scaled by dt
+  SimVec mStrength;
+};
+
 void ParticleAttractor::Animate(ParticleList* particleList, float dt,
                                 Mat4Ref transform)
 {
-  Vec3 center = GetTranslationFrom(transform);
   float range = mMaxDistance - mMinDistance;
   float invRange =(1.0f / range);
 
@@ -324,25 +588,14 @@ void ParticleAttractor::Animate(ParticleList* particleList, float dt,
   if (mPositionSpace == SystemSpace::LocalSpace)
     attractPosition = Math::TransformPoint(transform, attractPosition);
 
-  Particle* particle = particleList->Particles;
-  while(particle != NULL)
-  {
-    Vec3 toAttractPoint = attractPosition - particle->Position;
-    float distance = toAttractPoint.AttemptNormalize();
+  AttractorTask task;
+  task.mList = particleList;
+  task.mAttractPosition = SoaSet(attractPosition);
+  task.mMinDistance = Simd::Set(mMinDistance);
+  task.mInvRange = Simd::Set(invRange);
+  task.mStrength = Simd::Set(mStrength * dt);
 
-    distance -= mMinDistance;
-    distance *= invRange;
-
-    float falloff = 1.0f - distance;
-    falloff = Math::Clamp(falloff, 0.0f, 1.0f);
-
-    Vec3 velocity = particle->Velocity;
-    velocity += toAttractPoint * mStrength * falloff * dt;
-    particle->Velocity = velocity;
-
-    //Move to next particle.
-    particle = particle->Next;
-  }
+  RunParticleTask(particleList, task);
 }
 
 
@@ -384,6 +637,42 @@ void ParticleTwister::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
+// Updates whole blocks of particles
+struct TwisterTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    SimVec zero = Simd::ZeroOutVec();
+    SimVec one = Simd::Set(1.0f);
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      uint index = block * 4;
+
+      SoaVec3 toCenter = SoaSubtract(mCenter, LoadPositions(mList, index));
+      SimVec distance = SoaAttemptNormalize(toCenter);
+
+      distance = Simd::Multiply(Simd::Subtract(distance, mMinDistance), mInvRange);
+
+      SimVec falloff = Simd::Clamp(Simd::Subtract(one, distance), zero, one);
+
+      SoaVec3 twistMove = SoaCross(toCenter, mTwistVector);
+      SoaVec3 inVector = SoaCross(mTwistVector, twistMove);
+
+      SoaVec3 velocity = LoadVelocities(mList, index);
+      velocity = SoaMultiplyAdd(SoaAdd(twistMove, inVector), Simd::Multiply(falloff, mStrength), velocity);
+      StoreVelocities(mList, index, velocity);
+    }
+  }
+
+  ParticleList* mList;
+  SoaVec3 mCenter;
+  SoaVec3 mTwistVector;
+  SimVec mMinDistance;
+  SimVec mInvRange;
+  // Already scaled by dt
+  SimVec mStrength;
+};
+
 void ParticleTwister::Animate(ParticleList* particleList, float dt,
                                 Mat4Ref transform)
 {
@@ -394,31 +683,15 @@ void ParticleTwister::Animate(ParticleList* particleList, float dt,
   if(range > 0.0f)
     invRange = (1.0f / range);
 
-  Vec3 twistVector = mAxis;
-  float strength = mStrength;
-
-  Particle* particle = particleList->Particles;
-  while(particle != NULL)
-  {
-    Vec3 toCenter = center - particle->Position;
-    float distance = toCenter.Normalize();
-    Vec3 velocity = particle->Velocity;
+  TwisterTask task;
+  task.mList = particleList;
+  task.mCenter = SoaSet(center);
+  task.mTwistVector = SoaSet(mAxis);
+  task.mMinDistance = Simd::Set(mMinDistance);
+  task.mInvRange = Simd::Set(invRange);
+  task.mStrength = Simd::Set(dt * mStrength);
 
-    distance -= mMinDistance;
-    distance *= invRange;
-
-    float falloff = 1.0f - distance;
-    falloff = Math::Clamp(falloff, 0.0f, 1.0f);
-
-    Vec3 twistMove = Cross(toCenter, twistVector);
-    Vec3 inVector = Cross(twistVector, twistMove);
-    velocity +=(twistMove + inVector) *(dt * strength * falloff);
-
-    particle->Velocity = velocity;
-
-    //Move to next particle.
-    particle = particle->Next;
-  }
+  RunParticleTask(particleList, task);
 }
 
 
@@ -456,24 +729,65 @@ void ParticleCollisionPlane::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ReflectParticle(Particle* particle, Vec3Param planeNormal, float restitution, float friction)
+Vec3 ReflectVelocity(Vec3Param velocity, Vec3Param planeNormal, float restitution, float friction)
 {
-  Vec3 velocity = particle->Velocity;
-
   // Reflect
-  velocity = Math::ReflectAcrossPlane(velocity, planeNormal);
+  Vec3 reflected = Math::ReflectAcrossPlane(velocity, planeNormal);
 
   // Split up the velocity so we can apply restitution and friction in different directions
-  Vec3 velocityNormal = Math::ProjectOnVector(velocity, planeNormal);
-  Vec3 velocityTangent = velocity - velocityNormal;
+  Vec3 velocityNormal = Math::ProjectOnVector(reflected, planeNormal);
+  Vec3 velocityTangent = reflected - velocityNormal;
 
   velocityNormal *= restitution;
   velocityTangent *= (1.0f - friction);
 
   // Re-compute the velocity
-  particle->Velocity = velocityNormal + velocityTangent;
+  return velocityNormal + velocityTangent;
 }
 
+// Updates whole blocks of particles
+struct CollisionPlaneTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    SimVec zero = Simd::ZeroOutVec();
+    SimVec two = Simd::Set(2.0f);
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      uint index = block * 4;
+
+      SoaVec3 position = LoadPositions(mList, index);
+      SimVec distance = Simd::Subtract(SoaDot(position, mPlaneNormal), mPlaneDistance);
+      SimVec colliding = Simd::Less(distance, zero);
+      if(_mm_movemask_ps(colliding) == 0)
+        continue;
+
+      // Project the particle back onto the plane
+      SoaVec3 projected = SoaMultiplyAdd(mPlaneNormal, Simd::Negate(distance), position);
+      StorePositions(mList, index, SoaSelect(position, projected, colliding));
+
+      // Reflect (same as ReflectVelocity)
+      SoaVec3 velocity = LoadVelocities(mList, index);
+      SimVec normalSpeed = SoaDot(velocity, mPlaneNormal);
+      SoaVec3 reflected = SoaMultiplyAdd(mPlaneNormal, Simd::Negate(Simd::Multiply(two, normalSpeed)), velocity);
+
+      // Split up the velocity so we can apply restitution and friction in different directions
+      SoaVec3 velocityNormal = SoaScale(mPlaneNormal, SoaDot(reflected, mPlaneNormal));
+      SoaVec3 velocityTangent = SoaSubtract(reflected, velocityNormal);
+      reflected = SoaAdd(SoaScale(velocityNormal, mRestitution), SoaScale(velocityTangent, mFriction));
+
+      StoreVelocities(mList, index, SoaSelect(velocity, reflected, colliding));
+    }
+  }
+
+  ParticleList* mList;
+  SoaVec3 mPlaneNormal;
+  SimVec mPlaneDistance;
+  SimVec mRestitution;
+  // One minus the friction
+  SimVec mFriction;
+};
+
 void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, 
                                      Mat4Ref transform)
 {
@@ -487,23 +801,14 @@ void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt,
 
   Plane plane(planeNormal, planePosition);
 
-  Particle* particle = particleList->Particles;
-  while(particle != NULL)
-  {
-    Vec3 position = particle->Position;
+  CollisionPlaneTask task;
+  task.mList = particleList;
+  task.mPlaneNormal = SoaSet(planeNormal);
+  task.mPlaneDistance = Simd::Set(plane.GetDistance());
+  task.mRestitution = Simd::Set(mRestitution);
+  task.mFriction = Simd::Set(1.0f - mFriction);
 
-    float distance = plane.SignedDistanceToPlane(position);
-    if(distance < 0)
-    {
-      // Project the particle back onto the plane
-      particle->Position = position + (planeNormal * -distance);
-
-      ReflectParticle(particle, planeNormal, mRestitution, mFriction);
-    }
-
-    //Move to next particle.
-    particle = particle->Next;
-  }
+  RunParticleTask(particleList, task);
 }
 
 float ParticleCollisionPlane::GetRestitution()
@@ -576,28 +881,24 @@ void ParticleCollisionHeightmap::Animate(ParticleList* particleList, float dt, M
   Vec3 mapRight, mapForward;
   Math::GenerateOrthonormalBasis(mapUp, &mapRight, &mapForward);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  uint particleCount = particleList->Size();
+  for (uint i = 0; i < particleCount; ++i)
   {
-    Vec3 position = particle->Position;
+    Vec3 position = particleList->GetPosition(i);
 
     Vec3 normal;
     float sampleHeight = map->SampleHeight(position, -Math::PositiveMax(), &normal);
     float particleHeight = map->GetWorldPointHeight(position);
-    float particleBottom = particleHeight - particle->Size;
 
     if (particleHeight < sampleHeight)
     {
-      Vec3 velocity = particle->Velocity;
+      Vec3 velocity = particleList->GetVelocity(i);
 
       // Move to our previous position
-      particle->Position = particle->Position - velocity * dt;
+      particleList->SetPosition(i, position - velocity * dt);
 
-      ReflectParticle(particle, normal, mRestitution, mFriction);
+      particleList->SetVelocity(i, ReflectVelocity(velocity, normal, mRestitution, mFriction));
     }
-
-    //Move to next particle.
-    particle = particle->Next;
   }
 }
 
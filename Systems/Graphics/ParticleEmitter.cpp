@@ -254,12 +254,12 @@ int ParticleEmitterShared::GetParticleEmissionCount(ParticleList* particleList,
   return particlesToEmit;
 }
 
-Particle* ParticleEmitterShared::CreateInitializedParticle(ParticleList* particleList,
-                                                           int particle, 
-                                                           Mat4Ref transform, 
-                                                           Vec3Param emitterVelocity)
+Particle ParticleEmitterShared::CreateInitializedParticle(ParticleList* particleList,
+                                                          int particle, 
+                                                          Mat4Ref transform, 
+                                                          Vec3Param emitterVelocity)
 {
-  Particle* newParticle = particleList->AllocateParticle();
+  Particle newParticle = particleList->AddParticle();
   Math::Random& random = mGraphicsSpace->mRandom;
 
   Vec3 direction;
@@ -288,25 +288,23 @@ Particle* ParticleEmitterShared::CreateInitializedParticle(ParticleList* particl
     velocity += dirNorm * mTangentVelocity.z + crossA * mTangentVelocity.y + crossB * mTangentVelocity.x;
   }
 
-  newParticle->Time = 0;
-  newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+  newParticle.SetTime(0);
+  newParticle.SetSize(random.FloatVariance(mSize, mSizeVariance));
 
-  newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
-  newParticle->Position = Math::TransformPoint(transform, startingPoint);
-  newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+  newParticle.SetVelocity(Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent);
+  newParticle.SetPosition(Math::TransformPoint(transform, startingPoint));
+  newParticle.SetLifetime(random.FloatVariance(mLifetime, mLifetimeVariance));
 
-  newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+  newParticle.SetWanderAngle(random.FloatRange(0.0f, 2 * Math::cTwoPi));
 
   if(mRandomSpin)
-    newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.SetRotation(random.FloatRange(0.0f, 2 * Math::cTwoPi));
   else
-    newParticle->Rotation = 0;
+    newParticle.SetRotation(0);
 
-  newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin),
-                                                          Math::DegToRad(mSpinVariance));
+  newParticle.SetRotationalVelocity(random.FloatVariance(Math::DegToRad(mSpin),
+                                                         Math::DegToRad(mSpinVariance)));
 
-  particleList->AddParticle(newParticle);
-  
   return newParticle;
 }
 
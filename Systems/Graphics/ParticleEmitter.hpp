@@ -66,8 +66,8 @@ public:
 
   //Mix in Helpers
   int GetParticleEmissionCount(ParticleList* particleList, float dt, float timeAlive);
-  Particle* CreateInitializedParticle(ParticleList* particleList, int particle, 
-                                      Mat4Ref transform, Vec3Param emitterVelocity);
+  Particle CreateInitializedParticle(ParticleList* particleList, int particle, 
+                                     Mat4Ref transform, Vec3Param emitterVelocity);
 
   /// Reset the number of particles to emit back to EmitCount.
   void ResetCount() override;
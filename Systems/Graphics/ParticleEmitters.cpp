@@ -57,7 +57,7 @@ int SphericalParticleEmitter::EmitParticles(ParticleList* particleList, float dt
 
   for(int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    Particle newParticle = particleList->AddParticle();
 
     Vec3 direction;
 
@@ -87,33 +87,31 @@ int SphericalParticleEmitter::EmitParticles(ParticleList* particleList, float dt
                   crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.SetTime(0);
+    newParticle.SetSize(random.FloatVariance(mSize, mSizeVariance));
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.SetVelocity(Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent);
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.SetPosition(Math::TransformPoint(transform, startingPoint));
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.SetPosition(newParticle.GetPosition() + offsetDelta * (float)p);
     }
 
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.SetLifetime(random.FloatVariance(mLifetime, mLifetimeVariance));
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.SetColor(Vec4(1, 1, 1, 1));
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.SetWanderAngle(random.FloatRange(0.0f, 2 * Math::cTwoPi));
 
     if(mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.SetRotation(random.FloatRange(0.0f, 2 * Math::cTwoPi));
     else
-      newParticle->Rotation = 0;
+      newParticle.SetRotation(0);
 
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin),
-                                                           Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
+    newParticle.SetRotationalVelocity(random.FloatVariance(Math::DegToRad(mSpin),
+                                                           Math::DegToRad(mSpinVariance)));
   }
 
   return particlesToEmit;
@@ -162,7 +160,7 @@ int BoxParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
 
   for(int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    Particle newParticle = particleList->AddParticle();
 
     Vec3 halfExtents = mEmitterSize * 0.5f;
     Vec3 startingPoint = Vec3(0,0,0);
@@ -183,33 +181,31 @@ int BoxParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
         crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.SetTime(0);
+    newParticle.SetSize(random.FloatVariance(mSize, mSizeVariance));
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.SetVelocity(Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent);
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.SetPosition(Math::TransformPoint(transform, startingPoint));
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.SetPosition(newParticle.GetPosition() + offsetDelta * (float)p);
     }
 
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.SetLifetime(random.FloatVariance(mLifetime, mLifetimeVariance));
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.SetColor(Vec4(1, 1, 1, 1));
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.SetWanderAngle(random.FloatRange(0.0f, 2 * Math::cTwoPi));
 
     if(mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.SetRotation(random.FloatRange(0.0f, 2 * Math::cTwoPi));
     else
-      newParticle->Rotation = 0;
-
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin),
-      Math::DegToRad(mSpinVariance));
+      newParticle.SetRotation(0);
 
-    particleList->AddParticle(newParticle);
+    newParticle.SetRotationalVelocity(random.FloatVariance(Math::DegToRad(mSpin),
+      Math::DegToRad(mSpinVariance)));
   }
 
   return particlesToEmit;
@@ -341,7 +337,7 @@ int MeshParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
   int particlesToEmit = GetParticleEmissionCount(particleList, dt, timeAlive);
   for(int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    Particle newParticle = particleList->AddParticle();
 
     Vec3 position, normal;
     GetNextEmitPoint(&position, &normal);
@@ -361,26 +357,24 @@ int MeshParticleEmitter::EmitParticles(ParticleList* particleList, float dt,
                   crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.SetTime(0);
+    newParticle.SetSize(random.FloatVariance(mSize, mSizeVariance));
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.SetVelocity(Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent);
+    newParticle.SetPosition(Math::TransformPoint(transform, startingPoint));
+    newParticle.SetLifetime(random.FloatVariance(mLifetime, mLifetimeVariance));
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.SetColor(Vec4(1, 1, 1, 1));
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.SetWanderAngle(random.FloatRange(0.0f, 2 * Math::cTwoPi));
 
     if(mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.SetRotation(random.FloatRange(0.0f, 2 * Math::cTwoPi));
     else
-      newParticle->Rotation = 0;
-
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin),
-                                                           Math::DegToRad(mSpinVariance));
+      newParticle.SetRotation(0);
 
-    particleList->AddParticle(newParticle);
+    newParticle.SetRotationalVelocity(random.FloatVariance(Math::DegToRad(mSpin),
+                                                           Math::DegToRad(mSpinVariance)));
   }
 
   return particlesToEmit;
@@ -8,9 +8,15 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Precompiled.hpp"
 
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+
 namespace Zero
 {
 
+using Math::Simd::SimVec;
+namespace Simd = Math::Simd;
+
 //******************************************************************************
 int EmitParticles(ParticleSystem* main, ParticleEmitter* emitter,
                   ParticleList* particleList, float dt, Mat4Ref parentTransform, float timeAlive)
@@ -122,7 +128,6 @@ void ParticleSystem::Initialize(CogInitializer& initializer)
       parentSystem->AddChildSystem(this);
   }
 
-  mParticleList.Initialize();
   mTimeAlive = 0.0f;
   mDebugDrawing = false;
 
@@ -132,10 +137,11 @@ void ParticleSystem::Initialize(CogInitializer& initializer)
     ConnectThisTo(Z::gRuntimeEditor->GetActiveSelection(), Events::SelectionFinal, OnSelectionFinal);
   }
 
+  SpaceUpdateLists& updateLists = GetSpace()->mUpdateLists;
   if (mPreviewInEditor && GetSpace()->IsEditorMode())
-    ConnectThisTo(GetSpace(), Events::FrameUpdate, OnUpdate);
+    updateLists.Add(this, UpdatePhase::Frame, ZeroUpdateFunction(ParticleSystem, OnUpdate));
   else
-    ConnectThisTo(GetSpace(), Events::LogicUpdate, OnUpdate);
+    updateLists.Add(this, UpdatePhase::Logic, ZeroUpdateFunction(ParticleSystem, OnUpdate));
 }
 
 //******************************************************************************
@@ -195,6 +201,10 @@ void ParticleSystem::OnDestroy(uint flags)
       parentSystem->RemoveChildSystem(this);
   }
 
+  SpaceUpdateLists& updateLists = GetSpace()->mUpdateLists;
+  updateLists.Remove(this, UpdatePhase::Frame, ZeroUpdateFunction(ParticleSystem, OnUpdate));
+  updateLists.Remove(this, UpdatePhase::Logic, ZeroUpdateFunction(ParticleSystem, OnUpdate));
+
   Clear();
 
   Graphical::OnDestroy(flags);
@@ -294,16 +304,17 @@ void ParticleSystem::SetPreviewInEditor(bool previewInEditor)
   if (!GetSpace()->IsEditorMode())
     return;
 
+  SpaceUpdateLists& updateLists = GetSpace()->mUpdateLists;
   if (mPreviewInEditor)
   {
     mDebugDrawing = false;
-    ConnectThisTo(GetSpace(), Events::FrameUpdate, OnUpdate);
-    GetSpace()->GetDispatcher()->DisconnectEvent(Events::LogicUpdate, this);
+    updateLists.Add(this, UpdatePhase::Frame, ZeroUpdateFunction(ParticleSystem, OnUpdate));
+    updateLists.Remove(this, UpdatePhase::Logic, ZeroUpdateFunction(ParticleSystem, OnUpdate));
   }
   else
   {
-    ConnectThisTo(GetSpace(), Events::LogicUpdate, OnUpdate);
-    GetSpace()->GetDispatcher()->DisconnectEvent(Events::FrameUpdate, this);
+    updateLists.Add(this, UpdatePhase::Logic, ZeroUpdateFunction(ParticleSystem, OnUpdate));
+    updateLists.Remove(this, UpdatePhase::Frame, ZeroUpdateFunction(ParticleSystem, OnUpdate));
 
     // If we're selected in the editor, it's being updated by DebugDraw(), so don't clear the particles
     if (!IsSelectedInEditor())
@@ -320,8 +331,7 @@ ParticleListRange ParticleSystem::AllParticles()
 //******************************************************************************
 void ParticleSystem::Clear()
 {
-  mParticleList.ClearDestroyed();
-  mParticleList.FreeParticles();
+  mParticleList.Clear();
 
   forRange (ParticleEmitter& emitter, mEmitters.All())
     emitter.ResetCount();
@@ -345,7 +355,6 @@ void ParticleSystem::SystemUpdate(float dt)
 
   BaseUpdate(dt);
   UpdateLifetimes(dt);
-  mParticleList.ClearDestroyed();
 }
 
 //******************************************************************************
@@ -362,7 +371,7 @@ uint ParticleSystem::BaseUpdate(float dt)
 
   // Emit Particles
   int emitCount = 0;
-  Particle* oldFront = mParticleList.Particles;
+  uint oldCount = mParticleList.Size();
   for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
     emitCount += EmitParticles(this, &r.Front(), &mParticleList, dt, worldTransform, mTimeAlive);
 
@@ -371,7 +380,7 @@ uint ParticleSystem::BaseUpdate(float dt)
   {
     ParticleEvent eventToSend;
     eventToSend.mNewParticleCount = (uint)emitCount;
-    eventToSend.mNewParticles = ParticleList::range(mParticleList.Particles, oldFront);
+    eventToSend.mNewParticles = ParticleList::range(&mParticleList, oldCount, mParticleList.Size());
     GetOwner()->DispatchEvent(Events::ParticlesSpawned, &eventToSend);
   }
 
@@ -391,16 +400,15 @@ void ParticleSystem::ChildUpdate(float dt, ParticleList* parentList, uint parent
   uint emitCount = 0;
   Mat4 worldTransform = mTransform->GetWorldMatrix();
 
-  Particle* particle = parentList->Particles;
-
-  while (particle != nullptr)
+  uint parentCount = parentList->Size();
+  for (uint i = 0; i < parentCount; ++i)
   {
-    SetTranslationOn(&worldTransform, particle->Position);
+    SetTranslationOn(&worldTransform, parentList->GetPosition(i));
 
+    Vec3 parentVelocity = parentList->GetVelocity(i);
+    float parentTime = parentList->mTime[i];
     for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
-      emitCount += r.Front().EmitParticles(&mParticleList, dt, worldTransform, particle->Velocity, particle->Time);
-
-    particle = particle->Next;
+      emitCount += r.Front().EmitParticles(&mParticleList, dt, worldTransform, parentVelocity, parentTime);
   }
 
   for (AnimatorList::range r = mAnimators.All(); !r.Empty(); r.PopFront())
@@ -408,47 +416,31 @@ void ParticleSystem::ChildUpdate(float dt, ParticleList* parentList, uint parent
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
     r.Front().ChildUpdate(dt, &mParticleList, emitCount);
-
-  mParticleList.ClearDestroyed();
 }
 
 //******************************************************************************
 void ParticleSystem::UpdateLifetimes(float dt)
 {
-  // Begin particle update pass removing dead particles
-  Particle* particle = mParticleList.Particles;
-  Particle** prev = &mParticleList.Particles;
+  // Age every particle four at a time (the padding is aged along with them)
+  Array<float>& times = mParticleList.mTime;
+  SimVec dtVec = Simd::Set(dt);
+  for (uint i = 0; i < times.Size(); i += 4)
+    Simd::UnAlignedStore(Simd::Add(Simd::UnAlignedLoad(&times[i]), dtVec), &times[i]);
+
+  // Begin particle update pass removing dead particles, walking backwards means
+  // the particle swapped into a dead particle's place has already been checked
+  bool hadParticles = !mParticleList.Empty();
+  for (uint i = mParticleList.Size(); i > 0; --i)
+  {
+    uint index = i - 1;
+    if (times[index] >= mParticleList.mLifetime[index])
+      mParticleList.RemoveParticle(index);
+  }
 
-  while (particle != nullptr)
+  if (hadParticles && mParticleList.Empty())
   {
-    particle->Time += dt;
-
-    if (particle->Time >= particle->Lifetime)
-    {
-      // Particle is dead remove from active list
-      (*prev) = particle->Next;
-
-      Particle* deadParticle = particle;
-
-      // Move to next particle
-      particle = particle->Next;
-
-      mParticleList.DestroyParticle(deadParticle);
-
-      if (mParticleList.Particles == nullptr)
-      {
-        ObjectEvent event(this);
-        DispatchEvent(Events::AllParticlesDead, &event);
-      }
-    }
-    else
-    {
-      // Set the prev to this particle
-      prev = &particle->Next;
-
-      // Move to next particle.
-      particle = particle->Next;
-    }
+    ObjectEvent event(this);
+    DispatchEvent(Events::AllParticlesDead, &event);
   }
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
@@ -12,6 +12,7 @@ static const float cAcceptableLoadtime = 0.15f;
 OsInt RendererThreadMain(void* rendererThreadJobQueue)
 {
   RendererThreadJobQueue* jobQueue = (RendererThreadJobQueue*)rendererThreadJobQueue;
+  Profile::ProfileSystem::Instance->SetThreadName("Renderer");
 
   Array<RendererJob*> rendererJobs;
 
@@ -21,8 +22,11 @@ OsInt RendererThreadMain(void* rendererThreadJobQueue)
     jobQueue->WaitForJobs();
   
     jobQueue->TakeAllJobs(rendererJobs);
-    forRange (RendererJob* job, rendererJobs.All())
-      job->Execute();
+    {
+      ProfileScopeTree("RendererJobs", "Graphics", Color::MediumSpringGreen);
+      forRange (RendererJob* job, rendererJobs.All())
+        job->Execute();
+    }
     rendererJobs.Clear();
 
     running = !jobQueue->ShouldExitThread();
@@ -3,9 +3,20 @@
 
 #include "Precompiled.hpp"
 
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+#include "Math/SimMatrix4.hpp"
+
 namespace Zero
 {
 
+using Math::Simd::SimVec;
+using Math::Simd::SimMat4;
+namespace Simd = Math::Simd;
+
+// Bones take roughly the same time each, so a few Skeletons are enough work for one task
+const uint cMinSkeletonsPerTask = 4;
+
 namespace Events
 {
   DefineEvent(SkeletonModified);
@@ -269,7 +280,7 @@ void Skeleton::MarkModified()
 }
 
 //**************************************************************************************************
-IndexRange Skeleton::GetBoneTransforms(Array<Mat4>& skinningBuffer, uint version)
+IndexRange Skeleton::GetBoneTransforms(SkeletonPoseBatch& poses, Array<Mat4>& skinningBuffer, uint version)
 {
   if (mNeedsRebuild)
     BuildSkeleton();
@@ -277,22 +288,44 @@ IndexRange Skeleton::GetBoneTransforms(Array<Mat4>& skinningBuffer, uint version
   if (version == mCachedVersion)
     return mCachedTransformRange;
 
-  Array<Mat4> boneTransforms;
-  boneTransforms.Resize(mBones.Size());
+  mCachedTransformRange.start = skinningBuffer.Size();
+  skinningBuffer.Resize(skinningBuffer.Size() + mBones.Size());
+  mCachedTransformRange.end = skinningBuffer.Size();
+
+  poses.AddSkeleton(mCachedTransformRange.start);
 
   // mBones[0] is this object and bone pointer may be null
-  boneTransforms[0] = mBones[0].mCog->has(Transform)->GetParentRelativeMatrix();
-  for (uint i = 1; i < mBones.Size(); ++i)
-    boneTransforms[i] = boneTransforms[mBones[i].mParentIndex] * mBones[i].mCog->has(Bone)->GetLocalTransform();
+  Transform* rootTransform = mBones[0].mCog->has(Transform);
+  if (HasPlainLocalTransform(rootTransform))
+    poses.AddBone(-1, rootTransform->GetLocalTranslation(), rootTransform->GetLocalRotation(), rootTransform->GetLocalScale());
+  else
+    poses.AddBone(-1, rootTransform->GetParentRelativeMatrix());
 
-  mCachedTransformRange.start = skinningBuffer.Size();
-  skinningBuffer.Append(boneTransforms.All());
-  mCachedTransformRange.end = skinningBuffer.Size();
+  for (uint i = 1; i < mBones.Size(); ++i)
+  {
+    BoneInfo& boneInfo = mBones[i];
+    Bone* bone = boneInfo.mCog->has(Bone);
+    Transform* transform = bone->mTransform;
+
+    // Objects between a bone and its parent bone have to be concatenated on the main thread
+    bool directChild = boneInfo.mCog->GetParent() == mBones[boneInfo.mParentIndex].mCog;
+    if (directChild && HasPlainLocalTransform(transform))
+      poses.AddBone(boneInfo.mParentIndex, transform->GetLocalTranslation(), transform->GetLocalRotation(), transform->GetLocalScale());
+    else
+      poses.AddBone(boneInfo.mParentIndex, bone->GetLocalTransform());
+  }
 
   mCachedVersion = version;
   return mCachedTransformRange;
 }
 
+//**************************************************************************************************
+bool Skeleton::HasPlainLocalTransform(Transform* transform)
+{
+  // Same as the check in Transform::GetParentRelativeMatrix
+  return transform->GetInWorld() == false || transform->GetParent() == nullptr;
+}
+
 //**************************************************************************************************
 void Skeleton::OnUpdateSkeletons(Event* event)
 {
@@ -355,4 +388,107 @@ float Skeleton::GetBoneRadius(BoneInfo& boneInfo)
   return radius;
 }
 
+//**************************************************************************************************
+struct SkeletonPoseTask
+{
+  void operator()(uint start, uint end)
+  {
+    mPoses->EvaluateSkeletons(start, end, *mSkinningBuffer);
+  }
+
+  SkeletonPoseBatch* mPoses;
+  Array<Mat4>* mSkinningBuffer;
+};
+
+//**************************************************************************************************
+void SkeletonPoseBatch::AddSkeleton(uint outputStart)
+{
+  SkeletonRange& range = mSkeletons.PushBack();
+  range.mBoneStart = mParentIndices.Size();
+  range.mBoneEnd = range.mBoneStart;
+  range.mOutputStart = outputStart;
+}
+
+//**************************************************************************************************
+void SkeletonPoseBatch::AddBone(int parentIndex, Vec3Param translation, QuatParam rotation, Vec3Param scale)
+{
+  SkeletonRange& range = mSkeletons.Back();
+  ErrorIf(parentIndex >= (int)(range.mBoneEnd - range.mBoneStart), "Parent bones must be added before their children.");
+  ++range.mBoneEnd;
+
+  mParentIndices.PushBack(parentIndex);
+  mTranslations.PushBack(translation);
+  mRotations.PushBack(rotation);
+  mScales.PushBack(scale);
+  mLocalMatrixIndices.PushBack(-1);
+}
+
+//**************************************************************************************************
+void SkeletonPoseBatch::AddBone(int parentIndex, Mat4Param localTransform)
+{
+  AddBone(parentIndex, Vec3::cZero, Quat::cIdentity, Vec3(1.0f));
+  mLocalMatrixIndices.Back() = (int)mLocalMatrices.Size();
+  mLocalMatrices.PushBack(localTransform);
+}
+
+//**************************************************************************************************
+void SkeletonPoseBatch::EvaluateSkeletons(uint skeletonStart, uint skeletonEnd, Array<Mat4>& skinningBuffer)
+{
+  // Mat4 rows are loaded into the columns of a SimMat4, so every matrix here is transposed
+  // and a bone's model matrix (parent * local) is computed as (local^T * parent^T)
+  for (uint i = skeletonStart; i < skeletonEnd; ++i)
+  {
+    SkeletonRange& range = mSkeletons[i];
+    Mat4* output = skinningBuffer.Data() + range.mOutputStart;
+
+    for (uint boneIndex = range.mBoneStart; boneIndex < range.mBoneEnd; ++boneIndex)
+    {
+      SimMat4 local;
+      int matrixIndex = mLocalMatrixIndices[boneIndex];
+      if (matrixIndex == -1)
+      {
+        Vec3& translation = mTranslations[boneIndex];
+        Vec3& scale = mScales[boneIndex];
+        SimVec simTranslation = Simd::Set3(translation.x, translation.y, translation.z);
+        SimVec simRotation = Simd::UnAlignedLoad(&mRotations[boneIndex].x);
+        SimVec simScale = Simd::Set3(scale.x, scale.y, scale.z);
+        local = Simd::Transpose4x4(Simd::BuildTransform(simTranslation, simRotation, simScale));
+      }
+      else
+      {
+        local = Simd::UnAlignedLoadMat4x4(mLocalMatrices[matrixIndex].array);
+      }
+
+      int parentIndex = mParentIndices[boneIndex];
+      if (parentIndex != -1)
+        local = Simd::Multiply(local, Simd::UnAlignedLoadMat4x4(output[parentIndex].array));
+
+      Simd::UnAlignedStoreMat4x4(output[boneIndex - range.mBoneStart].array, local);
+    }
+  }
+}
+
+//**************************************************************************************************
+void SkeletonPoseBatch::Evaluate(Array<Mat4>& skinningBuffer)
+{
+  SkeletonPoseTask task;
+  task.mPoses = this;
+  task.mSkinningBuffer = &skinningBuffer;
+  Z::gJobs->ParallelFor(0, mSkeletons.Size(), task, cMinSkeletonsPerTask);
+
+  Clear();
+}
+
+//**************************************************************************************************
+void SkeletonPoseBatch::Clear()
+{
+  mSkeletons.Clear();
+  mParentIndices.Clear();
+  mTranslations.Clear();
+  mRotations.Clear();
+  mScales.Clear();
+  mLocalMatrixIndices.Clear();
+  mLocalMatrices.Clear();
+}
+
 } // namespace Zero
@@ -55,6 +55,46 @@ public:
   Array<Cog*> mChildren;
 };
 
+//**************************************************************************************************
+// Poses of every Skeleton that a GraphicsSpace needs skinning matrices for in the current frame.
+// The bones of all the Skeletons are gathered on the main thread into one flat hierarchy of parent
+// indices and local transforms (parents always come before their children). The local to model
+// matrices of each Skeleton are then computed on the task workers straight into the slice of the
+// skinning buffer that was reserved for it, so no two tasks ever write the same matrices.
+class SkeletonPoseBatch
+{
+public:
+  // Starts a new Skeleton whose matrices go in the skinning buffer starting at outputStart
+  void AddSkeleton(uint outputStart);
+  // Parent index is relative to the current Skeleton, -1 for its root
+  void AddBone(int parentIndex, Vec3Param translation, QuatParam rotation, Vec3Param scale);
+  // For bones whose local transform is not only their own translation, rotation, and scale
+  void AddBone(int parentIndex, Mat4Param localTransform);
+
+  // Computes the matrices of the given Skeletons
+  void EvaluateSkeletons(uint skeletonStart, uint skeletonEnd, Array<Mat4>& skinningBuffer);
+  // Computes the matrices of every Skeleton across the task workers and clears the batch
+  void Evaluate(Array<Mat4>& skinningBuffer);
+  void Clear();
+
+  class SkeletonRange
+  {
+  public:
+    uint mBoneStart;
+    uint mBoneEnd;
+    uint mOutputStart;
+  };
+  Array<SkeletonRange> mSkeletons;
+
+  Array<int> mParentIndices;
+  Array<Vec3> mTranslations;
+  Array<Quat> mRotations;
+  Array<Vec3> mScales;
+  // Index into mLocalMatrices, or -1 if the bone's translation, rotation, and scale are used
+  Array<int> mLocalMatrixIndices;
+  Array<Mat4> mLocalMatrices;
+};
+
 /// Stores a map of Bones so that SkinnedModels can collect transform matrices for mesh skinning.
 class Skeleton : public Component
 {
@@ -73,12 +113,15 @@ public:
   void DebugDrawBone(BoneInfo& boneInfo, bool highlight);
   bool TestRay(GraphicsRayCast& raycast);
   void MarkModified();
-  IndexRange GetBoneTransforms(Array<Mat4>& skinningBuffer, uint version);
+  // Reserves this Skeleton's matrices in the skinning buffer and adds its bones to the batch,
+  // the matrices are not valid until the batch is evaluated
+  IndexRange GetBoneTransforms(SkeletonPoseBatch& poses, Array<Mat4>& skinningBuffer, uint version);
 
   void OnUpdateSkeletons(Event* event);
   void BuildSkeleton();
   void BuildSkeletonRecursive(Cog& cog, int parentIndex);
   float GetBoneRadius(BoneInfo& boneInfo);
+  static bool HasPlainLocalTransform(Transform* transform);
 
   Transform* mTransform;
   Array<BoneInfo> mBones;
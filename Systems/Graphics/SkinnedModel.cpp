@@ -118,7 +118,9 @@ void SkinnedModel::ExtractFrameData(FrameNode& frameNode, FrameBlock& frameBlock
   frameNode.mLocalToWorld = frameNode.mLocalToWorld * mMesh->mBindOffsetInv;
   frameNode.mLocalToWorldNormal = frameNode.mLocalToWorldNormal * Math::ToMatrix3(mMesh->mBindOffsetInv);
 
-  frameNode.mBoneMatrixRange = mSkeleton->GetBoneTransforms(skinningBuffer, frameBlock.mRenderQueues->mSkinningBufferVersion);
+  // Matrices are computed by the GraphicsSpace after every frame node has been extracted
+  uint version = frameBlock.mRenderQueues->mSkinningBufferVersion;
+  frameNode.mBoneMatrixRange = mSkeleton->GetBoneTransforms(mGraphicsSpace->mSkeletonPoses, skinningBuffer, version);
 
   frameNode.mIndexRemapRange.start = indexRemapBuffer.Size();
   indexRemapBuffer.Append(mBoneIndexRemap.All());
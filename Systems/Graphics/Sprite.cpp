@@ -110,7 +110,15 @@ void Sprite::Initialize(CogInitializer& initializer)
   mCurrentFrame = mStartFrame;
   mFrameTime = 0.0f;
 
-  ConnectThisTo(GetSpace(), Events::LogicUpdate, OnLogicUpdate);
+  // Advancing the animation only touches this sprite, so sprites update in parallel
+  GetSpace()->mUpdateLists.Add(this, UpdatePhase::Logic, ZeroUpdateFunction(Sprite, OnLogicUpdate), true);
+}
+
+//**************************************************************************************************
+void Sprite::OnDestroy(uint flags)
+{
+  GetSpace()->mUpdateLists.Remove(this, UpdatePhase::Logic, ZeroUpdateFunction(Sprite, OnLogicUpdate));
+  BaseSprite::OnDestroy(flags);
 }
 
 //**************************************************************************************************
@@ -633,7 +641,14 @@ void MultiSprite::Initialize(CogInitializer& initializer)
   mLocalAabb.SetCenterAndHalfExtents(Vec3::cZero, Vec3(0.5f));
   mFrameTime = 0;
 
-  ConnectThisTo(GetSpace(), Events::LogicUpdate, OnLogicUpdate);
+  GetSpace()->mUpdateLists.Add(this, UpdatePhase::Logic, ZeroUpdateFunction(MultiSprite, OnLogicUpdate), true);
+}
+
+//**************************************************************************************************
+void MultiSprite::OnDestroy(uint flags)
+{
+  GetSpace()->mUpdateLists.Remove(this, UpdatePhase::Logic, ZeroUpdateFunction(MultiSprite, OnLogicUpdate));
+  BaseSprite::OnDestroy(flags);
 }
 
 //**************************************************************************************************
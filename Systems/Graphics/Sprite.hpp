@@ -47,6 +47,7 @@ public:
 
   void Serialize(Serializer& stream) override;
   void Initialize(CogInitializer& initializer) override;
+  void OnDestroy(uint flags = 0) override;
   void DebugDraw() override;
 
   // Graphical Interface
@@ -208,6 +209,7 @@ public:
 
   void Serialize(Serializer& stream) override;
   void Initialize(CogInitializer& initializer) override;
+  void OnDestroy(uint flags = 0) override;
 
   // Graphical Interface
 
@@ -83,11 +83,18 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
   Vec3 emitterPos = mTransform->GetWorldTranslation();
 
   CheckSort(viewBlock);
-  Particle* particle = mParticleList.Particles;
+  bool sorted = !mSortedParticles.Empty();
 
-  while (particle != nullptr)
+  ParticleList& particles = mParticleList;
+  uint particleCount = particles.Size();
+  for (uint i = 0; i < particleCount; ++i)
   {
-    float particleWidth = particle->Size * 0.5f;
+    // Sorted particles are drawn in the order of their sort values
+    uint index = sorted ? (uint)mSortedParticles[i] : i;
+
+    Vec3 position = particles.GetPosition(index);
+    float rotation = particles.mRotation[index];
+    float particleWidth = particles.mSize[index] * 0.5f;
 
     Vec3 center, right, up;
 
@@ -95,10 +102,10 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
     {
       case SpriteParticleGeometryMode::Billboarded:
       {
-        float cosAngle = Math::Cos(particle->Rotation);
-        float sinAngle = Math::Sin(particle->Rotation);
+        float cosAngle = Math::Cos(rotation);
+        float sinAngle = Math::Sin(rotation);
 
-        center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
+        center = Math::TransformPoint(viewNode.mLocalToView, position);
         right = Vec3(cosAngle, sinAngle, 0) * particleWidth;
         up = Vec3(-sinAngle, cosAngle, 0) * particleWidth;
       }
@@ -106,10 +113,10 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
 
       case SpriteParticleGeometryMode::Beam:
       {
-        Vec3 velocityDir = Math::TransformNormal(viewNode.mLocalToView, particle->Velocity);
+        Vec3 velocityDir = Math::TransformNormal(viewNode.mLocalToView, particles.GetVelocity(index));
         float speed = velocityDir.AttemptNormalize();
 
-        center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
+        center = Math::TransformPoint(viewNode.mLocalToView, position);
         right = velocityDir * (speed * mBeamVelocityScale + mBeamBaseScale) * particleWidth;
         up = Cross(Vec3(0, 0, 1), velocityDir) * particleWidth;
       }
@@ -117,7 +124,7 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
 
       case SpriteParticleGeometryMode::Outward:
       {
-        Vec3 zAxis = particle->Position - emitterPos;
+        Vec3 zAxis = position - emitterPos;
         zAxis.AttemptNormalize();
 
         Vec3 xAxis, yAxis;
@@ -130,8 +137,8 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
         zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
         zAxis.AttemptNormalize();
 
-        center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-        right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
+        center = Math::TransformPoint(viewNode.mLocalToView, position);
+        right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
         up = Cross(zAxis, right) * particleWidth;
         right *= particleWidth;
       }
@@ -139,7 +146,7 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
 
       case SpriteParticleGeometryMode::FaceVelocity:
       {
-        Vec3 zAxis = particle->Velocity;
+        Vec3 zAxis = particles.GetVelocity(index);
         zAxis.AttemptNormalize();
 
         Vec3 xAxis, yAxis;
@@ -152,8 +159,8 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
         zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
         zAxis.AttemptNormalize();
 
-        center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-        right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
+        center = Math::TransformPoint(viewNode.mLocalToView, position);
+        right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
         up = Cross(zAxis, right) * particleWidth;
         right *= particleWidth;
       }
@@ -168,8 +175,8 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
         Vec3 yAxis = Math::TransformNormal(viewNode.mLocalToView, Vec3::cYAxis);
         yAxis.AttemptNormalize();
 
-        center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-        right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
+        center = Math::TransformPoint(viewNode.mLocalToView, position);
+        right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
         up = Cross(facing, right) * particleWidth;
         right *= particleWidth;
       }
@@ -192,35 +199,25 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
       // Update particle frame
       uint frame;
       if (mParticleAnimation == SpriteParticleAnimationMode::Single)
-        frame = (uint)(particle->Time / particle->Lifetime * (float)mSpriteSource->FrameCount);
+        frame = (uint)(particles.mTime[index] / particles.mLifetime[index] * (float)mSpriteSource->FrameCount);
       else
-        frame = (uint)(particle->Time / mSpriteSource->FrameDelay) % mSpriteSource->FrameCount;
+        frame = (uint)(particles.mTime[index] / mSpriteSource->FrameDelay) % mSpriteSource->FrameCount;
       uvRect = mSpriteSource->GetUvRect(frame);
     }
 
     Vec2 uv0 = uvRect.TopLeft;
     Vec2 uv1 = uvRect.BotRight;
 
-    Vec4 color = particle->Color * mVertexColor;
+    Vec4 color = particles.mColor[index] * mVertexColor;
 
     frameBlock.mRenderQueues->AddStreamedQuadView(viewNode, pos, uv0, uv1, color);
-
-    particle = particle->Next;
   }
 }
 
-struct ParticleSortInfo
+// The sort value is in the high bits and the particle's index in the low bits
+struct ParticleSortKey
 {
-  Particle* mParticle;
-  u32 mSortValue;
-};
-
-struct LocalSpriteSorter
-{
-  bool operator()(const ParticleSortInfo& lhs, const ParticleSortInfo& rhs)
-  {
-    return lhs.mSortValue < rhs.mSortValue;
-  }
+  u64 operator()(u64 sortInfo) const { return sortInfo; }
 };
 
 //**************************************************************************************************
@@ -250,56 +247,25 @@ u32 GetParticleSortValue(SpriteParticleSortMode::Enum sortMode, Vec3 pos, Vec3 c
 //**************************************************************************************************
 void SpriteParticleSystem::CheckSort(ViewBlock& viewBlock)
 {
-  Particle* particle = mParticleList.Particles;
+  mSortedParticles.Clear();
 
   // As long as we're in sort mode, and we have particles to be sorted...
-  if (mParticleSort == SpriteParticleSortMode::None || particle == nullptr)
+  if (mParticleSort == SpriteParticleSortMode::None || mParticleList.Empty())
     return;
 
-  // An array to store all sorted particles
-  Array<ParticleSortInfo> sortedParticles;
-
-  // Reserve space in the sorted particle array
-  sortedParticles.Reserve(mParticleList.mActiveParticles);
-
-  // Particle info for the sorter
-  ParticleSortInfo particleInfo;
-
   Vec3 cameraPos = viewBlock.mEyePosition;
   Vec3 cameraDir = viewBlock.mEyeDirection;
 
-  // Loop through all the particles
-  while (particle != nullptr)
+  // Pack every particle's sort value with its index, the particles themselves are never moved
+  uint particleCount = mParticleList.Size();
+  mSortedParticles.Resize(particleCount);
+  for (uint i = 0; i < particleCount; ++i)
   {
-    // Fill in the particle info and push it back
-    particleInfo.mParticle = particle;
-    particleInfo.mSortValue = GetParticleSortValue(mParticleSort, particle->Position, cameraPos, cameraDir);
-
-    // Push them into the array
-    sortedParticles.PushBack(particleInfo);
-
-    // Iterate to the next particle
-    particle = particle->Next;
+    u64 sortValue = GetParticleSortValue(mParticleSort, mParticleList.GetPosition(i), cameraPos, cameraDir);
+    mSortedParticles[i] = sortValue << 32 | i;
   }
 
-  // Sort the array
-  Sort(sortedParticles.All(), LocalSpriteSorter());
-
-  // Loop through all the sorted particles
-  for (size_t i = 0; i < (sortedParticles.Size() - 1); ++i)
-  {
-    // Re-point the particle's next pointer
-    sortedParticles[i].mParticle->Next = sortedParticles[i + 1].mParticle;
-  }
-
-  // Make sure we set the last particle in the array to point at null for its "next" pointer
-  sortedParticles.Back().mParticle->Next = nullptr;
-
-  // The particle list is now pointing to the front of our array
-  particle = sortedParticles.Front().mParticle;
-
-  // Since we resorted the list and actually modified the particles, we need to make sure we set the new head of the list
-  mParticleList.Particles = particle;
+  RadixSort(mSortedParticles, mSortScratch, ParticleSortKey());
 }
 
 } // namespace Zero
@@ -54,6 +54,10 @@ public:
   // Internal
 
   void CheckSort(ViewBlock& viewBlock);
+
+  // Sort value and index of every particle in draw order, empty when not sorting
+  Array<u64> mSortedParticles;
+  Array<u64> mSortScratch;
 };
 
 } // namespace Zero
@@ -0,0 +1,156 @@
+// Copyright 2017, DigiPen Institute of Technology
+
+#include "Precompiled.hpp"
+
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+
+namespace Zero
+{
+
+using Math::Simd::SimVec;
+namespace Simd = Math::Simd;
+
+//**************************************************************************************************
+void GraphicalBoundsArray::Add(Graphical* graphical, const Aabb& aabb)
+{
+  graphical->mBoundsIndex = mGraphicals.Size();
+  mGraphicals.PushBack(graphical);
+
+  // Always keep the float arrays padded to whole blocks so the simd loads never read past the end
+  uint paddedSize = GetBlockCount() * 4;
+  mCenterX.Resize(paddedSize, 0.0f);
+  mCenterY.Resize(paddedSize, 0.0f);
+  mCenterZ.Resize(paddedSize, 0.0f);
+  mHalfExtentX.Resize(paddedSize, 0.0f);
+  mHalfExtentY.Resize(paddedSize, 0.0f);
+  mHalfExtentZ.Resize(paddedSize, 0.0f);
+
+  Set(graphical->mBoundsIndex, aabb);
+}
+
+//**************************************************************************************************
+void GraphicalBoundsArray::Update(Graphical* graphical, const Aabb& aabb)
+{
+  ErrorIf(mGraphicals[graphical->mBoundsIndex] != graphical, "Graphical bounds index is invalid.");
+  Set(graphical->mBoundsIndex, aabb);
+}
+
+//**************************************************************************************************
+void GraphicalBoundsArray::Remove(Graphical* graphical)
+{
+  uint index = graphical->mBoundsIndex;
+  ErrorIf(mGraphicals[index] != graphical, "Graphical bounds index is invalid.");
+
+  uint lastIndex = mGraphicals.Size() - 1;
+  Graphical* last = mGraphicals[lastIndex];
+  mGraphicals[index] = last;
+  mCenterX[index] = mCenterX[lastIndex];
+  mCenterY[index] = mCenterY[lastIndex];
+  mCenterZ[index] = mCenterZ[lastIndex];
+  mHalfExtentX[index] = mHalfExtentX[lastIndex];
+  mHalfExtentY[index] = mHalfExtentY[lastIndex];
+  mHalfExtentZ[index] = mHalfExtentZ[lastIndex];
+  last->mBoundsIndex = index;
+
+  mGraphicals.PopBack();
+  graphical->mBoundsIndex = (uint)-1;
+
+  uint paddedSize = GetBlockCount() * 4;
+  mCenterX.Resize(paddedSize);
+  mCenterY.Resize(paddedSize);
+  mCenterZ.Resize(paddedSize);
+  mHalfExtentX.Resize(paddedSize);
+  mHalfExtentY.Resize(paddedSize);
+  mHalfExtentZ.Resize(paddedSize);
+}
+
+//**************************************************************************************************
+void GraphicalBoundsArray::CullFrustum(const Frustum& frustum, uint blockStart, uint blockEnd, Array<Graphical*>& visibleOut)
+{
+  // Same test as AabbFrustumApproximation (what the broad phase query uses): a box is outside
+  // if the corner furthest along any plane's normal is behind that plane
+  const Vec4* planes = frustum.GetIntersectionData();
+  SimVec normalX[Frustum::PlaneDim];
+  SimVec normalY[Frustum::PlaneDim];
+  SimVec normalZ[Frustum::PlaneDim];
+  SimVec absNormalX[Frustum::PlaneDim];
+  SimVec absNormalY[Frustum::PlaneDim];
+  SimVec absNormalZ[Frustum::PlaneDim];
+  SimVec distance[Frustum::PlaneDim];
+  for (uint i = 0; i < Frustum::PlaneDim; ++i)
+  {
+    normalX[i] = Simd::Set(planes[i].x);
+    normalY[i] = Simd::Set(planes[i].y);
+    normalZ[i] = Simd::Set(planes[i].z);
+    absNormalX[i] = Simd::Abs(normalX[i]);
+    absNormalY[i] = Simd::Abs(normalY[i]);
+    absNormalZ[i] = Simd::Abs(normalZ[i]);
+    distance[i] = Simd::Set(planes[i].w);
+  }
+
+  SimVec zero = Simd::ZeroOutVec();
+  uint size = mGraphicals.Size();
+
+  for (uint block = blockStart; block < blockEnd; ++block)
+  {
+    uint index = block * 4;
+    SimVec centerX = Simd::UnAlignedLoad(&mCenterX[index]);
+    SimVec centerY = Simd::UnAlignedLoad(&mCenterY[index]);
+    SimVec centerZ = Simd::UnAlignedLoad(&mCenterZ[index]);
+    SimVec halfX = Simd::UnAlignedLoad(&mHalfExtentX[index]);
+    SimVec halfY = Simd::UnAlignedLoad(&mHalfExtentY[index]);
+    SimVec halfZ = Simd::UnAlignedLoad(&mHalfExtentZ[index]);
+
+    SimVec outside = zero;
+    for (uint i = 0; i < Frustum::PlaneDim; ++i)
+    {
+      // dot(center, normal) + dot(halfExtents, abs(normal)) - d
+      SimVec signedDistance = Simd::Multiply(centerX, normalX[i]);
+      signedDistance = Simd::MultiplyAdd(centerY, normalY[i], signedDistance);
+      signedDistance = Simd::MultiplyAdd(centerZ, normalZ[i], signedDistance);
+      signedDistance = Simd::MultiplyAdd(halfX, absNormalX[i], signedDistance);
+      signedDistance = Simd::MultiplyAdd(halfY, absNormalY[i], signedDistance);
+      signedDistance = Simd::MultiplyAdd(halfZ, absNormalZ[i], signedDistance);
+      signedDistance = Simd::Subtract(signedDistance, distance[i]);
+      outside = Simd::OrVec(outside, Simd::Less(signedDistance, zero));
+    }
+
+    // Every lane that was never outside a plane is visible (padding lanes past the end are skipped)
+    int visibleMask = ~_mm_movemask_ps(outside) & 0xF;
+    for (uint lane = 0; visibleMask != 0; ++lane, visibleMask >>= 1)
+    {
+      if ((visibleMask & 1) && index + lane < size)
+        visibleOut.PushBack(mGraphicals[index + lane]);
+    }
+  }
+}
+
+//**************************************************************************************************
+void GraphicalBoundsArray::Set(uint index, const Aabb& aabb)
+{
+  Vec3 center, halfExtents;
+  aabb.GetCenterAndHalfExtents(center, halfExtents);
+  mCenterX[index] = center.x;
+  mCenterY[index] = center.y;
+  mCenterZ[index] = center.z;
+  mHalfExtentX[index] = halfExtents.x;
+  mHalfExtentY[index] = halfExtents.y;
+  mHalfExtentZ[index] = halfExtents.z;
+}
+
+//**************************************************************************************************
+void VisibilityBuffer::Clear(uint renderGroupCount)
+{
+  // Only clear the arrays so they keep their memory for the next camera
+  mVisible.Clear();
+  mQueryEntries.Clear();
+  mEntries.Clear();
+  mOccludedCount = 0;
+
+  mGroupCounts.Resize(renderGroupCount);
+  for (uint i = 0; i < renderGroupCount; ++i)
+    mGroupCounts[i] = 0;
+}
+
+} // namespace Zero
@@ -0,0 +1,60 @@
+// Copyright 2017, DigiPen Institute of Technology
+
+#pragma once
+
+namespace Zero
+{
+
+//**************************************************************************************************
+// Bounds of every view culled Graphical in a space. Kept as a flat structure of arrays (center and
+// half extents per axis) so that the frustum can be tested against four Graphicals at a time.
+// The bounds are the same fat aabbs that are stored in the broad phase.
+class GraphicalBoundsArray
+{
+public:
+  void Add(Graphical* graphical, const Aabb& aabb);
+  void Update(Graphical* graphical, const Aabb& aabb);
+  // Swaps the last Graphical into the removed Graphical's place
+  void Remove(Graphical* graphical);
+
+  uint Size() { return mGraphicals.Size(); }
+  // Number of groups of four bounds, the last group may be partially filled
+  uint GetBlockCount() { return (mGraphicals.Size() + 3) / 4; }
+
+  // Appends every Graphical in the given blocks that overlaps the frustum
+  void CullFrustum(const Frustum& frustum, uint blockStart, uint blockEnd, Array<Graphical*>& visibleOut);
+
+  Array<Graphical*> mGraphicals;
+  Array<float> mCenterX;
+  Array<float> mCenterY;
+  Array<float> mCenterZ;
+  Array<float> mHalfExtentX;
+  Array<float> mHalfExtentY;
+  Array<float> mHalfExtentZ;
+
+private:
+  void Set(uint index, const Aabb& aabb);
+};
+
+//**************************************************************************************************
+// Everything one task worker finds visible for a camera. Entries of every RenderGroup are kept
+// together since the merged entries are sorted into their RenderGroups in one radix sort.
+// Buffers are kept between frames so nothing is allocated per Graphical once they have grown.
+class VisibilityBuffer
+{
+public:
+  void Clear(uint renderGroupCount);
+
+  // View culled Graphicals that passed the frustum test
+  Array<Graphical*> mVisible;
+  // Entries of every RenderGroup in the order they were made
+  Array<GraphicalEntry> mEntries;
+  // How many of the entries belong to each RenderGroup, indexed by RenderGroup sort id
+  Array<uint> mGroupCounts;
+  // Scratch array given to MidPhaseQuery
+  Array<GraphicalEntry> mQueryEntries;
+  // How many Graphicals were skipped for being occluded
+  uint mOccludedCount;
+};
+
+} // namespace Zero
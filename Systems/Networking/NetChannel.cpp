@@ -410,6 +410,8 @@ ZilchDefineType(NetChannelType, builder, type)
   ZilchBindGetterSetterProperty(ReliabilityMode);
   ZilchBindGetterSetterProperty(TransferMode);
   ZilchBindGetterSetterProperty(AccurateTimestampOnChange);
+  ZilchBindGetterSetterProperty(Priority);
+  ZilchBindGetterSetterProperty(DeltaCompression);
 }
 
 NetChannelType::NetChannelType(const String& name)
@@ -449,6 +451,7 @@ void NetChannelType::ResetConfig()
     SetReplicateOnOffline();
     SetSerializationMode();
     SetTransferMode();
+    SetDeltaCompression();
   }
 
   // Set runtime config options
@@ -463,6 +466,7 @@ void NetChannelType::ResetConfig()
   SetDetectionMode();
   SetReliabilityMode();
   SetAccurateTimestampOnChange();
+  SetPriority();
 }
 
 void NetChannelType::SetConfig(NetChannelConfig* netChannelConfig)
@@ -479,6 +483,7 @@ void NetChannelType::SetConfig(NetChannelConfig* netChannelConfig)
     SetReplicateOnOffline(netChannelConfig->mReplicateOnOffline);
     SetSerializationMode(netChannelConfig->mSerializationMode);
     SetTransferMode(netChannelConfig->mTransferMode);
+    SetDeltaCompression(netChannelConfig->mDeltaCompression);
   }
 
   // Set runtime config options
@@ -493,6 +498,7 @@ void NetChannelType::SetConfig(NetChannelConfig* netChannelConfig)
   SetDetectionMode(netChannelConfig->mDetectionMode);
   SetReliabilityMode(netChannelConfig->mReliabilityMode);
   SetAccurateTimestampOnChange(netChannelConfig->mAccurateTimestampOnChange);
+  SetPriority(netChannelConfig->mPriority);
 }
 
 void NetChannelType::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -751,6 +757,32 @@ bool NetChannelType::GetAccurateTimestampOnChange() const
   return ReplicaChannelType::GetAccurateTimestampOnChange();
 }
 
+void NetChannelType::SetPriority(float priority)
+{
+  ReplicaChannelType::SetPriority(priority);
+}
+float NetChannelType::GetPriority() const
+{
+  return ReplicaChannelType::GetPriority();
+}
+
+void NetChannelType::SetDeltaCompression(bool deltaCompression)
+{
+  // Already valid?
+  if(ReplicaChannelType::IsValid())
+  {
+    // Unable to modify configuration
+    DoNotifyError("NetChannelType", "Unable to modify this NetChannelType configuration option at game runtime");
+    return;
+  }
+
+  ReplicaChannelType::SetDeltaCompression(deltaCompression);
+}
+bool NetChannelType::GetDeltaCompression() const
+{
+  return ReplicaChannelType::GetDeltaCompression();
+}
+
 //---------------------------------------------------------------------------------//
 //                              NetChannelConfig                                   //
 //---------------------------------------------------------------------------------//
@@ -786,6 +818,8 @@ ZilchDefineType(NetChannelConfig, builder, type)
   ZilchBindFieldProperty(mReliabilityMode);
   ZilchBindFieldProperty(mTransferMode);
   ZilchBindFieldProperty(mAccurateTimestampOnChange);
+  ZilchBindFieldProperty(mPriority);
+  ZilchBindFieldProperty(mDeltaCompression);
 }
 
 void NetChannelConfig::Serialize(Serializer& stream)
@@ -810,6 +844,8 @@ void NetChannelConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(ReliabilityMode, mReliabilityMode, ReliabilityMode::Reliable);
   SerializeEnumNameDefault(TransferMode, mTransferMode, TransferMode::Ordered);
   SerializeNameDefault(mAccurateTimestampOnChange, false);
+  SerializeNameDefault(mPriority, 1.0f);
+  SerializeNameDefault(mDeltaCompression, false);
 }
 
 //
@@ -253,6 +253,17 @@ public:
   /// (This setting may be overridden for net channels belonging to a specific net object by enabling the corresponding net object setting)
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
+
+  /// Controls how much priority net channel changes accumulate every frame they wait to be sent, relative to other net channel types.
+  /// (Only used when the net peer prioritizes changes)
+  void SetPriority(float priority = 1);
+  float GetPriority() const;
+
+  /// Controls whether or not net channel changes are delta compressed against the last change each link acknowledged.
+  /// Best suited to unreliable net channels whose net properties change by small amounts every frame.
+  /// (Cannot be modified at game runtime)
+  void SetDeltaCompression(bool deltaCompression = false);
+  bool GetDeltaCompression() const;
 };
 
 //---------------------------------------------------------------------------------//
@@ -362,6 +373,14 @@ public:
   /// Controls whether or not the net channel will serialize an accurate timestamp value when changed, or will instead accept an estimated timestamp value.
   /// (This setting may be overridden for net channels belonging to a specific net object by enabling the corresponding net object setting)
   bool mAccurateTimestampOnChange;
+
+  /// Controls how much priority net channel changes accumulate every frame they wait to be sent, relative to other net channel types.
+  /// (Only used when the net peer prioritizes changes)
+  float mPriority;
+
+  /// Controls whether or not net channel changes are delta compressed against the last change each link acknowledged.
+  /// Best suited to unreliable net channels whose net properties change by small amounts every frame.
+  bool mDeltaCompression;
 };
 
 //---------------------------------------------------------------------------------//
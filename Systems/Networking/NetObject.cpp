@@ -42,6 +42,7 @@ ZilchDefineType(NetObject, builder, type)
   ZilchBindGetterSetterProperty(DetectOutgoingChanges);
   ZilchBindGetterSetterProperty(AcceptIncomingChanges);
   ZilchBindGetterSetterProperty(AllowNapping);
+  ZilchBindGetterSetterProperty(AlwaysRelevant);
   ZilchBindGetterSetterProperty(AccurateTimestampOnOnline);
   ZilchBindGetterSetterProperty(AccurateTimestampOnChange);
   ZilchBindGetterSetterProperty(AccurateTimestampOnOffline);
@@ -133,6 +134,9 @@ void NetObject::Serialize(Serializer& stream)
   SerializeNameDefault(mDetectOutgoingChanges, GetDetectOutgoingChanges());
   SerializeNameDefault(mAcceptIncomingChanges, GetAcceptIncomingChanges());
   SerializeNameDefault(mAllowNapping, GetAllowNapping());
+  bool alwaysRelevant = GetAlwaysRelevant();
+  stream.SerializeFieldDefault("AlwaysRelevant", alwaysRelevant, false);
+  SetAlwaysRelevant(alwaysRelevant);
   stream.SerializeFieldDefault("AccurateTimestampOnOnline", mAccurateTimestampOnInitialization, accurateTimestampsByDefault);
   SerializeNameDefault(mAccurateTimestampOnChange, accurateTimestampsByDefault);
   stream.SerializeFieldDefault("AccurateTimestampOnOffline", mAccurateTimestampOnUninitialization, accurateTimestampsByDefault);
@@ -1154,6 +1158,7 @@ void NetObject::ResetConfig()
   SetDetectOutgoingChanges();
   SetAcceptIncomingChanges();
   SetAllowNapping();
+  SetAlwaysRelevant();
   SetAccurateTimestampOnOnline();
   SetAccurateTimestampOnChange();
   SetAccurateTimestampOnOffline();
@@ -1186,6 +1191,15 @@ bool NetObject::GetAllowNapping() const
   return Replica::GetAllowNapping();
 }
 
+void NetObject::SetAlwaysRelevant(bool alwaysRelevant)
+{
+  Replica::SetInterestMode(alwaysRelevant ? InterestMode::Always : InterestMode::Spatial);
+}
+bool NetObject::GetAlwaysRelevant() const
+{
+  return Replica::GetInterestMode() == InterestMode::Always;
+}
+
 void NetObject::SetAccurateTimestampOnOnline(bool accurateTimestampOnOnline)
 {
   Replica::SetAccurateTimestampOnInitialization(accurateTimestampOnOnline);
@@ -133,6 +133,10 @@ public:
   void SetAllowNapping(bool allowNapping = true);
   bool GetAllowNapping() const;
 
+  /// Controls whether or not the net object is relevant to every client when the net peer uses interest management, regardless of its position.
+  void SetAlwaysRelevant(bool alwaysRelevant = false);
+  bool GetAlwaysRelevant() const;
+
   /// Controls whether or not the net object will serialize an accurate timestamp value when brought online, or will instead accept an estimated timestamp value.
   void SetAccurateTimestampOnOnline(bool accurateTimestampOnOnline = false);
   bool GetAccurateTimestampOnOnline() const;
@@ -82,6 +82,10 @@ ZilchDefineType(NetPeer, builder, type)
   ZilchBindGetterProperty(NetSpaceCount)->Add(new EditInGameFilter);
   ZilchBindGetterSetterProperty(FrameFillWarning);
   ZilchBindGetterSetterProperty(FrameFillSkip);
+  ZilchBindGetterSetterProperty(InterestManagement);
+  ZilchBindGetterSetterProperty(InterestCellSize);
+  ZilchBindGetterSetterProperty(InterestHysteresis);
+  ZilchBindGetterSetterProperty(PrioritizeChanges);
 
   // Bind link interface
   ZilchBindGetterProperty(LinkCount)->Add(new EditInGameFilter);
@@ -104,6 +108,8 @@ ZilchDefineType(NetPeer, builder, type)
   ZilchBindMethod(GetOurIpAddressFromLink);
   ZilchBindMethod(GetLinkInternetProtocol);
   ZilchBindMethod(GetLinkNetPeerId);
+  ZilchBindMethod(AddLinkInterestVolume);
+  ZilchBindMethod(ClearLinkInterestVolumes);
 
   // Bind user interface
   ZilchBindOverloadedMethod(AddUser, ZilchInstanceOverload(bool, EventBundle*));
@@ -193,6 +199,10 @@ void NetPeer::ResetConfig()
   // Peer settings
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetInterestManagement();
+  SetInterestCellSize();
+  SetInterestHysteresis();
+  SetPrioritizeChanges();
 
   // Timeout settings
   SetInternetHostListTimeout();
@@ -233,6 +243,12 @@ void NetPeer::Serialize(Serializer& stream)
   // Serialize peer settings
   SerializeNameDefault(mFrameFillWarning, GetFrameFillWarning());
   SerializeNameDefault(mFrameFillSkip, GetFrameFillSkip());
+  SerializeNameDefault(mInterestManagement, GetInterestManagement());
+  float interestCellSize = GetInterestCellSize();
+  stream.SerializeFieldDefault("InterestCellSize", interestCellSize, 32.0f);
+  SetInterestCellSize(interestCellSize);
+  SerializeNameDefault(mInterestHysteresis, GetInterestHysteresis());
+  SerializeNameDefault(mPrioritizeChanges, GetPrioritizeChanges());
 
   // Serialize peer timeouts
   SerializeNameDefault(mInternetHostListTimeout, GetInternetHostListTimeout());
@@ -1254,6 +1270,42 @@ float NetPeer::GetFrameFillSkip() const
   return Replicator::GetFrameFillSkip();
 }
 
+void NetPeer::SetInterestManagement(bool interestManagement)
+{
+  Replicator::SetInterestManagement(interestManagement);
+}
+bool NetPeer::GetInterestManagement() const
+{
+  return Replicator::GetInterestManagement();
+}
+
+void NetPeer::SetInterestCellSize(float interestCellSize)
+{
+  Replicator::SetInterestCellSize(interestCellSize);
+}
+float NetPeer::GetInterestCellSize() const
+{
+  return Replicator::GetInterestCellSize();
+}
+
+void NetPeer::SetInterestHysteresis(float interestHysteresis)
+{
+  Replicator::SetInterestHysteresis(interestHysteresis);
+}
+float NetPeer::GetInterestHysteresis() const
+{
+  return Replicator::GetInterestHysteresis();
+}
+
+void NetPeer::SetPrioritizeChanges(bool prioritizeChanges)
+{
+  Replicator::SetPrioritizeChanges(prioritizeChanges);
+}
+bool NetPeer::GetPrioritizeChanges() const
+{
+  return Replicator::GetPrioritizeChanges();
+}
+
 //
 // Link Interface
 //
@@ -1520,6 +1572,41 @@ NetPeerId NetPeer::GetLinkNetPeerId(const IpAddress& ipAddress) const
   return link->GetPlugin<ReplicatorLink>("ReplicatorLink")->GetReplicatorId().value();
 }
 
+bool NetPeer::AddLinkInterestVolume(NetPeerId netPeerId, Space* space, Real3 center, float radius)
+{
+  // Get network link
+  PeerLink* link = GetLink(netPeerId);
+  if(!link) // Unable?
+    return false;
+
+  // Get net space
+  NetSpace* netSpace = space ? space->has(NetSpace) : nullptr;
+  if(!netSpace || !netSpace->IsOnline()) // Unable?
+  {
+    DoNotifyWarning("Unable to add link interest volume", "Space must be an online net space");
+    return false;
+  }
+
+  // Add interest volume
+  link->GetPlugin<ReplicatorLink>("ReplicatorLink")->AddInterestVolume(InterestVolume(netSpace->GetReplicaId(), center, radius));
+
+  // Success
+  return true;
+}
+bool NetPeer::ClearLinkInterestVolumes(NetPeerId netPeerId)
+{
+  // Get network link
+  PeerLink* link = GetLink(netPeerId);
+  if(!link) // Unable?
+    return false;
+
+  // Clear interest volumes
+  link->GetPlugin<ReplicatorLink>("ReplicatorLink")->ClearInterestVolumes();
+
+  // Success
+  return true;
+}
+
 //
 // User Interface
 //
@@ -3693,6 +3780,11 @@ bool NetPeer::DispatchBroadcastInternal(StringParam netEventId, Event* netEvent,
     return false;
   }
 
+  // Create network event message
+  // (Shared between all links, each link's copy references the same data instead of copying it)
+  Message netEventMessage(NetPeerMessageType::NetEvent, bitStream);
+  netEventMessage.ShareData();
+
   // Get links
   PeerLinkSet links = Replicator::GetLinks();
   bool result = links.Empty();
@@ -3702,9 +3794,6 @@ bool NetPeer::DispatchBroadcastInternal(StringParam netEventId, Event* netEvent,
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
-    // Create network event message
-    Message netEventMessage(NetPeerMessageType::NetEvent, bitStream);
-
     // Send network event message
     Status linkSendStatus;
     replicatorLink->Send(status, netEventMessage);
@@ -4299,6 +4388,45 @@ bool NetPeer::ReleaseReplicas(const ReplicaArray& replicas)
   return true;
 }
 
+bool NetPeer::GetReplicaInterestPosition(Replica* replica, ReplicaId& space, Vector3& position)
+{
+  // Convert to net object
+  NetObject* netObject = static_cast<NetObject*>(replica);
+
+  // Net peer or net space?
+  // (These must exist on every client)
+  if(netObject->IsNetPeer() || netObject->IsNetSpace())
+    return false;
+
+  // Part of a family tree?
+  // (Family trees are cloned and destroyed as a whole)
+  if(netObject->GetFamilyTreeId() != 0)
+    return false;
+
+  // Get cog
+  Cog* cog = netObject->GetOwner();
+
+  // Part of a hierarchy?
+  if(cog->GetParent())
+    return false;
+
+  // Get transform
+  Transform* transform = cog->has(Transform);
+  if(!transform) // Unable?
+    return false;
+
+  // Get net space
+  // (Volumes and positions are only compared within the same net space)
+  NetSpace* netSpace = cog->GetSpace()->has(NetSpace);
+  if(!netSpace) // Unable?
+    return false;
+
+  // Success
+  space    = netSpace->GetReplicaId();
+  position = transform->GetWorldTranslation();
+  return true;
+}
+
 void NetPeer::OnValidReplica(Replica* replica)
 {
   // Get net object
@@ -248,6 +248,28 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls whether or not spawned net objects are only replicated to the clients they are relevant to.
+  /// Relevant net objects are cloned to a client as they enter one of its interest volumes and destroyed on that client as they leave.
+  /// (Net objects without a Transform, net objects in a family tree, and net objects set to always relevant are relevant to every client)
+  void SetInterestManagement(bool interestManagement = false);
+  bool GetInterestManagement() const;
+
+  /// [Server] Controls the cell size of the spatial index used for interest management.
+  /// (Should be about the size of the smallest interest volume)
+  void SetInterestCellSize(float interestCellSize = 32);
+  float GetInterestCellSize() const;
+
+  /// [Server] Controls how far outside of all of a client's interest volumes a net object must be before it's destroyed on that client.
+  void SetInterestHysteresis(float interestHysteresis = 8);
+  float GetInterestHysteresis() const;
+
+  /// Controls whether or not net channel changes are scheduled by priority instead of sent immediately.
+  /// Waiting changes accumulate priority every frame (see NetChannelConfig::Priority, scaled down by distance from the client's interest volumes),
+  /// and the highest priority changes are sent until the link's frame fill skip threshold is reached.
+  /// Changes that don't fit keep accumulating priority until they are sent, instead of being skipped.
+  void SetPrioritizeChanges(bool prioritizeChanges = false);
+  bool GetPrioritizeChanges() const;
+
   //
   // Link Interface
   //
@@ -336,6 +358,14 @@ public:
   /// [Client] This will always be zero.
   NetPeerId GetLinkNetPeerId(const IpAddress& ipAddress) const;
 
+  /// [Server] Adds a sphere of the specified net space the client is interested in (used when interest management is enabled).
+  /// Only net objects in the same net space are relevant to the volume.
+  /// Returns true if successful, else false.
+  bool AddLinkInterestVolume(NetPeerId netPeerId, Space* space, Real3 center, float radius);
+  /// [Server] Removes all of the client's interest volumes (making every net object relevant to it again).
+  /// Returns true if successful, else false.
+  bool ClearLinkInterestVolumes(NetPeerId netPeerId);
+
   //
   // User Interface
   //
@@ -641,6 +671,10 @@ public:
   /// Returns true if successful, else false.
   bool ReleaseReplicas(const ReplicaArray& replicas) override;
 
+  /// Gets the world translation of the net object used for interest management.
+  /// Returns true if successful, else false (net objects without a position are always relevant).
+  bool GetReplicaInterestPosition(Replica* replica, ReplicaId& space, Vector3& position) override;
+
   /// Called before a replica is made valid (registered with the replicator).
   void OnValidReplica(Replica* replica) override;
   /// Called after a replica is made live (assigned a replica ID by the server replicator).
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+#include "Math/SimMath.hpp"
+#include "Math/SimVectors.hpp"
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+using Math::Simd::SimVec;
+namespace Simd = Math::Simd;
+
+const uint cSimdWidth = 4;
+
+//-------------------------------------------------------------------SoaVec3Array
+void SoaVec3Array::Resize(uint size)
+{
+  mX.Resize(size, real(0.0));
+  mY.Resize(size, real(0.0));
+  mZ.Resize(size, real(0.0));
+}
+
+void SoaVec3Array::Clear()
+{
+  mX.Clear();
+  mY.Clear();
+  mZ.Clear();
+}
+
+void SoaVec3Array::Set(uint index, Vec3Param value)
+{
+  mX[index] = value.x;
+  mY[index] = value.y;
+  mZ[index] = value.z;
+}
+
+Vec3 SoaVec3Array::Get(uint index) const
+{
+  return Vec3(mX[index], mY[index], mZ[index]);
+}
+
+//-------------------------------------------------------------------BodyIntegrationBatch
+void BodyIntegrationBatch::AddVelocityBody(RigidBody* body, real dt)
+{
+  // Deal with the case of applying velocity outside of 2d mode that isn't
+  // handled by the mass being zeroed (see Integration::IntegrateVelocity).
+  if(body->mState.IsSet(RigidBodyStates::Mode2D))
+  {
+    body->mVelocity.z = real(0.0);
+    body->mAngularVelocity.x = real(0.0);
+    body->mAngularVelocity.y = real(0.0);
+  }
+
+  body->mVelocityOld = body->mVelocity;
+  body->mAngularVelocityOld = body->mAngularVelocity;
+
+  uint index = AddBody(body);
+  mVelocity.Set(index, body->mVelocity);
+  mAngularVelocity.Set(index, body->mAngularVelocity);
+  mForce.Set(index, body->mForceAccumulator);
+  mInvMass.Set(index, body->mInvMass.GetInvMasses());
+  mTorque.Set(index, body->mTorqueAccumulator);
+  mGyroscopic.Set(index, SolveGyroscopic(body, dt));
+
+  Mat3 invInertia = body->mInvInertia.GetInvWorldTensor();
+  mInvInertiaRow0.Set(index, Vec3(invInertia.m00, invInertia.m01, invInertia.m02));
+  mInvInertiaRow1.Set(index, Vec3(invInertia.m10, invInertia.m11, invInertia.m12));
+  mInvInertiaRow2.Set(index, Vec3(invInertia.m20, invInertia.m21, invInertia.m22));
+}
+
+void BodyIntegrationBatch::IntegrateVelocities(real dt, real maxVelocity)
+{
+  uint size = PadToSimdWidth();
+
+  SimVec dtVec = Simd::Set(dt);
+  SimVec maxVec = Simd::Set(maxVelocity);
+  SimVec minVec = Simd::Set(-maxVelocity);
+
+  for(uint i = 0; i < size; i += cSimdWidth)
+  {
+    // v += invMass * force * dt
+    SimVec vx = Simd::UnAlignedLoad(&mVelocity.mX[i]);
+    SimVec vy = Simd::UnAlignedLoad(&mVelocity.mY[i]);
+    SimVec vz = Simd::UnAlignedLoad(&mVelocity.mZ[i]);
+    SimVec ax = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mX[i]), Simd::UnAlignedLoad(&mForce.mX[i]));
+    SimVec ay = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mY[i]), Simd::UnAlignedLoad(&mForce.mY[i]));
+    SimVec az = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mZ[i]), Simd::UnAlignedLoad(&mForce.mZ[i]));
+    vx = Simd::MultiplyAdd(ax, dtVec, vx);
+    vy = Simd::MultiplyAdd(ay, dtVec, vy);
+    vz = Simd::MultiplyAdd(az, dtVec, vz);
+
+    // w += invInertia * torque * dt + gyroscopic
+    SimVec tx = Simd::UnAlignedLoad(&mTorque.mX[i]);
+    SimVec ty = Simd::UnAlignedLoad(&mTorque.mY[i]);
+    SimVec tz = Simd::UnAlignedLoad(&mTorque.mZ[i]);
+    SimVec alphaX = Simd::Multiply(Simd::UnAlignedLoad(&mInvInertiaRow0.mX[i]), tx);
+    alphaX = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow0.mY[i]), ty, alphaX);
+    alphaX = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow0.mZ[i]), tz, alphaX);
+    SimVec alphaY = Simd::Multiply(Simd::UnAlignedLoad(&mInvInertiaRow1.mX[i]), tx);
+    alphaY = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow1.mY[i]), ty, alphaY);
+    alphaY = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow1.mZ[i]), tz, alphaY);
+    SimVec alphaZ = Simd::Multiply(Simd::UnAlignedLoad(&mInvInertiaRow2.mX[i]), tx);
+    alphaZ = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow2.mY[i]), ty, alphaZ);
+    alphaZ = Simd::MultiplyAdd(Simd::UnAlignedLoad(&mInvInertiaRow2.mZ[i]), tz, alphaZ);
+
+    SimVec wx = Simd::Add(Simd::UnAlignedLoad(&mAngularVelocity.mX[i]), Simd::UnAlignedLoad(&mGyroscopic.mX[i]));
+    SimVec wy = Simd::Add(Simd::UnAlignedLoad(&mAngularVelocity.mY[i]), Simd::UnAlignedLoad(&mGyroscopic.mY[i]));
+    SimVec wz = Simd::Add(Simd::UnAlignedLoad(&mAngularVelocity.mZ[i]), Simd::UnAlignedLoad(&mGyroscopic.mZ[i]));
+    wx = Simd::MultiplyAdd(alphaX, dtVec, wx);
+    wy = Simd::MultiplyAdd(alphaY, dtVec, wy);
+    wz = Simd::MultiplyAdd(alphaZ, dtVec, wz);
+
+    // Clamp to max velocity values to avoid bad floating point values (exceptions in particular)
+    Simd::UnAlignedStore(Simd::Clamp(vx, minVec, maxVec), &mVelocity.mX[i]);
+    Simd::UnAlignedStore(Simd::Clamp(vy, minVec, maxVec), &mVelocity.mY[i]);
+    Simd::UnAlignedStore(Simd::Clamp(vz, minVec, maxVec), &mVelocity.mZ[i]);
+    Simd::UnAlignedStore(Simd::Clamp(wx, minVec, maxVec), &mAngularVelocity.mX[i]);
+    Simd::UnAlignedStore(Simd::Clamp(wy, minVec, maxVec), &mAngularVelocity.mY[i]);
+    Simd::UnAlignedStore(Simd::Clamp(wz, minVec, maxVec), &mAngularVelocity.mZ[i]);
+  }
+}
+
+void BodyIntegrationBatch::CommitVelocities()
+{
+  for(uint i = 0; i < mBodies.Size(); ++i)
+  {
+    RigidBody* body = mBodies[i];
+    body->mVelocity = mVelocity.Get(i);
+    body->mAngularVelocity = mAngularVelocity.Get(i);
+  }
+  Clear();
+}
+
+void BodyIntegrationBatch::AddPositionBody(RigidBody* body)
+{
+  uint index = AddBody(body);
+  mVelocity.Set(index, body->mVelocity);
+  mAngularVelocity.Set(index, body->mAngularVelocity);
+  mForce.Set(index, body->mForceAccumulator);
+  mInvMass.Set(index, body->mInvMass.GetInvMasses());
+
+  Quat rotation = body->GetWorldRotationQuat();
+  mRotationV.Set(index, Vec3(rotation.x, rotation.y, rotation.z));
+  mRotationW[index] = rotation.w;
+}
+
+void BodyIntegrationBatch::IntegratePositions(real dt)
+{
+  uint size = PadToSimdWidth();
+
+  SimVec dtVec = Simd::Set(dt);
+  SimVec halfDtVec = Simd::Set(dt * real(0.5));
+
+  // The results are written over the velocity and rotation arrays: the
+  // velocity becomes the translation offset and the rotation becomes the
+  // (small angle approximation) rotation offset.
+  for(uint i = 0; i < size; i += cSimdWidth)
+  {
+    // offset = (v + invMass * force * dt / 2) * dt
+    SimVec vx = Simd::UnAlignedLoad(&mVelocity.mX[i]);
+    SimVec vy = Simd::UnAlignedLoad(&mVelocity.mY[i]);
+    SimVec vz = Simd::UnAlignedLoad(&mVelocity.mZ[i]);
+    SimVec ax = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mX[i]), Simd::UnAlignedLoad(&mForce.mX[i]));
+    SimVec ay = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mY[i]), Simd::UnAlignedLoad(&mForce.mY[i]));
+    SimVec az = Simd::Multiply(Simd::UnAlignedLoad(&mInvMass.mZ[i]), Simd::UnAlignedLoad(&mForce.mZ[i]));
+    vx = Simd::Multiply(Simd::MultiplyAdd(ax, halfDtVec, vx), dtVec);
+    vy = Simd::Multiply(Simd::MultiplyAdd(ay, halfDtVec, vy), dtVec);
+    vz = Simd::Multiply(Simd::MultiplyAdd(az, halfDtVec, vz), dtVec);
+    Simd::UnAlignedStore(vx, &mVelocity.mX[i]);
+    Simd::UnAlignedStore(vy, &mVelocity.mY[i]);
+    Simd::UnAlignedStore(vz, &mVelocity.mZ[i]);
+
+    // offset = (Quat(w, 0) * rotation) * dt / 2
+    SimVec wx = Simd::UnAlignedLoad(&mAngularVelocity.mX[i]);
+    SimVec wy = Simd::UnAlignedLoad(&mAngularVelocity.mY[i]);
+    SimVec wz = Simd::UnAlignedLoad(&mAngularVelocity.mZ[i]);
+    SimVec qx = Simd::UnAlignedLoad(&mRotationV.mX[i]);
+    SimVec qy = Simd::UnAlignedLoad(&mRotationV.mY[i]);
+    SimVec qz = Simd::UnAlignedLoad(&mRotationV.mZ[i]);
+    SimVec qw = Simd::UnAlignedLoad(&mRotationW[i]);
+
+    SimVec rx = Simd::Multiply(wx, qw);
+    rx = Simd::MultiplyAdd(wy, qz, rx);
+    rx = Simd::MultiplySubtract(wz, qy, rx);
+    SimVec ry = Simd::Multiply(wy, qw);
+    ry = Simd::MultiplyAdd(wz, qx, ry);
+    ry = Simd::MultiplySubtract(wx, qz, ry);
+    SimVec rz = Simd::Multiply(wz, qw);
+    rz = Simd::MultiplyAdd(wx, qy, rz);
+    rz = Simd::MultiplySubtract(wy, qx, rz);
+    SimVec rw = Simd::Multiply(wx, qx);
+    rw = Simd::MultiplyAdd(wy, qy, rw);
+    rw = Simd::MultiplyAdd(wz, qz, rw);
+    rw = Simd::Negate(rw);
+
+    Simd::UnAlignedStore(Simd::Multiply(rx, halfDtVec), &mRotationV.mX[i]);
+    Simd::UnAlignedStore(Simd::Multiply(ry, halfDtVec), &mRotationV.mY[i]);
+    Simd::UnAlignedStore(Simd::Multiply(rz, halfDtVec), &mRotationV.mZ[i]);
+    Simd::UnAlignedStore(Simd::Multiply(rw, halfDtVec), &mRotationW[i]);
+  }
+}
+
+void BodyIntegrationBatch::CommitPositions(real dt)
+{
+  for(uint i = 0; i < mBodies.Size(); ++i)
+  {
+    RigidBody* body = mBodies[i];
+    Vec3 rotationV = mRotationV.Get(i);
+
+    body->UpdateCenterMass(mVelocity.Get(i));
+    body->UpdateOrientation(Quat(rotationV.x, rotationV.y, rotationV.z, mRotationW[i]));
+    body->GenerateIntegrationUpdate();
+    // Attempt to sleep the body.
+    body->UpdateSleepTimer(dt);
+  }
+  Clear();
+}
+
+uint BodyIntegrationBatch::GetBodyCount() const
+{
+  return mBodies.Size();
+}
+
+void BodyIntegrationBatch::Clear()
+{
+  // Only the body list is cleared, the state arrays keep their size so the
+  // next pass can write straight into them without growing anything
+  mBodies.Clear();
+}
+
+uint BodyIntegrationBatch::PadToSimdWidth()
+{
+  uint size = mBodies.Size();
+  uint paddedSize = (size + cSimdWidth - 1) / cSimdWidth * cSimdWidth;
+  Reserve(paddedSize);
+
+  // The arrays hold stale state from earlier passes past the body count
+  // so the padded entries have to be zeroed explicitly
+  for(uint i = size; i < paddedSize; ++i)
+  {
+    mVelocity.Set(i, Vec3::cZero);
+    mAngularVelocity.Set(i, Vec3::cZero);
+    mForce.Set(i, Vec3::cZero);
+    mInvMass.Set(i, Vec3::cZero);
+    mTorque.Set(i, Vec3::cZero);
+    mGyroscopic.Set(i, Vec3::cZero);
+    mInvInertiaRow0.Set(i, Vec3::cZero);
+    mInvInertiaRow1.Set(i, Vec3::cZero);
+    mInvInertiaRow2.Set(i, Vec3::cZero);
+    mRotationV.Set(i, Vec3::cZero);
+    mRotationW[i] = real(0.0);
+  }
+  return paddedSize;
+}
+
+void BodyIntegrationBatch::Reserve(uint size)
+{
+  uint capacity = mRotationW.Size();
+  if(size <= capacity)
+    return;
+
+  // Grow geometrically so that a space that keeps gaining bodies only
+  // resizes the arrays a handful of times rather than once per body
+  uint newCapacity = Math::Max(capacity * 2, cSimdWidth);
+  while(newCapacity < size)
+    newCapacity *= 2;
+
+  // Every array grows together (even the ones the current pass doesn't use)
+  // so that any index is valid in all of them.
+  mVelocity.Resize(newCapacity);
+  mAngularVelocity.Resize(newCapacity);
+  mForce.Resize(newCapacity);
+  mInvMass.Resize(newCapacity);
+  mTorque.Resize(newCapacity);
+  mGyroscopic.Resize(newCapacity);
+  mInvInertiaRow0.Resize(newCapacity);
+  mInvInertiaRow1.Resize(newCapacity);
+  mInvInertiaRow2.Resize(newCapacity);
+  mRotationV.Resize(newCapacity);
+  mRotationW.Resize(newCapacity, real(0.0));
+}
+
+uint BodyIntegrationBatch::AddBody(RigidBody* body)
+{
+  uint index = mBodies.Size();
+  mBodies.PushBack(body);
+  Reserve(index + 1);
+  return index;
+}
+
+}//namespace Physics
+
+}//namespace Zero
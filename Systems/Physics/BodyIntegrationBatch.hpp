@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+//-------------------------------------------------------------------SoaVec3Array
+/// An array of Vec3s stored as one array per axis so that 4 consecutive
+/// vectors can be loaded straight into simd registers.
+struct SoaVec3Array
+{
+  void Resize(uint size);
+  void Clear();
+  void Set(uint index, Vec3Param value);
+  Vec3 Get(uint index) const;
+
+  Array<real> mX;
+  Array<real> mY;
+  Array<real> mZ;
+};
+
+//-------------------------------------------------------------------BodyIntegrationBatch
+/// Mirrors the integration state of a space's awake rigid bodies in
+/// structure-of-arrays form. The state is gathered from the bodies once per
+/// integration pass, integrated 4 bodies at a time and then written back.
+/// The arrays keep their size between passes (only the body list is cleared)
+/// so gathering a body only writes into them.
+class BodyIntegrationBatch
+{
+public:
+  /// Gathers the velocity state of a body (and its old velocity is saved).
+  /// Assumes the body is dynamic and all forces have been accumulated.
+  void AddVelocityBody(RigidBody* body, real dt);
+  /// Integrates force and torque into the gathered velocities.
+  void IntegrateVelocities(real dt, real maxVelocity);
+  /// Writes the integrated velocities back to the bodies and clears the batch.
+  void CommitVelocities();
+
+  /// Gathers the position state of a body.
+  void AddPositionBody(RigidBody* body);
+  /// Integrates the gathered velocities into position and rotation offsets.
+  void IntegratePositions(real dt);
+  /// Applies the integrated offsets to each body and clears the batch.
+  /// Each body's sleep timer is updated at the same time.
+  void CommitPositions(real dt);
+
+  uint GetBodyCount() const;
+  void Clear();
+
+private:
+  /// Zeroes the entries past the last body up to a multiple of 4 so that the
+  /// simd loops don't need a scalar tail. Padded bodies integrate to zero.
+  /// Returns the padded count.
+  uint PadToSimdWidth();
+  /// Grows every array to hold at least the given number of bodies.
+  void Reserve(uint size);
+  uint AddBody(RigidBody* body);
+
+  Array<RigidBody*> mBodies;
+
+  SoaVec3Array mVelocity;
+  SoaVec3Array mAngularVelocity;
+  SoaVec3Array mForce;
+  /// Per-axis inverse mass (to deal with axis locking).
+  SoaVec3Array mInvMass;
+
+  // Velocity only
+  SoaVec3Array mTorque;
+  /// The implicit gyroscopic velocity change, this requires solving a
+  /// 3x3 system per body so it's computed when the body is gathered.
+  SoaVec3Array mGyroscopic;
+  /// The rows of the world-space inverse inertia tensor.
+  SoaVec3Array mInvInertiaRow0;
+  SoaVec3Array mInvInertiaRow1;
+  SoaVec3Array mInvInertiaRow2;
+
+  // Position only
+  SoaVec3Array mRotationV;
+  Array<real> mRotationW;
+};
+
+}//namespace Physics
+
+}//namespace Zero
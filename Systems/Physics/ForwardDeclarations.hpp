@@ -75,6 +75,7 @@ struct PhysicsNodeManager;
 struct PhysicsEventManager;
 class Island;
 struct PhysicsQueue;
+class ParallelNarrowPhase;
 
 }//namespace Physics
 
@@ -172,6 +172,25 @@ void Island::Solve(real dt, bool allowSleeping, uint debugFlags)
   UpdateSleep(dt, allowSleeping, debugFlags);
 }
 
+void Island::SolveVelocities(real dt)
+{
+  CommitConstraints();
+  mSolver->UpdateData();
+  mSolver->WarmStart();
+  mSolver->SolveVelocities();
+  mSolver->Commit();
+}
+
+void Island::BatchEvents()
+{
+  mSolver->BatchEvents();
+}
+
+uint Island::GetConstraintCount() const
+{
+  return ContactCount + JointCount;
+}
+
 void Island::SolvePositions(real dt)
 {
   mSolver->SolvePositions();
@@ -40,6 +40,11 @@ public:
   void IntegratePosition(real dt);
   void CommitConstraints();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  ///Solves the velocity constraints without sending events or updating sleep.
+  ///Used when islands are solved on multiple threads at once.
+  void SolveVelocities(real dt);
+  void BatchEvents();
+  uint GetConstraintCount() const;
   void SolvePositions(real dt);
   void UpdateSleep(real dt, bool allowSleeping, uint debugFlags);
   ///Helper function to mark everything as not on an island.
@@ -262,6 +262,64 @@ struct ConstraintCountPreProcessing
   }
 };
 
+//-------------------------------------------------------------------IslandSolveTask
+/// Solves a range of islands. Ranges are handed out by the job system's
+/// ParallelFor, so idle task workers steal islands from busy ones and
+/// uneven islands balance out.
+struct IslandSolveTask
+{
+  IslandSolveTask(Array<Island*>& islands, real dt, bool solvePositions)
+    : mIslands(islands)
+  {
+    mDt = dt;
+    mSolvePositions = solvePositions;
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+    {
+      if(mSolvePositions)
+        mIslands[i]->SolvePositions(mDt);
+      else
+        mIslands[i]->SolveVelocities(mDt);
+    }
+  }
+
+  Array<Island*>& mIslands;
+  real mDt;
+  bool mSolvePositions;
+};
+
+/// Sorts islands so that the ones with the most constraints come first.
+struct IslandSizeSorter
+{
+  bool operator()(const Island* lhs, const Island* rhs) const
+  {
+    return lhs->GetConstraintCount() > rhs->GetConstraintCount();
+  }
+};
+
+void UpdateSharedColliderBody(HashSet<RigidBody*>& visited, Collider* collider)
+{
+  RigidBody* body = collider->GetActiveBody();
+  if(body == nullptr || body->IsDynamic() || visited.Contains(body))
+    return;
+
+  visited.Insert(body);
+  UpdateHierarchyTransform(body);
+  body->UpdateWorldInertiaTensor();
+}
+
+template <typename EdgeListType>
+void UpdateSharedEdgeBodies(HashSet<RigidBody*>& visited, EdgeListType& edgeList)
+{
+  typename EdgeListType::range edgeRange = edgeList.All();
+  for(; !edgeRange.Empty(); edgeRange.PopFront())
+    UpdateSharedColliderBody(visited, edgeRange.Front().mOther);
+}
+
+//-------------------------------------------------------------------IslandManager
 IslandManager::IslandManager(PhysicsSolverConfig* config)
 {
   mIslandCount = 0;
@@ -377,6 +435,15 @@ void IslandManager::PostProcessIslands()
 
 void IslandManager::Solve(real dt, bool allowSleeping, uint debugFlags)
 {
+  bool parallel = ShouldSolveInParallel();
+  SetSolversDynamicBodiesOnly(parallel);
+
+  if(parallel)
+  {
+    SolveInParallel(dt, allowSleeping, debugFlags);
+    return;
+  }
+
   if(mShareSolver)
   {
     IslandList::range islandRange = mIslands.All();
@@ -401,6 +468,15 @@ void IslandManager::Solve(real dt, bool allowSleeping, uint debugFlags)
 
 void IslandManager::SolvePositions(real dt)
 {
+  bool parallel = ShouldSolveInParallel();
+  SetSolversDynamicBodiesOnly(parallel);
+
+  if(parallel)
+  {
+    SolvePositionsInParallel(dt);
+    return;
+  }
+
   IslandList::range islandRange = mIslands.All();
   for(; !islandRange.Empty(); islandRange.PopFront())
     islandRange.Front().SolvePositions(dt);
@@ -433,6 +509,7 @@ void IslandManager::RemoveCollider(Collider* collider)
 void IslandManager::Clear()
 {
   mIslandCount = 0;
+  mSortedIslands.Clear();
 
   DeleteObjectsIn<Island, &Island::ManagerLink>(mIslands);
   if(mShareSolver && mSharedSolver != nullptr)
@@ -442,6 +519,82 @@ void IslandManager::Clear()
   }
 }
 
+bool IslandManager::ShouldSolveInParallel()
+{
+  if(mPhysicsSolverConfig == nullptr || mSpace == nullptr || Z::gJobs == nullptr)
+    return false;
+  if(mPhysicsSolverConfig->mIslandSolveMode != PhysicsIslandSolveMode::Parallel)
+    return false;
+
+  // A shared solver means there's really only one island to solve. Random
+  // tangents all pull from one random number generator so they can't be threaded.
+  if(mShareSolver || mPhysicsSolverConfig->mTangentType == PhysicsContactTangentTypes::RandomTangents)
+    return false;
+  return true;
+}
+
+void IslandManager::SetSolversDynamicBodiesOnly(bool dynamicBodiesOnly)
+{
+  // Islands that share a solver all point at it, so this covers the shared solver too
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+    islandRange.Front().mSolver->SetDynamicBodiesOnly(dynamicBodiesOnly);
+}
+
+void IslandManager::SolveInParallel(real dt, bool allowSleeping, uint debugFlags)
+{
+  SortIslandsBySize();
+
+  IslandSolveTask task(mSortedIslands, dt, false);
+  Z::gJobs->ParallelFor(0, mSortedIslands.Size(), task);
+
+  // Events and sleeping touch the space so they're done afterwards on this
+  // thread in island order (so the results don't depend on the thread count)
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island& island = islandRange.Front();
+    island.BatchEvents();
+    island.UpdateSleep(dt, allowSleeping, debugFlags);
+  }
+}
+
+void IslandManager::SolvePositionsInParallel(real dt)
+{
+  UpdateSharedBodies();
+  SortIslandsBySize();
+
+  IslandSolveTask task(mSortedIslands, dt, true);
+  Z::gJobs->ParallelFor(0, mSortedIslands.Size(), task);
+}
+
+void IslandManager::UpdateSharedBodies()
+{
+  HashSet<RigidBody*> visited;
+
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island::Colliders::range colliderRange = islandRange.Front().mColliders.All();
+    for(; !colliderRange.Empty(); colliderRange.PopFront())
+    {
+      Collider& collider = colliderRange.Front();
+      UpdateSharedEdgeBodies(visited, collider.mJointEdges);
+      UpdateSharedEdgeBodies(visited, collider.mContactEdges);
+    }
+  }
+}
+
+void IslandManager::SortIslandsBySize()
+{
+  mSortedIslands.Clear();
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+    mSortedIslands.PushBack(&islandRange.Front());
+
+  Sort(mSortedIslands.All(), IslandSizeSorter());
+}
+
 Island* IslandManager::GetObjectsIsland(const Collider* collider)
 {
   IslandList::range islandRange = mIslands.All();
@@ -559,6 +712,7 @@ IConstraintSolver* IslandManager::GetNewSolver()
   if(mPhysicsSolverConfig != nullptr)
     solver->SetConfiguration(mPhysicsSolverConfig);
   solver->SetHeap(mSpace->mHeap);
+  solver->SetDeterministic(mSpace->GetDeterministic());
 
   return solver;
 }
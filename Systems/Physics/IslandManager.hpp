@@ -52,6 +52,19 @@ public:
   IConstraintSolver* GetNewSolver();
   Island* CreateNewIsland();
 
+  /// Should islands be spread across the job system's task workers this frame?
+  bool ShouldSolveInParallel();
+  /// Tells every solver whether it may only move dynamic bodies. This is set
+  /// each step since the solve mode on the config can change at any time.
+  void SetSolversDynamicBodiesOnly(bool dynamicBodiesOnly);
+  void SolveInParallel(real dt, bool allowSleeping, uint debugFlags);
+  void SolvePositionsInParallel(real dt);
+  /// Non-dynamic bodies can be shared between islands. Their cached transforms
+  /// are updated once up-front so that islands only ever read from them.
+  void UpdateSharedBodies();
+  /// Fills out mSortedIslands with the largest islands first.
+  void SortIslandsBySize();
+
   uint mIslandCount;
   typedef InList<Island,&Island::ManagerLink> IslandList;
   IslandList mIslands;
@@ -67,6 +80,8 @@ public:
   PhysicsSpace* mSpace;
   bool mShareSolver;
   IConstraintSolver* mSharedSolver;
+  /// The islands in the order they're handed out to threads (largest first).
+  Array<Island*> mSortedIslands;
 };
 
 }//namespace Physics
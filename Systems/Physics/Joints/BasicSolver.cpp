@@ -142,13 +142,13 @@ void BasicSolver::SolvePositions()
   {
     if(mSolverConfig->mSubType == PhysicsSolverSubType::BasicSolving)
     {
-      SolveConstraintPosition(jointsToSolve, EmptyUpdate<Joint>);
-      SolveConstraintPosition(contactsToSolve, ContactUpdate);
+      SolveConstraintPosition(jointsToSolve, EmptyUpdate<Joint>, mDynamicBodiesOnly);
+      SolveConstraintPosition(contactsToSolve, ContactUpdate, mDynamicBodiesOnly);
     }
     else
     {
-      BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>);
-      BlockSolvePositions(contactsToSolve, ContactUpdate);
+      BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>, mDynamicBodiesOnly);
+      BlockSolvePositions(contactsToSolve, ContactUpdate, mDynamicBodiesOnly);
     }
   }
 
@@ -131,12 +131,14 @@ void CommitVelocities(Collider* obj0, Collider* obj1, JointVelocity& velocities)
   RigidBody* body0 = obj0->GetActiveBody();
   RigidBody* body1 = obj1->GetActiveBody();
 
-  if(body0)
+  // Non-dynamic bodies have no mass in the solver so their velocities can't have
+  // changed. Skipping them keeps bodies shared between solver batches read-only.
+  if(body0 && body0->IsDynamic())
   {
     body0->mVelocity = velocities.Linear[0];
     body0->mAngularVelocity = velocities.Angular[0];
   }
-  if(body1)
+  if(body1 && body1->IsDynamic())
   {
     body1->mVelocity = velocities.Linear[1];
     body1->mAngularVelocity = velocities.Angular[1];
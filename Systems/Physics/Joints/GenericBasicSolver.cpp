@@ -161,8 +161,8 @@ void GenericBasicSolver::SolvePositions()
 
   for(uint iterationCount = 0; iterationCount < GetSolverPositionIterationCount(); ++iterationCount)
   {
-    BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>);
-    BlockSolvePositions(contactsToSolve, ContactUpdate);
+    BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>, mDynamicBodiesOnly);
+    BlockSolvePositions(contactsToSolve, ContactUpdate, mDynamicBodiesOnly);
   }
 
   //make sure to put the joints and contacts back into the main
@@ -248,7 +248,8 @@ void GenericBasicSolver::ConstraintObjectData::ApplyImpulse(Vec3Param linear, Ve
 
 void GenericBasicSolver::ConstraintObjectData::CommitVelocities()
 {
-  if(Body)
+  // Only dynamic bodies can change (see JointHelpers::CommitVelocities)
+  if(Body && Body->IsDynamic())
   {
     Body->mVelocity = Velocity;
     Body->mAngularVelocity = AngularVelocity;
@@ -29,7 +29,7 @@ public:
   typedef InList<Contact,&Contact::SolverLink> ContactList;
   typedef InList<Joint,&Joint::SolverLink> JointList;
 
-  IConstraintSolver() { mHeap = nullptr; };
+  IConstraintSolver() { mHeap = nullptr; mDeterministic = true; mDynamicBodiesOnly = false; };
   virtual ~IConstraintSolver() {};
 
   void SetConfiguration(PhysicsSolverConfig* config) 
@@ -42,6 +42,19 @@ public:
     mHeap = heap;
   }
 
+  /// Should the results be independent of how many threads are used?
+  void SetDeterministic(bool deterministic)
+  {
+    mDeterministic = deterministic;
+  }
+
+  /// Only write to dynamic bodies during position correction. Used when other
+  /// solvers run at the same time and may share the same static bodies.
+  void SetDynamicBodiesOnly(bool dynamicBodiesOnly)
+  {
+    mDynamicBodiesOnly = dynamicBodiesOnly;
+  }
+
   ///Add functions for joints
   virtual void AddJoint(Joint* joint) {}
   virtual void AddContact(Contact* contact) {}
@@ -72,6 +85,8 @@ public:
 
   PhysicsSolverConfig* mSolverConfig;
   Memory::Heap* mHeap;
+  bool mDeterministic;
+  bool mDynamicBodiesOnly;
 };
 
 }//namespace Physics
@@ -164,12 +164,12 @@ void NormalSolver::SolvePositions()
   {
     //solve each joint list
 #define JointType(type)                                                   \
-    BlockSolvePositions(type##ToSolve, EmptyUpdate<Joint>);
+    BlockSolvePositions(type##ToSolve, EmptyUpdate<Joint>, mDynamicBodiesOnly);
 
     #include "Physics/Joints/JointList.hpp"
 #undef JointType
 
-    BlockSolvePositions(contactsToSolve, ContactUpdate);
+    BlockSolvePositions(contactsToSolve, ContactUpdate, mDynamicBodiesOnly);
   }
 
   //splice each list of joints we solved back into the main list
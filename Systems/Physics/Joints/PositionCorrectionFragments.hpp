@@ -83,15 +83,25 @@ void ApplyPositionCorrection(RigidBody* b0, RigidBody* b1,
                              Vec3Param linearOffset0, Vec3Param angularOffset0,
                              Vec3Param linearOffset1, Vec3Param angularOffset1);
 
+//When position correction is run from multiple threads only dynamic bodies can be
+//written to (everything else may be shared with another batch). The caller is
+//responsible for making sure the non-dynamic bodies are up-to-date beforehand.
+inline RigidBody* GetWritableBody(RigidBody* body, bool dynamicOnly)
+{
+  if(dynamicOnly && body != nullptr && !body->IsDynamic())
+    return nullptr;
+  return body;
+}
+
 template <typename JointType, typename UpdateFunctor>
-void JointBlockSolvePositions(JointType& joint, PositionSolverData& data, UpdateFunctor functor)
+void JointBlockSolvePositions(JointType& joint, PositionSolverData& data, UpdateFunctor functor, bool dynamicOnly = false)
 {
   ConstraintMolecule moleculeList[PostionCorrectionConstants::mMoleculeCount];
 
   Collider* c0 = joint.GetCollider(0);
   Collider* c1 = joint.GetCollider(1);
-  RigidBody* b0 = c0->GetActiveBody();
-  RigidBody* b1 = c1->GetActiveBody();
+  RigidBody* b0 = GetWritableBody(c0->GetActiveBody(), dynamicOnly);
+  RigidBody* b1 = GetWritableBody(c1->GetActiveBody(), dynamicOnly);
 
   //Make sure that the cached transforms are up to date for these objects.
   //This needs to happen at the beginning of solving because this happens after
@@ -254,7 +264,7 @@ void JointBlockSolvePositions(JointType& joint, PositionSolverData& data, Update
 }
 
 template <typename ListType, typename UpdateFunctor>
-inline void BlockSolvePositions(ListType& jointList, UpdateFunctor functor)
+inline void BlockSolvePositions(ListType& jointList, UpdateFunctor functor, bool dynamicOnly = false)
 {
   PositionSolverData data;
 
@@ -264,12 +274,12 @@ inline void BlockSolvePositions(ListType& jointList, UpdateFunctor functor)
     typename ListType::sub_reference joint = jointRange.Front();
     jointRange.PopFront();
 
-    JointBlockSolvePositions(joint, data, functor);
+    JointBlockSolvePositions(joint, data, functor, dynamicOnly);
   }
 }
 
 template <typename ListType, typename UpdateFunctor>
-inline void SolveConstraintPosition(ListType& jointList, UpdateFunctor functor)
+inline void SolveConstraintPosition(ListType& jointList, UpdateFunctor functor, bool dynamicOnly = false)
 {
   ConstraintMolecule moleculeList[PostionCorrectionConstants::mMoleculeCount];
 
@@ -284,8 +294,8 @@ inline void SolveConstraintPosition(ListType& jointList, UpdateFunctor functor)
 
     Collider* c0 = joint.GetCollider(0);
     Collider* c1 = joint.GetCollider(1);
-    RigidBody* b0 = c0->GetActiveBody();
-    RigidBody* b1 = c1->GetActiveBody();
+    RigidBody* b0 = GetWritableBody(c0->GetActiveBody(), dynamicOnly);
+    RigidBody* b1 = GetWritableBody(c1->GetActiveBody(), dynamicOnly);
     if(b0 != nullptr)
       UpdateHierarchyTransform(b0);
     if(b1 != nullptr)
@@ -15,9 +15,11 @@ namespace Physics
 template <typename JointType>
 struct ConstraintBatch
 {
-  ConstraintBatch() { ConstraintCount = 0; }
+  ConstraintBatch() { ConstraintCount = 0; MoleculeOffset = 0; }
   ~ConstraintBatch() { Joints.Clear(); }
   uint ConstraintCount;
+  /// Where this batch's molecules start in the solver's molecule array.
+  uint MoleculeOffset;
   typedef InList<JointType,&JointType::SolverLink> JointList;
   JointList Joints;
 
@@ -107,15 +109,27 @@ void GroupOperationTwoParamFragment(ConstraintGroup<typename ListType::value_typ
   }
 }
 
+/// Returns the body a constraint can write to when solving (only dynamic bodies
+/// are ever written to, everything else can be shared between batches).
+inline RigidBody* GetThreadingBody(Collider* collider)
+{
+  RigidBody* body = collider->GetActiveBody();
+  if(body == nullptr || !body->IsDynamic())
+    return nullptr;
+  return body;
+}
+
+/// Splits the constraints into phases of batches where no two batches in
+/// the same phase write to the same body. Batches within a phase can
+/// then be solved in any order (or at the same time) with the same result.
 template <typename ListType>
-void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases)
+void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases,
+                      uint batchSize = 32, uint batchesPerPhase = 2)
 {
   typedef ConstraintPhase<typename ListType::value_type> PhaseType;
   typedef ConstraintBatch<typename ListType::value_type> BatchType;
 
-  HashSet<uint> bodySet;
-  uint batchSize = 32;
-  uint batchesPerPhase = 2;
+  HashSet<RigidBody*> bodySet;
 
   PhaseType* phase = nullptr;
   BatchType* batch = nullptr;
@@ -142,17 +156,18 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       typename ListType::pointer joint = &(range.Front());
       range.PopFront();
 
-      //get the id of the two bodies involved in this joint
-      uint idA = joint->GetCollider(0)->mId;
-      uint idB = joint->GetCollider(1)->mId;
+      //get the two bodies that solving this joint will write to
+      RigidBody* bodyA = GetThreadingBody(joint->GetCollider(0));
+      RigidBody* bodyB = GetThreadingBody(joint->GetCollider(1));
 
       //if either of the bodies have been used in this phase, then skip this joint
-      if(!bodySet.Find(idA).Empty() || !bodySet.Find(idB).Empty())
+      if((bodyA != nullptr && bodySet.Contains(bodyA)) ||
+         (bodyB != nullptr && bodySet.Contains(bodyB)))
         continue;
 
       //if adding this joint would make the batch too large, make a new batch and add the old to the phase
       uint ConstraintCount = joint->MoleculeCount();
-      if(ConstraintCount + batch->ConstraintCount > batchSize)
+      if(batch->ConstraintCount != 0 && ConstraintCount + batch->ConstraintCount > batchSize)
       {
         //if this will be too many batches for this phase, then make a new phase
         if(phase->BatchCount >= batchesPerPhase)
@@ -171,8 +186,10 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       }
 
       //mark both of these bodies as being used for this phase
-      bodySet.Insert(idA);
-      bodySet.Insert(idB);
+      if(bodyA != nullptr)
+        bodySet.Insert(bodyA);
+      if(bodyB != nullptr)
+        bodySet.Insert(bodyB);
 
       //put the joint in this batch
       ListType::Unlink(joint);
@@ -183,6 +200,101 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
   }
 }
 
+/// Moves any constraint that touches a body in a hierarchy of rigid bodies
+/// into the output list. Position correction on those bodies reads the cached
+/// transforms of their parents so they can't be solved alongside other batches.
+template <typename ListType>
+void CollectHierarchyConstraints(ListType& inList, ListType& outList)
+{
+  typename ListType::range range = inList.All();
+  while(!range.Empty())
+  {
+    typename ListType::pointer joint = &(range.Front());
+    range.PopFront();
+
+    RigidBody* body0 = joint->GetCollider(0)->GetActiveBody();
+    RigidBody* body1 = joint->GetCollider(1)->GetActiveBody();
+    bool inHierarchy0 = body0 != nullptr && body0->mParentBody != nullptr;
+    bool inHierarchy1 = body1 != nullptr && body1->mParentBody != nullptr;
+    if(inHierarchy0 || inHierarchy1)
+    {
+      ListType::Unlink(joint);
+      outList.PushBack(joint);
+    }
+  }
+}
+
+//-------------------------------------------------------------------ConstraintBatchTable
+/// A flattened view of the batches in a ConstraintGroup so that
+/// threads can claim the batches within a phase by index.
+template <typename JointType>
+struct ConstraintBatchTable
+{
+  typedef ConstraintBatch<JointType> BatchType;
+  typedef ConstraintPhase<JointType> PhaseType;
+  typedef ConstraintGroup<JointType> GroupType;
+
+  void Clear()
+  {
+    Batches.Clear();
+    PhaseStarts.Clear();
+  }
+
+  uint GetPhaseCount() const
+  {
+    return PhaseStarts.Empty() ? 0 : PhaseStarts.Size() - 1;
+  }
+
+  /// Builds the table from the group. Each batch is also assigned where its molecules
+  /// start (in phase order, the same order the serial walker would visit them in).
+  void Build(GroupType& group, uint& moleculeOffset)
+  {
+    Clear();
+
+    typename GroupType::PhaseTypeList::range phaseRange = group.Phases.All();
+    for(; !phaseRange.Empty(); phaseRange.PopFront())
+    {
+      PhaseStarts.PushBack(Batches.Size());
+
+      PhaseType& phase = phaseRange.Front();
+      typename PhaseType::JointBatches::range batchRange = phase.Batches.All();
+      for(; !batchRange.Empty(); batchRange.PopFront())
+      {
+        BatchType* batch = &batchRange.Front();
+        batch->MoleculeOffset = moleculeOffset;
+        moleculeOffset += batch->ConstraintCount;
+        Batches.PushBack(batch);
+      }
+    }
+    PhaseStarts.PushBack(Batches.Size());
+  }
+
+  Array<BatchType*> Batches;
+  /// The index of the first batch of each phase (plus one past the last batch).
+  Array<uint> PhaseStarts;
+};
+
+/// Calls the functor on each batch in a range of the table. This is the range
+/// functor given to the job system's ParallelFor over the batches of one phase.
+template <typename JointType, typename Functor>
+struct PhaseBatchRange
+{
+  PhaseBatchRange(ConstraintBatchTable<JointType>* table, Functor* functor)
+  {
+    mTable = table;
+    mFunctor = functor;
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+      (*mFunctor)(*mTable->Batches[i]);
+  }
+
+  ConstraintBatchTable<JointType>* mTable;
+  Functor* mFunctor;
+};
+
 template <typename ListType>
 void CollectJoints(ListType& inList, ListType& outList)
 {
@@ -29,15 +29,85 @@ namespace Zero
 namespace Physics
 {
 
-template <typename JointList>
-void ThreadSolveFunction(JointList& joints, MoleculeWalker molecules, uint startIndex)
+//-------------------------------------------------------------------Batch Operations
+/// Runs a molecule fragment function on one batch, starting at that batch's molecules.
+template <typename JointType, void (*Operation)(InList<JointType,&JointType::SolverLink>&, MoleculeWalker&)>
+struct MoleculeBatchOperation
 {
-  MoleculeWalker mols = molecules;
-  mols += startIndex;
+  typedef ConstraintBatch<JointType> BatchType;
 
-  IterateVelocitiesFragment(joints,mols,0);
+  MoleculeBatchOperation(ConstraintMolecule* molecules)
+  {
+    mMolecules = molecules;
+  }
+
+  void operator()(BatchType& batch)
+  {
+    MoleculeWalker molecules(mMolecules, sizeof(ConstraintMolecule), 0);
+    molecules += batch.MoleculeOffset;
+    Operation(batch.Joints, molecules);
+  }
+
+  ConstraintMolecule* mMolecules;
+};
+
+/// Solves the velocity constraints of one batch for the given iteration.
+template <typename JointType>
+struct VelocityBatchOperation
+{
+  typedef ConstraintBatch<JointType> BatchType;
+
+  VelocityBatchOperation(ConstraintMolecule* molecules, uint iteration)
+  {
+    mMolecules = molecules;
+    mIteration = iteration;
+  }
+
+  void operator()(BatchType& batch)
+  {
+    MoleculeWalker molecules(mMolecules, sizeof(ConstraintMolecule), 0);
+    molecules += batch.MoleculeOffset;
+    IterateVelocitiesFragmentList(batch.Joints, molecules, mIteration);
+  }
+
+  ConstraintMolecule* mMolecules;
+  uint mIteration;
+};
+
+/// Position corrects one batch. Only dynamic bodies are written to.
+template <typename JointType, typename UpdateFunctor>
+struct PositionBatchOperation
+{
+  typedef ConstraintBatch<JointType> BatchType;
+
+  PositionBatchOperation(UpdateFunctor updateFunctor)
+  {
+    mUpdateFunctor = updateFunctor;
+  }
+
+  void operator()(BatchType& batch)
+  {
+    BlockSolvePositions(batch.Joints, mUpdateFunctor, true);
+  }
+
+  UpdateFunctor mUpdateFunctor;
+};
+
+typedef void (*JointUpdateFunction)(Joint*, Collider*, Collider*);
+typedef void (*ContactUpdateFunction)(Contact*, Collider*, Collider*);
+
+template <typename JointType>
+void CollectPhases(ConstraintGroup<JointType>& group, ConstraintBatchTable<JointType>& table,
+                   InList<JointType,&JointType::SolverLink>& outList)
+{
+  typedef InList<JointType,&JointType::SolverLink> ListType;
+  GroupOperationParamFragment<ListType>(group, outList, CollectJoints<ListType>);
+  group.Clear();
+  group.PhaseCount = 0;
+  table.Clear();
 }
 
+//-------------------------------------------------------------------ThreadedSolver
 ThreadedSolver::ThreadedSolver()
 {
   mConstraintCount = 0;
@@ -112,25 +182,51 @@ void ThreadedSolver::Clear()
 {
   ClearFragmentList(mJoints);
   ClearFragmentList(mContacts);
+  ClearFragmentList(mSerialJoints);
+  ClearFragmentList(mSerialContacts);
 
   GroupOperationFragment<ContactList>(mContactPhases,ClearFragmentList<ContactList>);
   GroupOperationFragment<JointList>(mJointPhases,ClearFragmentList<JointList>);
+  GroupOperationFragment<ContactList>(mContactPositionPhases,ClearFragmentList<ContactList>);
+  GroupOperationFragment<JointList>(mJointPositionPhases,ClearFragmentList<JointList>);
 
   mJointPhases.Clear();
   mContactPhases.Clear();
+  mJointPositionPhases.Clear();
+  mContactPositionPhases.Clear();
+  mJointPhases.PhaseCount = 0;
+  mContactPhases.PhaseCount = 0;
+  mJointPositionPhases.PhaseCount = 0;
+  mContactPositionPhases.PhaseCount = 0;
+
+  mContactTable.Clear();
+  mJointTable.Clear();
+  mContactPositionTable.Clear();
+  mJointPositionTable.Clear();
+  mConstraintCount = 0;
 }
 
 void ThreadedSolver::UpdateData()
 {
   mMolecules.Resize(mConstraintCount);
 
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
+  uint batchesPerPhase = GetBatchesPerPhase();
+  SplitConstraints(mContacts, mContactPhases, cBatchSize, batchesPerPhase);
+  SplitConstraints(mJoints, mJointPhases, cBatchSize, batchesPerPhase);
 
-  SplitConstraints(mContacts,mContactPhases);
-  SplitConstraints(mJoints,mJointPhases);
+  // Contacts are laid out before joints, the same as walking the phases serially
+  uint moleculeOffset = 0;
+  mContactTable.Build(mContactPhases, moleculeOffset);
+  mJointTable.Build(mJointPhases, moleculeOffset);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules,UpdateDataFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules,UpdateDataFragmentList<JointList>);
+  // Random tangents share one random number generator so they can't be computed in parallel
+  bool inParallel = mSolverConfig->mTangentType != PhysicsContactTangentTypes::RandomTangents;
+
+  ConstraintMolecule* molecules = mMolecules.Data();
+  MoleculeBatchOperation<Contact, &UpdateDataFragmentList<ContactList> > contactOperation(molecules);
+  MoleculeBatchOperation<Joint, &UpdateDataFragmentList<JointList> > jointOperation(molecules);
+  SolvePhases(mContactTable, contactOperation, inParallel);
+  SolvePhases(mJointTable, jointOperation, inParallel);
 }
 
 void ThreadedSolver::WarmStart()
@@ -138,36 +234,36 @@ void ThreadedSolver::WarmStart()
   if(mSolverConfig->mWarmStart == false)
     return;
 
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
-
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules, WarmStartFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules, WarmStartFragmentList<JointList>);
+  ConstraintMolecule* molecules = mMolecules.Data();
+  MoleculeBatchOperation<Contact, &WarmStartFragmentList<ContactList> > contactOperation(molecules);
+  MoleculeBatchOperation<Joint, &WarmStartFragmentList<JointList> > jointOperation(molecules);
+  SolvePhases(mContactTable, contactOperation);
+  SolvePhases(mJointTable, jointOperation);
 }
 
 void ThreadedSolver::SolveVelocities()
 {
   //solve all of the velocity constraints the given number of times
-  for(uint i = 0; i < GetSolverIterationCount(); ++i)
+  uint iterationCount = GetSolverIterationCount();
+  for(uint i = 0; i < iterationCount; ++i)
     IterateVelocities(i);
 }
 
 void ThreadedSolver::IterateVelocities(uint iteration)
 {
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
-
-  GroupOperationTwoParamFragment<ContactList>(mContactPhases,molecules,iteration,IterateVelocitiesFragmentList<ContactList>);
-  GroupOperationTwoParamFragment<JointList>(mJointPhases,molecules,iteration,IterateVelocitiesFragmentList<JointList>);
+  ConstraintMolecule* molecules = mMolecules.Data();
+  VelocityBatchOperation<Contact> contactOperation(molecules, iteration);
+  VelocityBatchOperation<Joint> jointOperation(molecules, iteration);
+  SolvePhases(mContactTable, contactOperation);
+  SolvePhases(mJointTable, jointOperation);
 }
 
 void ThreadedSolver::SolvePositions()
 {
   //first have to re-collect all of the joints and contacts so we
   //can prune out the ones we don't solve positions on
-  GroupOperationParamFragment<ContactList>(mContactPhases, mContacts, CollectJoints<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases, mJoints, CollectJoints<JointList>);
-  
-  //Could in theory split back onto lists to thread, but that's a rather expensive operation.
-  //Maybe just prune each list, but unfortunately then there'd be unbalanced lists.
+  CollectPhases(mContactPhases, mContactTable, mContacts);
+  CollectPhases(mJointPhases, mJointTable, mJoints);
 
   //first do a pre-processing step to figure out which joints/contacts actually
   //need position correction (so we're not doing the check during the inner loop)
@@ -177,30 +273,66 @@ void ThreadedSolver::SolvePositions()
   CollectJointsToSolve(mJoints, jointsToSolve);
   CollectContactsToSolve(mContacts, contactsToSolve, mSolverConfig);
 
+  //anything in a hierarchy of bodies reads its parent's transform so it's solved serially
+  CollectHierarchyConstraints(jointsToSolve, mSerialJoints);
+  CollectHierarchyConstraints(contactsToSolve, mSerialContacts);
+
+  //static and kinematic bodies are shared between batches and are read-only
+  //while solving, so bring their cached transforms up-to-date first (unless
+  //whoever set this solver to dynamic bodies only has already done so)
+  if(!mDynamicBodiesOnly)
+  {
+    HashSet<RigidBody*> visitedBodies;
+    forRange(Joint& joint, jointsToSolve.All())
+      UpdateSharedBodies(visitedBodies, &joint);
+    forRange(Contact& contact, contactsToSolve.All())
+      UpdateSharedBodies(visitedBodies, &contact);
+  }
+
+  uint batchesPerPhase = GetBatchesPerPhase();
+  SplitConstraints(jointsToSolve, mJointPositionPhases, cBatchSize, batchesPerPhase);
+  SplitConstraints(contactsToSolve, mContactPositionPhases, cBatchSize, batchesPerPhase);
+
+  //position correction doesn't use the molecule array so the offsets are unused
+  uint moleculeOffset = 0;
+  mJointPositionTable.Build(mJointPositionPhases, moleculeOffset);
+  mContactPositionTable.Build(mContactPositionPhases, moleculeOffset);
+
+  PositionBatchOperation<Joint, JointUpdateFunction> jointOperation(&EmptyUpdate<Joint>);
+  PositionBatchOperation<Contact, ContactUpdateFunction> contactOperation(&ContactUpdate);
+
   for(uint iterationCount = 0; iterationCount < GetSolverPositionIterationCount(); ++iterationCount)
   {
-    BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>);
-    BlockSolvePositions(contactsToSolve, ContactUpdate);
+    SolvePhases(mJointPositionTable, jointOperation);
+    SolvePhases(mContactPositionTable, contactOperation);
+
+    //everything that couldn't be threaded is solved on this thread once the phases are done
+    BlockSolvePositions(mSerialJoints, EmptyUpdate<Joint>, mDynamicBodiesOnly);
+    BlockSolvePositions(mSerialContacts, ContactUpdate, mDynamicBodiesOnly);
   }
 
   //make sure to put the joints and contacts back into the main
   //list so we'll visit them again next frame
-  if(!jointsToSolve.Empty())
-    mJoints.Splice(mJoints.End(), jointsToSolve.All());
-  if(!contactsToSolve.Empty())
-    mContacts.Splice(mContacts.End(), contactsToSolve.All());
+  CollectPhases(mJointPositionPhases, mJointPositionTable, mJoints);
+  CollectPhases(mContactPositionPhases, mContactPositionTable, mContacts);
+  if(!mSerialJoints.Empty())
+    mJoints.Splice(mJoints.End(), mSerialJoints.All());
+  if(!mSerialContacts.Empty())
+    mContacts.Splice(mContacts.End(), mSerialContacts.All());
 }
 
 void ThreadedSolver::Commit()
 {
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
-
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules,CommitFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules,CommitFragmentList<JointList>);
+  ConstraintMolecule* molecules = mMolecules.Data();
+  MoleculeBatchOperation<Contact, &CommitFragmentList<ContactList> > contactOperation(molecules);
+  MoleculeBatchOperation<Joint, &CommitFragmentList<JointList> > jointOperation(molecules);
+  SolvePhases(mContactTable, contactOperation);
+  SolvePhases(mJointTable, jointOperation);
 }
 
 void ThreadedSolver::BatchEvents()
 {
+  //events are queued onto the space so they're always sent serially (in phase order)
   GroupOperationFragment<JointList>(mJointPhases,BatchEventsFragmentList<JointList>);
 }
 
@@ -208,6 +340,60 @@ void ThreadedSolver::DrawJoints(uint debugFlag)
 {
   GroupOperationFragment<ContactList>(mContactPhases,DrawJointsFragmentList<ContactList>);
   GroupOperationFragment<JointList>(mJointPhases,DrawJointsFragmentList<JointList>);
+  //after position correction everything has been collected back into the main lists
+  DrawJointsFragmentList(mContacts);
+  DrawJointsFragmentList(mJoints);
+}
+
+uint ThreadedSolver::GetBatchesPerPhase()
+{
+  if(mDeterministic || Z::gJobs == nullptr)
+    return cDeterministicBatchesPerPhase;
+
+  // Give each task worker a couple of batches per phase to balance uneven batches
+  return Math::Max(2u, Z::gJobs->GetTaskWorkerCount() * 2);
+}
+
+template <typename JointType, typename Functor>
+void ThreadedSolver::SolvePhases(ConstraintBatchTable<JointType>& table, Functor& functor, bool inParallel)
+{
+  PhaseBatchRange<JointType, Functor> batchRange(&table, &functor);
+
+  uint phaseCount = table.GetPhaseCount();
+  for(uint i = 0; i < phaseCount; ++i)
+  {
+    uint phaseStart = table.PhaseStarts[i];
+    uint phaseEnd = table.PhaseStarts[i + 1];
+
+    // ParallelFor only returns once every batch in the phase is solved,
+    // so the next phase never runs alongside this one
+    if(inParallel && Z::gJobs != nullptr)
+      Z::gJobs->ParallelFor(phaseStart, phaseEnd, batchRange);
+    else
+      batchRange(phaseStart, phaseEnd);
+  }
+}
+
+void UpdateSharedBody(HashSet<RigidBody*>& visited, RigidBody* body)
+{
+  if(body == nullptr || body->IsDynamic() || visited.Contains(body))
+    return;
+
+  visited.Insert(body);
+  UpdateHierarchyTransform(body);
+  body->UpdateWorldInertiaTensor();
+}
+
+void ThreadedSolver::UpdateSharedBodies(HashSet<RigidBody*>& visited, Joint* joint)
+{
+  UpdateSharedBody(visited, joint->GetCollider(0)->GetActiveBody());
+  UpdateSharedBody(visited, joint->GetCollider(1)->GetActiveBody());
+}
+
+void ThreadedSolver::UpdateSharedBodies(HashSet<RigidBody*>& visited, Contact* contact)
+{
+  UpdateSharedBody(visited, contact->GetCollider(0)->GetActiveBody());
+  UpdateSharedBody(visited, contact->GetCollider(1)->GetActiveBody());
 }
 
 }//namespace Physics
@@ -13,7 +13,9 @@ namespace Physics
 {
 
 /// A constraint solver designed to thread the constraints
-/// into as many threads as possible.
+/// into as many threads as possible. Constraints are split into phases where
+/// no two batches in a phase write to the same body. Each phase's batches are
+/// then solved on the task workers of the job system, one phase at a time.
 class ThreadedSolver : public IConstraintSolver
 {
 public:
@@ -40,12 +42,28 @@ public:
 
   void DrawJoints(uint debugFlags);
 
-private:
+  /// How many constraint molecules go into one batch.
+  static const uint cBatchSize = 32;
+  /// How many batches are allowed in a phase when the space is deterministic. This is
+  /// fixed so that the phases (and therefore the results) don't depend on the thread count.
+  static const uint cDeterministicBatchesPerPhase = 8;
 
+private:
   typedef InList<Joint,&Joint::SolverLink> JointList;
   typedef InList<Contact,&Contact::SolverLink> ContactList;
   typedef Array<ConstraintMolecule> MoleculeList;
 
+  /// How many batches each phase should contain.
+  uint GetBatchesPerPhase();
+  /// Solves each phase of the table in order. The batches of a phase are spread
+  /// across the task workers unless inParallel is false.
+  template <typename JointType, typename Functor>
+  void SolvePhases(ConstraintBatchTable<JointType>& table, Functor& functor, bool inParallel = true);
+  /// Bodies that aren't dynamic are read but not written during threaded
+  /// position correction so their transforms are updated once up-front.
+  void UpdateSharedBodies(HashSet<RigidBody*>& visited, Joint* joint);
+  void UpdateSharedBodies(HashSet<RigidBody*>& visited, Contact* contact);
+
   JointList mJoints;
   ContactList mContacts;
   MoleculeList mMolecules;
@@ -55,6 +73,20 @@ private:
   typedef ConstraintGroup<Joint> JointGroup;
   ContactGroup mContactPhases;
   JointGroup mJointPhases;
+
+  typedef ConstraintBatchTable<Contact> ContactTable;
+  typedef ConstraintBatchTable<Joint> JointTable;
+  ContactTable mContactTable;
+  JointTable mJointTable;
+
+  // Position correction is split separately as only some constraints need
+  // it and anything in a rigid body hierarchy has to be solved serially.
+  ContactGroup mContactPositionPhases;
+  JointGroup mJointPositionPhases;
+  ContactTable mContactPositionTable;
+  JointTable mJointPositionTable;
+  ContactList mSerialContacts;
+  JointList mSerialJoints;
 };
 
 }//namespace Physics
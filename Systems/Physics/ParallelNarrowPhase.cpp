@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+//-------------------------------------------------------------------NarrowPhaseWorkerData
+NarrowPhaseWorkerData::NarrowPhaseWorkerData(Memory::Heap* parentHeap)
+{
+  mHeap = new Memory::Heap("NarrowPhaseWorker", parentHeap);
+
+  HeapAllocator allocator(mHeap);
+  mManifolds.SetAllocator(allocator);
+}
+
+NarrowPhaseWorkerData::~NarrowPhaseWorkerData()
+{
+  // Free everything before the heap goes away
+  mManifolds.Deallocate();
+
+  // The heap is a child of the space's heap, remove it so it isn't deleted twice
+  InListBaseLink<Memory::Graph>::Unlink(mHeap);
+  delete mHeap;
+}
+
+void NarrowPhaseWorkerData::Clear()
+{
+  // The manifold array doesn't construct its elements so
+  // they're cleared before their memory is reused
+  for(uint i = 0; i < mManifolds.Size(); ++i)
+    mManifolds[i].Clear();
+  mManifolds.Clear();
+}
+
+//-------------------------------------------------------------------ParallelNarrowPhase
+ParallelNarrowPhase::ParallelNarrowPhase(Memory::Heap* heap)
+{
+  mHeap = heap;
+  mCollisionManager = nullptr;
+  mPairs = nullptr;
+}
+
+ParallelNarrowPhase::~ParallelNarrowPhase()
+{
+  DeleteObjectsInContainer(mWorkerData);
+}
+
+bool ParallelNarrowPhase::ShouldRunInParallel(uint pairCount)
+{
+  if(Z::gJobs == nullptr || Z::gJobs->GetTaskWorkerCount() <= 1)
+    return false;
+  return pairCount >= cMinPairCount;
+}
+
+bool ParallelNarrowPhase::CanTestOnWorker(Collider* collider0, Collider* collider1)
+{
+  return collider0->GetColliderType() != Collider::cHeightMap &&
+         collider1->GetColliderType() != Collider::cHeightMap;
+}
+
+void ParallelNarrowPhase::TestPairs(CollisionManager* collisionManager, ClientPairArray& pairs)
+{
+  mCollisionManager = collisionManager;
+  mPairs = &pairs;
+  mPairResults.Resize(pairs.Size());
+
+  // Make sure every task worker that could take part has its own scratch space
+  uint workerCount = Z::gJobs->GetTaskWorkerCount();
+  while(mWorkerData.Size() < workerCount)
+    mWorkerData.PushBack(new NarrowPhaseWorkerData(mHeap));
+  for(uint i = 0; i < mWorkerData.Size(); ++i)
+    mWorkerData[i]->Clear();
+
+  Z::gJobs->ParallelFor(0, pairs.Size(), *this, cChunkSize);
+}
+
+bool ParallelNarrowPhase::GetPairCollided(uint pairIndex)
+{
+  return mPairResults[pairIndex].mCollided;
+}
+
+Manifold* ParallelNarrowPhase::GetPairManifolds(uint pairIndex, uint& manifoldCount)
+{
+  NarrowPhasePairResult& result = mPairResults[pairIndex];
+  manifoldCount = result.mManifoldCount;
+  if(manifoldCount == 0)
+    return nullptr;
+
+  // Each pair's manifolds were written to wherever its worker was at the time
+  NarrowPhaseWorkerData& data = *mWorkerData[result.mWorkerIndex];
+  return &data.mManifolds[result.mManifoldStart];
+}
+
+void ParallelNarrowPhase::Clear()
+{
+  for(uint i = 0; i < mWorkerData.Size(); ++i)
+    mWorkerData[i]->Clear();
+  mPairResults.Clear();
+  mPairs = nullptr;
+}
+
+void ParallelNarrowPhase::operator()(uint start, uint end)
+{
+  // Only one range runs on a task worker at a time, so its scratch space is ours
+  uint workerIndex = Z::gJobs->GetTaskWorkerIndex();
+  NarrowPhaseWorkerData& data = *mWorkerData[workerIndex];
+  ClientPairArray& pairs = *mPairs;
+
+  for(uint pairIndex = start; pairIndex < end; ++pairIndex)
+  {
+    ClientPair& clientPair = pairs[pairIndex];
+    Collider* collider1 = static_cast<Collider*>(clientPair.mClientData[0]);
+    Collider* collider2 = static_cast<Collider*>(clientPair.mClientData[1]);
+    NarrowPhasePairResult& result = mPairResults[pairIndex];
+    result.mCollided = false;
+    result.mWorkerIndex = workerIndex;
+    result.mManifoldStart = data.mManifolds.Size();
+    result.mManifoldCount = 0;
+    if(!CanTestOnWorker(collider1, collider2))
+      continue;
+
+    // Collision functions add onto the end of the array
+    uint manifoldStart = data.mManifolds.Size();
+    ColliderPair pair(collider1, collider2);
+    if(!mCollisionManager->TestCollision(pair, data.mManifolds))
+    {
+      for(uint i = manifoldStart; i < data.mManifolds.Size(); ++i)
+        data.mManifolds[i].Clear();
+      data.mManifolds.Resize(manifoldStart);
+      continue;
+    }
+
+    result.mCollided = true;
+    result.mManifoldCount = data.mManifolds.Size() - manifoldStart;
+  }
+}
+
+}//namespace Physics
+
+}//namespace Zero
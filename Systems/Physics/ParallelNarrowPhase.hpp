@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+//-------------------------------------------------------------------NarrowPhaseWorkerData
+/// Scratch space for one thread of the narrow phase. Each thread gets its own
+/// heap so that threads never touch the same memory statistics.
+struct NarrowPhaseWorkerData
+{
+  NarrowPhaseWorkerData(Memory::Heap* parentHeap);
+  ~NarrowPhaseWorkerData();
+
+  void Clear();
+
+  Memory::Heap* mHeap;
+  ManifoldArray mManifolds;
+};
+
+//-------------------------------------------------------------------NarrowPhasePairResult
+/// The result of testing one possible pair on a thread.
+struct NarrowPhasePairResult
+{
+  bool mCollided;
+  /// The thread that tested the pair.
+  uint mWorkerIndex;
+  /// Where the pair's manifolds are in that thread's manifold array.
+  uint mManifoldStart;
+  uint mManifoldCount;
+};
+
+//-------------------------------------------------------------------ParallelNarrowPhase
+/// Tests a space's possible pairs for collision across the task workers of the
+/// job system. The pairs are split into ranges that can run in any order, but
+/// each pair remembers where its results went so that they can be merged back
+/// in pair order (which keeps the space deterministic).
+class ParallelNarrowPhase
+{
+public:
+  ParallelNarrowPhase(Memory::Heap* heap);
+  ~ParallelNarrowPhase();
+
+  /// Is it worth spreading this many pairs across threads?
+  static bool ShouldRunInParallel(uint pairCount);
+  /// Height maps lazily build their internal edge data while colliding
+  /// so any pair with one has to be tested on the main thread.
+  static bool CanTestOnWorker(Collider* collider0, Collider* collider1);
+
+  /// Tests all of the pairs that can be tested on task workers.
+  void TestPairs(CollisionManager* collisionManager, ClientPairArray& pairs);
+  /// Did the pair collide? Only valid for pairs that could be tested on a worker.
+  bool GetPairCollided(uint pairIndex);
+  /// Returns the manifolds generated for the given pair (pairs can be visited in any order).
+  Manifold* GetPairManifolds(uint pairIndex, uint& manifoldCount);
+  void Clear();
+
+  /// Tests the pairs in [start, end) on the calling task worker (the range
+  /// functor given to the job system's ParallelFor).
+  void operator()(uint start, uint end);
+
+  /// The fewest pairs a task worker tests at once.
+  static const uint cChunkSize = 64;
+  /// Below this many pairs the cost of waking threads outweighs the work.
+  static const uint cMinPairCount = 256;
+
+  /// Each pair is only ever written to by the thread that tested its range.
+  Array<NarrowPhasePairResult> mPairResults;
+
+private:
+  Memory::Heap* mHeap;
+  Array<NarrowPhaseWorkerData*> mWorkerData;
+  CollisionManager* mCollisionManager;
+  ClientPairArray* mPairs;
+};
+
+}//namespace Physics
+
+}//namespace Zero
@@ -22,6 +22,7 @@ ZilchDefineType(PhysicsEngine, builder, type)
 PhysicsEngine::PhysicsEngine(void)
 {
   mHeap = new Memory::Heap("Physics", Memory::GetRoot());
+  mCollisionManager = nullptr;
 }
 
 PhysicsEngine::~PhysicsEngine(void)
@@ -304,6 +304,7 @@ ZilchDefineType(PhysicsSolverConfig, builder, type)
   //ZilchBindGetterSetterProperty(SolverType);
 
   ZilchBindGetterSetterProperty(PositionCorrectionType);
+  ZilchBindGetterSetterProperty(IslandSolveMode);
 }
 
 PhysicsSolverConfig::PhysicsSolverConfig()
@@ -312,6 +313,7 @@ PhysicsSolverConfig::PhysicsSolverConfig()
   mPositionCorrectionType = PhysicsSolverPositionCorrection::Baumgarte;
   mSolverType = PhysicsSolverType::Basic;
   mSubType = PhysicsSolverSubType::BasicSolving;
+  mIslandSolveMode = PhysicsIslandSolveMode::Serial;
 }
 
 PhysicsSolverConfig::~PhysicsSolverConfig()
@@ -331,6 +333,7 @@ void PhysicsSolverConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(PhysicsSolverPositionCorrection, mPositionCorrectionType, PhysicsSolverPositionCorrection::PostStabilization);
   SerializeEnumNameDefault(PhysicsSolverType, mSolverType, PhysicsSolverType::Basic);
   SerializeEnumNameDefault(PhysicsSolverSubType, mSubType, PhysicsSolverSubType::BlockSolving);
+  SerializeEnumNameDefault(PhysicsIslandSolveMode, mIslandSolveMode, PhysicsIslandSolveMode::Serial);
 
   // Serialize our composition of constraint config blocks
   BoundType* selfBoundType = this->ZilchGetDerivedType();
@@ -435,6 +438,21 @@ void PhysicsSolverConfig::SetSubCorrectionType(PhysicsSolverSubType::Enum subTyp
   mSubType = subType;
 }
 
+PhysicsIslandSolveMode::Enum PhysicsSolverConfig::GetIslandSolveMode()
+{
+  return mIslandSolveMode;
+}
+
+void PhysicsSolverConfig::SetIslandSolveMode(PhysicsIslandSolveMode::Enum solveMode)
+{
+  if(solveMode >= PhysicsIslandSolveMode::Size)
+  {
+    DoNotifyWarning("Invalid value", "IslandSolveMode must be set to a valid value from the IslandSolveMode enum");
+    return;
+  }
+  mIslandSolveMode = solveMode;
+}
+
 ConstraintConfigBlock& PhysicsSolverConfig::GetContactBlock()
 {
   return mContactBlock;
@@ -475,6 +493,7 @@ void PhysicsSolverConfig::CopyTo(PhysicsSolverConfig* destination)
   destination->mPositionCorrectionType = mPositionCorrectionType;
   destination->mSolverType = mSolverType;
   destination->mSubType = mSubType;
+  destination->mIslandSolveMode = mIslandSolveMode;
 
   // Clear the old blocks from our destination
   DeleteObjectsInContainer(destination->mBlocks);
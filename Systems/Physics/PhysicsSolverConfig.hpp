@@ -22,6 +22,10 @@ DeclareEnum3(ConstraintPositionCorrection, Baumgarte, PostStabilization, Inherit
 DeclareEnum2(PhysicsSolverSubType, BasicSolving, BlockSolving);
 /// How to compute the tangents for a contact point. Mainly for testing.
 DeclareEnum3(PhysicsContactTangentTypes, OrthonormalTangents, VelocityTangents, RandomTangents);
+/// How the islands of a space are solved.
+/// <param name="Serial">Solve each island one after another on the main thread.</param>
+/// <param name="Parallel">Solve islands at the same time on the task workers of the job system.</param>
+DeclareEnum2(PhysicsIslandSolveMode, Serial, Parallel);
 
 //-------------------------------------------------------------------ConstraintConfigBlock
 /// A block of information for solving a joint (or constraint) type.
@@ -137,6 +141,10 @@ public:
   /// What kind of solver to use for post stabilization. Mostly for testing.
   PhysicsSolverSubType::Enum GetSubCorrectionType();
   void SetSubCorrectionType(PhysicsSolverSubType::Enum subType);
+  /// Whether islands are solved one at a time or spread across threads. Islands
+  /// don't share any dynamic bodies so the results are the same either way.
+  PhysicsIslandSolveMode::Enum GetIslandSolveMode();
+  void SetIslandSolveMode(PhysicsIslandSolveMode::Enum solveMode);
 
   //-------------------------------------------------------------------Internal
   ConstraintConfigBlock& GetContactBlock();
@@ -161,6 +169,7 @@ public:
   PhysicsSolverType::Enum mSolverType;
   PhysicsSolverPositionCorrection::Enum mPositionCorrectionType;
   PhysicsSolverSubType::Enum mSubType;
+  PhysicsIslandSolveMode::Enum mIslandSolveMode;
 
   Array<ConstraintConfigBlock*> mBlocks;
 
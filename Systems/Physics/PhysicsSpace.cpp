@@ -206,6 +206,7 @@ PhysicsSpace::PhysicsSpace()
   mBroadPhase = nullptr;
   mContactManager = nullptr;
   mIslandManager = nullptr;
+  mParallelNarrowPhase = nullptr;
   mWorldCollider = nullptr;
   mNodeManager = nullptr;
 
@@ -232,6 +233,7 @@ PhysicsSpace::~PhysicsSpace()
   Memory::HeapDeallocate(mHeap, mNodeManager);
   Memory::HeapDeallocate(mHeap, mIslandManager);
   Memory::HeapDeallocate(mHeap, mContactManager);
+  Memory::HeapDeallocate(mHeap, mParallelNarrowPhase);
 
   SafeDelete(mBroadPhase);
 
@@ -256,6 +258,7 @@ void PhysicsSpace::Initialize(CogInitializer& initializer)
 {
   mPhysicsEngine = Z::gEngine->has(PhysicsEngine);
   mHeap = mPhysicsEngine->mHeap;
+  mParallelNarrowPhase = Memory::HeapAllocate<Physics::ParallelNarrowPhase>(mHeap, mHeap);
 
   mContactManager = Memory::HeapAllocate<Physics::ContactManager>(mHeap);
   mContactManager->mSpace = this;
@@ -732,11 +735,15 @@ void PhysicsSpace::IntegrateBodiesVelocity(real dt)
     }
 
     if(!body.GetStatic())
-      Physics::Integration::IntegrateVelocity(&body, dt);
+      mIntegrationBatch.AddVelocityBody(&body, dt);
 
     body.mForceAccumulator.ZeroOut();
     body.mTorqueAccumulator.ZeroOut();
   }
+
+  // Integrate all of the gathered bodies at once (see Integration::IntegrateRk2Velocity)
+  mIntegrationBatch.IntegrateVelocities(dt, mMaxVelocity);
+  mIntegrationBatch.CommitVelocities();
 }
 
 void PhysicsSpace::IntegrateBodiesPosition(real dt)
@@ -748,14 +755,15 @@ void PhysicsSpace::IntegrateBodiesPosition(real dt)
     RigidBody& body = range.Front();
 
     if(!body.GetStatic())
-    {
-      Physics::Integration::IntegratePosition(&body, dt);
-      // Attempt to sleep the body.
-      body.UpdateSleepTimer(dt);
-    }
+      mIntegrationBatch.AddPositionBody(&body);
 
     range.PopFront();
   }
+
+  // Integrate all of the gathered bodies at once (see Integration::IntegrateRk2Position).
+  // Committing also attempts to sleep each body.
+  mIntegrationBatch.IntegratePositions(dt);
+  mIntegrationBatch.CommitPositions(dt);
 }
 
 void PhysicsSpace::BroadPhase()
@@ -810,6 +818,14 @@ void PhysicsSpace::NarrowPhase()
   Collisions.SetAllocator(allocator);
 
   uint size = mPossiblePairs.Size();
+
+  // Test what we can on the task workers up front, the results are
+  // merged below in pair order so that the contacts are added in the same
+  // order as if the pairs were tested one at a time.
+  bool testedInParallel = Physics::ParallelNarrowPhase::ShouldRunInParallel(size);
+  if(testedInParallel)
+    mParallelNarrowPhase->TestPairs(mCollisionManager, mPossiblePairs);
+
   for(unsigned pairIndex = 0; pairIndex < size; ++pairIndex)
   {
     ClientPair* clientPair = &mPossiblePairs[pairIndex];
@@ -818,11 +834,24 @@ void PhysicsSpace::NarrowPhase()
     // Convert the proxy to a collider
     ColliderPair pair(collider1, collider2);
 
-    // Test for collision
-    if(!mCollisionManager->TestCollision(pair, tempManifolds))
+    Physics::Manifold* manifolds = nullptr;
+    uint manifoldCount = 0;
+    if(testedInParallel && Physics::ParallelNarrowPhase::CanTestOnWorker(collider1, collider2))
     {
-      tempManifolds.Clear();
-      continue;
+      if(!mParallelNarrowPhase->GetPairCollided(pairIndex))
+        continue;
+      manifolds = mParallelNarrowPhase->GetPairManifolds(pairIndex, manifoldCount);
+    }
+    else
+    {
+      // Test for collision
+      if(!mCollisionManager->TestCollision(pair, tempManifolds))
+      {
+        tempManifolds.Clear();
+        continue;
+      }
+      manifolds = tempManifolds.Data();
+      manifoldCount = tempManifolds.Size();
     }
 
     // If tracking is enabled, we need to record the collision
@@ -834,16 +863,19 @@ void PhysicsSpace::NarrowPhase()
     }
 
     // Add all manifolds to the contact manager
-    for(uint i = 0; i < tempManifolds.Size(); ++i)
+    for(uint i = 0; i < manifoldCount; ++i)
     {
-      Physics::Manifold& manifold = tempManifolds[i];
-      mContactManager->AddManifold(tempManifolds[i]);
+      Physics::Manifold& manifold = manifolds[i];
+      mContactManager->AddManifold(manifold);
       manifold.Clear();
     }
 
     tempManifolds.Clear();
   }
 
+  if(testedInParallel)
+    mParallelNarrowPhase->Clear();
+
   mBroadPhase->RecordFrameResults(Collisions);
 
   // We have all connections for the frame so build the islands.
@@ -369,6 +369,11 @@ private:
   // Stores the objects returned from the broad phase for that frame.  It is
   // not created on the stack each frame to avoid allocations.
   ClientPairArray mPossiblePairs;
+  // The awake bodies' integration state in structure-of-arrays form. Kept
+  // around between frames for the same reason as the possible pairs.
+  Physics::BodyIntegrationBatch mIntegrationBatch;
+  // Tests the possible pairs across the task workers when there's enough of them.
+  Physics::ParallelNarrowPhase* mParallelNarrowPhase;
 
   // Stores all broad phase information.
   BroadPhasePackage* mBroadPhase;
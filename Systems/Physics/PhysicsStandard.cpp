@@ -82,6 +82,7 @@ ZilchDefineStaticLibrary(PhysicsLibrary)
   ZilchInitializeEnum(PhysicsIslandType);
   ZilchInitializeEnum(PhysicsIslandPreProcessingMode);
   ZilchInitializeEnum(PhysicsContactTangentTypes);
+  ZilchInitializeEnum(PhysicsIslandSolveMode);
   ZilchInitializeEnum(JointFrameOfReference);
   ZilchInitializeEnum(AxisDirection);
   ZilchInitializeEnum(PhysicsEffectInterpolationType);
@@ -149,12 +149,14 @@ public:
 
 #include "RayCast.hpp"
 #include "Manifold.hpp"
+#include "BodyIntegrationBatch.hpp"
 #include "PhysicsSpace.hpp"
 
 // BroadPhase
 #include "Analyzer.hpp"
 // NarrowPhase
 #include "CollisionManager.hpp"
+#include "ParallelNarrowPhase.hpp"
 #include "ContactManager.hpp"
 #include "CustomCollisionEventTracker.hpp"
 #include "TimeOfImpact.hpp"
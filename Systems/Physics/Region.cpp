@@ -20,7 +20,7 @@ ZilchDefineType(Region, builder, type)
 
   ZilchBindFieldProperty(mWakeUpOnEffectChange)->ZeroSerialize(true);
 
-  ZilchBindMethod(DispatchEvent);
+  ZilchBindOverloadedMethod(DispatchEvent, ZilchInstanceOverload(void, StringParam, Event*));
   ZeroBindTag(Tags::Physics);
 }
 
@@ -64,6 +64,20 @@ void Region::DispatchEvent(StringParam eventId, Event* toSend)
   }
 }
 
+void Region::DispatchEvent(const InternedEventName& eventId, Event* toSend)
+{
+  // Same as above, overridden so the event constant doesn't go to the region's own object
+  RegionContactRange r = All();
+  while(!r.Empty())
+  {
+    Collider* collider = r.Front();
+    r.PopFront();
+
+    Cog* cog = collider->GetOwner();
+    cog->DispatchEvent(eventId, toSend);
+  }
+}
+
 void Region::AddEffect(PhysicsEffect* effect)
 {
   mEffects.PushBack(effect);
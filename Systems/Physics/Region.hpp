@@ -25,6 +25,7 @@ public:
 
   /// Dispatches an event to all objects in this region.
   void DispatchEvent(StringParam eventId, Event* toSend);
+  void DispatchEvent(const InternedEventName& eventId, Event* toSend);
 
   void AddEffect(PhysicsEffect* effect);
   void RemoveEffect(PhysicsEffect* effect);
@@ -160,6 +160,8 @@ void AudioMixer::Update()
 //**************************************************************************************************
 void AudioMixer::MixLoopThreaded()
 {
+  Profile::ProfileSystem::Instance->SetThreadName("AudioMix");
+
 #ifdef TRACK_TIME 
   double maxTime = ??
 #endif
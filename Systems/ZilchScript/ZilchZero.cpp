@@ -214,6 +214,10 @@ void ZilchComponent::ScriptInitialize(CogInitializer& initializer)
 //**************************************************************************************************
 void ZilchComponent::OnDestroy(uint flags)
 {
+  // Stop being updated by any update list the script added us to
+  if(Space* space = GetSpace())
+    space->mUpdateLists.Remove(this);
+
   BoundType* thisType = ZilchVirtualTypeId(this);
 
   Core& core = Core::GetInstance();
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file HashMapTest.cpp
+///  Unit tests and benchmarks for the chained and flat hash map tables.
+///
+///  Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Containers/HashMap.hpp"
+#include "Containers/HashSet.hpp"
+#include "Containers/FlatHashedContainer.hpp"
+#include "String/String.hpp"
+
+#include "WindowsDebugTimer.hpp"
+
+using Zero::String;
+using Zero::Array;
+using Zero::HashMap;
+using Zero::HashSet;
+using Zero::HashPolicy;
+using Zero::DefaultAllocator;
+using Zero::FlatHashTable;
+
+// How many keys each benchmark inserts and how many times each key is looked up
+const uint cHashBenchmarkKeys = 100000;
+const uint cHashBenchmarkLookups = 10;
+
+template <typename KeyType>
+struct FlatMap
+{
+  typedef HashMap<KeyType, uint, HashPolicy<KeyType>, DefaultAllocator, FlatHashTable> type;
+};
+
+//------------------------------------------------------------------- Key Makers
+String MakeStringKey(uint i)
+{
+  return String::Format("Resource%u", i);
+}
+
+int* MakePointerKey(uint i)
+{
+  // Pointers to objects are aligned, so the low bits are always the same
+  return (int*)(size_t)(0x10000 + i * 16);
+}
+
+u64 MakeU64Key(uint i)
+{
+  // Ids that only differ in their high bits (like our 64 bit resource ids)
+  return (u64)i << 32 | 0xFF;
+}
+
+//------------------------------------------------------------------ Test Helpers
+// Inserts, erases and finds the same keys in both tables and checks that they always agree
+template <typename KeyType>
+void CheckTablesAgree(Array<KeyType>& keys)
+{
+  HashMap<KeyType, uint> chained;
+  typename FlatMap<KeyType>::type flat;
+
+  for(uint i = 0; i < keys.Size(); ++i)
+  {
+    chained.Insert(keys[i], i);
+    flat.Insert(keys[i], i);
+  }
+  CHECK_EQUAL(chained.Size(), flat.Size());
+
+  // Erase every third key
+  for(uint i = 0; i < keys.Size(); i += 3)
+  {
+    CHECK(chained.Erase(keys[i]));
+    CHECK(flat.Erase(keys[i]));
+    CHECK(!flat.Erase(keys[i]));
+  }
+  CHECK_EQUAL(chained.Size(), flat.Size());
+
+  // Re-insert half of the erased keys (these reuse deleted slots) with new values
+  for(uint i = 0; i < keys.Size(); i += 6)
+  {
+    chained.Insert(keys[i], i + 1);
+    flat.Insert(keys[i], i + 1);
+  }
+
+  for(uint i = 0; i < keys.Size(); ++i)
+  {
+    uint invalid = uint(-1);
+    CHECK_EQUAL(chained.FindValue(keys[i], invalid), flat.FindValue(keys[i], invalid));
+    CHECK_EQUAL(chained.ContainsKey(keys[i]), flat.ContainsKey(keys[i]));
+  }
+
+  // Iteration should visit every key exactly once
+  uint visited = 0;
+  typename FlatMap<KeyType>::type::range range = flat.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    CHECK_EQUAL(chained.FindValue(range.Front().first, uint(-1)), range.Front().second);
+    ++visited;
+  }
+  CHECK_EQUAL(chained.Size(), visited);
+
+  flat.Clear();
+  CHECK(flat.Empty());
+  CHECK(flat.All().Empty());
+}
+
+template <typename MapType, typename KeyType>
+void BenchmarkTable(Array<KeyType>& keys)
+{
+  MapType map;
+  for(uint i = 0; i < keys.Size(); ++i)
+    map.Insert(keys[i], i);
+
+  uint sum = 0;
+  for(uint lookup = 0; lookup < cHashBenchmarkLookups; ++lookup)
+  {
+    for(uint i = 0; i < keys.Size(); ++i)
+      sum += map.FindValue(keys[i], 0);
+  }
+
+  for(uint i = 0; i < keys.Size(); i += 2)
+    map.Erase(keys[i]);
+
+  CHECK(sum != 0);
+  CHECK_EQUAL(keys.Size() / 2, map.Size());
+}
+
+template <typename KeyType>
+void MakeKeys(Array<KeyType>& keys, KeyType (*makeKey)(uint), uint count)
+{
+  keys.Reserve(count);
+  for(uint i = 0; i < count; ++i)
+    keys.PushBack(makeKey(i));
+}
+
+//----------------------------------------------------------------------- Tests
+TEST(FlatHashMap_StringKeys)
+{
+  Array<String> keys;
+  MakeKeys(keys, &MakeStringKey, 5000);
+  CheckTablesAgree(keys);
+}
+
+TEST(FlatHashMap_PointerKeys)
+{
+  Array<int*> keys;
+  MakeKeys(keys, &MakePointerKey, 5000);
+  CheckTablesAgree(keys);
+}
+
+TEST(FlatHashMap_U64Keys)
+{
+  Array<u64> keys;
+  MakeKeys(keys, &MakeU64Key, 5000);
+  CheckTablesAgree(keys);
+}
+
+TEST(FlatHashMap_OperatorBracket)
+{
+  FlatMap<String>::type map;
+  map["a"] += 1;
+  map["a"] += 1;
+  map["b"] += 1;
+  CHECK_EQUAL(2, map.Size());
+  CHECK_EQUAL(2, map["a"]);
+  CHECK_EQUAL(1, map["b"]);
+
+  FlatMap<String>::type::range found = map.Find("a");
+  CHECK(!found.Empty());
+  found.PopFront();
+  CHECK(found.Empty());
+  CHECK(map.Find("c").Empty());
+}
+
+TEST(FlatHashSet_Basic)
+{
+  HashSet<u64, HashPolicy<u64>, DefaultAllocator, FlatHashTable> set;
+  for(uint i = 0; i < 1000; ++i)
+    set.Insert(MakeU64Key(i));
+
+  for(uint i = 0; i < 1000; i += 2)
+    set.Erase(MakeU64Key(i));
+
+  CHECK_EQUAL(500, set.Size());
+  for(uint i = 0; i < 1000; ++i)
+    CHECK_EQUAL(i % 2 == 1, set.Contains(MakeU64Key(i)));
+
+  HashSet<u64, HashPolicy<u64>, DefaultAllocator, FlatHashTable> copy(set);
+  CHECK_EQUAL(500, copy.Size());
+}
+
+//------------------------------------------------------------------ Benchmarks
+TEST(HashMapBenchmark_String)
+{
+  Array<String> keys;
+  MakeKeys(keys, &MakeStringKey, cHashBenchmarkKeys);
+  {
+    WindowsDebugTimer timer("HashMap Chained String");
+    BenchmarkTable<HashMap<String, uint> >(keys);
+  }
+  {
+    WindowsDebugTimer timer("HashMap Flat String");
+    BenchmarkTable<FlatMap<String>::type>(keys);
+  }
+}
+
+TEST(HashMapBenchmark_Pointer)
+{
+  Array<int*> keys;
+  MakeKeys(keys, &MakePointerKey, cHashBenchmarkKeys);
+  {
+    WindowsDebugTimer timer("HashMap Chained Pointer");
+    BenchmarkTable<HashMap<int*, uint> >(keys);
+  }
+  {
+    WindowsDebugTimer timer("HashMap Flat Pointer");
+    BenchmarkTable<FlatMap<int*>::type>(keys);
+  }
+}
+
+TEST(HashMapBenchmark_U64)
+{
+  Array<u64> keys;
+  MakeKeys(keys, &MakeU64Key, cHashBenchmarkKeys);
+  {
+    WindowsDebugTimer timer("HashMap Chained u64");
+    BenchmarkTable<HashMap<u64, uint> >(keys);
+  }
+  {
+    WindowsDebugTimer timer("HashMap Flat u64");
+    BenchmarkTable<FlatMap<u64>::type>(keys);
+  }
+}
@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file RadixSortTest.cpp
+///  Unit tests and benchmarks for the radix sort on 64 bit keys.
+///
+///  Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Containers/Algorithm.hpp"
+#include "Containers/RadixSort.hpp"
+#include "String/String.hpp"
+
+#include "WindowsDebugTimer.hpp"
+
+using Zero::Array;
+using Zero::RadixSort;
+using Zero::RadixSortBlocks;
+
+// Laid out like a render entry, a pointer to the data followed by a packed sort value
+struct SortEntry
+{
+  bool operator<(const SortEntry& other) const { return mSort < other.mSort; }
+
+  void* mData;
+  u64 mSort;
+  uint mOrder;
+};
+
+struct SortEntryKey
+{
+  u64 operator()(const SortEntry& entry) const { return entry.mSort; }
+};
+
+//------------------------------------------------------------------ Test Helpers
+// Simple deterministic generator so every run sorts the same values
+uint NextRandom(uint& state)
+{
+  state = state * 1664525 + 1013904223;
+  return state;
+}
+
+// A few groups in the high 32 bits and a sort value in the low 32 bits,
+// the sort values are limited to valueRange so that there are many equal keys
+void MakeEntries(Array<SortEntry>& entries, uint count, uint groupCount, uint valueRange)
+{
+  uint state = count;
+  entries.Resize(count);
+  for(uint i = 0; i < count; ++i)
+  {
+    u64 group = NextRandom(state) % groupCount;
+    u64 value = NextRandom(state) % valueRange;
+    entries[i].mData = nullptr;
+    entries[i].mSort = group << 32 | value;
+    entries[i].mOrder = i;
+  }
+}
+
+// Large enough to take the block path of GraphicalEntrySorter (two of its 16384 entry
+// minimum) plus a last block that isn't full
+const uint cBlockSortCount = 2 * 16384 + 1000;
+
+// The keys must be in order and equal keys must still be in the order they were made
+void CheckSortedAndStable(Array<SortEntry>& entries)
+{
+  for(uint i = 1; i < entries.Size(); ++i)
+  {
+    CHECK(entries[i - 1].mSort <= entries[i].mSort);
+    if(entries[i - 1].mSort == entries[i].mSort)
+      CHECK(entries[i - 1].mOrder < entries[i].mOrder);
+  }
+}
+
+void BenchmarkSorts(uint count)
+{
+  Array<SortEntry> source;
+  MakeEntries(source, count, 8, uint(-1));
+
+  Array<SortEntry> comparisonSorted(source);
+  {
+    WindowsDebugTimer timer(String::Format("Sort %u", count));
+    Zero::Sort(comparisonSorted.All());
+  }
+
+  Array<SortEntry> radixSorted(source);
+  Array<SortEntry> scratch;
+  {
+    WindowsDebugTimer timer(String::Format("RadixSort %u", count));
+    RadixSort(radixSorted, scratch, SortEntryKey());
+  }
+
+  // The blocks run on this thread here, so this is the cost of splitting the sort up
+  Array<SortEntry> blockSorted(source);
+  Array<Zero::RadixHistogram> blockCounts;
+  Zero::RadixSerialFor serialFor;
+  {
+    WindowsDebugTimer timer(String::Format("RadixSortBlocks %u", count));
+    RadixSortBlocks(blockSorted.Data(), count, scratch.Data(), blockCounts, SortEntryKey(), serialFor);
+  }
+
+  for(uint i = 0; i < count; ++i)
+  {
+    CHECK_EQUAL(comparisonSorted[i].mSort, radixSorted[i].mSort);
+    CHECK_EQUAL(comparisonSorted[i].mSort, blockSorted[i].mSort);
+  }
+}
+
+//----------------------------------------------------------------------- Tests
+TEST(RadixSort_Empty)
+{
+  Array<SortEntry> entries;
+  Array<SortEntry> scratch;
+  RadixSort(entries, scratch, SortEntryKey());
+  CHECK_EQUAL(0, entries.Size());
+
+  MakeEntries(entries, 1, 1, 1);
+  RadixSort(entries, scratch, SortEntryKey());
+  CHECK_EQUAL(1, entries.Size());
+}
+
+TEST(RadixSort_MatchesSort)
+{
+  Array<SortEntry> entries;
+  MakeEntries(entries, 5000, 6, uint(-1));
+
+  Array<SortEntry> expected(entries);
+  Zero::Sort(expected.All());
+
+  Array<SortEntry> scratch;
+  RadixSort(entries, scratch, SortEntryKey());
+  for(uint i = 0; i < entries.Size(); ++i)
+    CHECK_EQUAL(expected[i].mSort, entries[i].mSort);
+}
+
+TEST(RadixSort_Stable)
+{
+  Array<SortEntry> entries;
+  Array<SortEntry> scratch;
+
+  // Many duplicate keys
+  MakeEntries(entries, 5000, 4, 16);
+  RadixSort(entries, scratch, SortEntryKey());
+  CheckSortedAndStable(entries);
+
+  // Every key the same, every pass is skipped
+  MakeEntries(entries, 1000, 1, 1);
+  RadixSort(entries, scratch, SortEntryKey());
+  CheckSortedAndStable(entries);
+}
+
+TEST(RadixSort_FullKeys)
+{
+  // Keys that differ in every byte
+  Array<SortEntry> entries;
+  uint state = 7;
+  entries.Resize(3000);
+  for(uint i = 0; i < entries.Size(); ++i)
+  {
+    entries[i].mSort = (u64)NextRandom(state) << 32 | NextRandom(state);
+    entries[i].mOrder = i;
+  }
+  entries[10].mSort = u64(-1);
+  entries[20].mSort = 0;
+
+  Array<SortEntry> scratch;
+  RadixSort(entries, scratch, SortEntryKey());
+  CheckSortedAndStable(entries);
+  CHECK_EQUAL(0, entries.Front().mSort);
+  CHECK_EQUAL(u64(-1), entries.Back().mSort);
+}
+
+TEST(RadixSortBlocks_MatchesSort)
+{
+  Array<SortEntry> entries;
+  MakeEntries(entries, cBlockSortCount, 6, uint(-1));
+
+  Array<SortEntry> expected(entries);
+  Zero::Sort(expected.All());
+
+  Array<SortEntry> scratch;
+  scratch.Resize(entries.Size());
+  Array<Zero::RadixHistogram> blockCounts;
+  Zero::RadixSerialFor serialFor;
+  RadixSortBlocks(entries.Data(), entries.Size(), scratch.Data(), blockCounts, SortEntryKey(), serialFor);
+  for(uint i = 0; i < entries.Size(); ++i)
+    CHECK_EQUAL(expected[i].mSort, entries[i].mSort);
+}
+
+TEST(RadixSortBlocks_Stable)
+{
+  Array<SortEntry> entries;
+  Array<SortEntry> scratch;
+  Array<Zero::RadixHistogram> blockCounts;
+  Zero::RadixSerialFor serialFor;
+
+  // Many duplicate keys spread over every block
+  MakeEntries(entries, cBlockSortCount, 4, 16);
+  scratch.Resize(entries.Size());
+  RadixSortBlocks(entries.Data(), entries.Size(), scratch.Data(), blockCounts, SortEntryKey(), serialFor);
+  CheckSortedAndStable(entries);
+
+  // The counts are reused by the next sort, this time with every key the same
+  MakeEntries(entries, cBlockSortCount, 1, 1);
+  RadixSortBlocks(entries.Data(), entries.Size(), scratch.Data(), blockCounts, SortEntryKey(), serialFor);
+  CheckSortedAndStable(entries);
+}
+
+//------------------------------------------------------------------ Benchmarks
+TEST(RadixSortBenchmark_1k)
+{
+  BenchmarkSorts(1000);
+}
+
+TEST(RadixSortBenchmark_10k)
+{
+  BenchmarkSorts(10000);
+}
+
+TEST(RadixSortBenchmark_BlockSort)
+{
+  BenchmarkSorts(cBlockSortCount);
+}
+
+TEST(RadixSortBenchmark_100k)
+{
+  BenchmarkSorts(100000);
+}
@@ -67,7 +67,9 @@ public:
 #include "Containers/Hashing.hpp"
 #include "Containers/HashMap.hpp"
 #include "Containers/HashSet.hpp"
+#include "Containers/FlatHashedContainer.hpp"
 #include "Containers/SlotMap.hpp"
+#include "Containers/RadixSort.hpp"
 #include "Memory/Block.hpp"
 #include "Memory/Graph.hpp"
 #include "Memory/Heap.hpp"
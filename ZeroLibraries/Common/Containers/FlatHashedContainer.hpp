@@ -0,0 +1,567 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file FlatHashedContainer.hpp
+/// Open addressed container that can be used to implement HashMap and HashSet.
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Allocator.hpp"
+#include "Hashing.hpp"
+#include "HashedContainer.hpp"
+#include "Utility/Misc.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define ZeroFlatHashSse2 1
+#include <emmintrin.h>
+#else
+#define ZeroFlatHashSse2 0
+#endif
+
+namespace Zero
+{
+
+//Every slot in the table has one control byte. Full slots store the low 7 bits
+//of the hash (so the high bit is never set), open slots use the values below.
+const byte cFlatHashEmpty = 0x80;
+const byte cFlatHashDeleted = 0xFE;
+
+//The control bytes are probed a whole group at a time (one sse2 register).
+const size_t cFlatHashGroupWidth = 16;
+
+//Returns a bit mask of which control bytes in the group are equal to the value.
+inline u32 FlatHashMatchGroup(const byte* control, byte value)
+{
+#if ZeroFlatHashSse2
+  __m128i group = _mm_loadu_si128((const __m128i*)control);
+  __m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)value));
+  return (u32)_mm_movemask_epi8(match);
+#else
+  u32 mask = 0;
+  for(size_t i = 0; i < cFlatHashGroupWidth; ++i)
+  {
+    if(control[i] == value)
+      mask |= (1 << i);
+  }
+  return mask;
+#endif
+}
+
+//Returns a bit mask of which control bytes in the group are empty or deleted.
+inline u32 FlatHashMatchOpen(const byte* control)
+{
+#if ZeroFlatHashSse2
+  //Only open slots have the high bit set
+  __m128i group = _mm_loadu_si128((const __m128i*)control);
+  return (u32)_mm_movemask_epi8(group);
+#else
+  u32 mask = 0;
+  for(size_t i = 0; i < cFlatHashGroupWidth; ++i)
+  {
+    if(control[i] & 0x80)
+      mask |= (1 << i);
+  }
+  return mask;
+#endif
+}
+
+//Open addressed hash table. Values are stored directly in a power of two sized
+//table and a parallel array of control bytes says which slots are full. A lookup
+//compares 16 control bytes at once against 7 bits of the hash, so only slots
+//that are very likely to match ever have their values compared, and there is no
+//modulo or chain of nodes to follow. Has the same interface as HashedContainer
+//so it can be swapped in under HashMap and HashSet (see FlatHashTable).
+template<typename ValueType, typename Hasher, typename Allocator>
+class ZeroSharedTemplate FlatHashedContainer : public AllocationContainer<Allocator>
+{
+public:
+  //standard container typedefs
+  typedef ValueType value_type;
+  typedef size_t size_type;
+  typedef ValueType& reference;
+  typedef const ValueType& const_reference;
+  typedef AllocationContainer<Allocator> base_type;
+  typedef FlatHashedContainer<ValueType, Hasher, Allocator> this_type;
+  using base_type::mAllocator;
+
+protected:
+  //Internal node value (whether it is valid is stored in the control bytes)
+  struct Node
+  {
+    ValueType Value;
+  };
+
+public:
+  //
+  struct InsertResult
+  {
+    bool mIsNewInsert;
+    ValueType* mValue;
+
+    InsertResult(bool newInsert, Node* node) : mIsNewInsert(newInsert), mValue(&node->Value) {}
+
+    operator bool() const { return mIsNewInsert; }
+  };
+
+  //Default constructor
+  FlatHashedContainer()
+  {
+    mTableSize = 0;
+    mSize = 0;
+    mDeleted = 0;
+    mTable = nullptr;
+    mControl = nullptr;
+    mMaxLoadFactor = 0.875f;
+  }
+
+  ~FlatHashedContainer()
+  {
+    Deallocate();
+  }
+
+  //Range for hash map.
+  struct range
+  {
+    typedef typename this_type::value_type value_type;
+    typedef reference FrontResult;
+
+    range()
+      : begin(nullptr), end(nullptr), control(nullptr), mSize(0)
+    {}
+
+    //When no control bytes are given every node in the range must be valid
+    range(Node* rbegin, Node* rend, size_t size, const byte* rcontrol = nullptr)
+      : begin(rbegin), end(rend), control(rcontrol)
+    {
+      mSize = size;
+    }
+
+    bool Empty()
+    {
+      return begin == end;
+    }
+
+    reference Front()
+    {
+      return begin->Value;
+    }
+
+    void PopFront()
+    {
+      ErrorIf(Empty(), "Popped an empty range.");
+      ++begin;
+      --mSize;
+
+      //Once every value has been visited we're done, which also
+      //saves walking the open slots at the end of the table
+      if(mSize == 0)
+      {
+        begin = end;
+        return;
+      }
+
+      //Skip open slots
+      if(control != nullptr)
+      {
+        ++control;
+        while(begin != end && (*control & 0x80))
+        {
+          ++begin;
+          ++control;
+        }
+      }
+    }
+
+    size_t Length() { return mSize; }
+
+    size_type Size() { return Length(); }
+    range& All() { return *this; }
+
+  private:
+    Node* begin;
+    Node* end;
+    const byte* control;
+    size_t mSize;
+  };
+
+  ///////Container Global Modify//////////////////
+
+  //Rehash the contents of the table.
+  void Rehash(size_type newTableSize)
+  {
+    //The table size must be a power of two and a multiple of the group width
+    size_type tableSize = cFlatHashGroupWidth;
+    while(tableSize < newTableSize)
+      tableSize *= 2;
+
+    if(float(mSize) > float(tableSize) * mMaxLoadFactor)
+      return;
+
+    Node* oldTable = mTable;
+    byte* oldControl = mControl;
+    size_type oldTableSize = mTableSize;
+
+    //The control bytes live in the same allocation just after the nodes
+    AllocateTable(tableSize);
+    mSize = 0;
+
+    //Now reinsert all valid values (we know they're all unique)
+    for(size_type i = 0; i < oldTableSize; ++i)
+    {
+      if(oldControl[i] & 0x80)
+        continue;
+
+      Node* node = oldTable + i;
+      size_t hash = MixHash(mHasher(node->Value));
+      FillOpenNode(FindOpenSlot(hash), hash, node->Value);
+      node->Value.~ValueType();
+    }
+
+    //Free the old table if it existed
+    if(oldTable != nullptr)
+      mAllocator.Deallocate(oldTable, GetAllocationSize(oldTableSize));
+  }
+
+  //Destroy all elements.
+  void Clear()
+  {
+    DestructTableValues();
+    mSize = 0;
+    mDeleted = 0;
+  }
+
+  //Destroy all elements and frees all memory.
+  void Deallocate()
+  {
+    if(mTable != nullptr)
+    {
+      DestructTableValues();
+      mAllocator.Deallocate(mTable, GetAllocationSize(mTableSize));
+    }
+
+    mTableSize = 0;
+    mSize = 0;
+    mDeleted = 0;
+    mTable = nullptr;
+    mControl = nullptr;
+  }
+
+  range All() const
+  {
+    if(mSize == 0)
+      return range(mTable, mTable, 0);
+
+    //Start on the first valid node
+    size_type start = 0;
+    while(mControl[start] & 0x80)
+      ++start;
+    return range(mTable + start, mTable + mTableSize, mSize, mControl + start);
+  }
+
+  void Swap(this_type& other)
+  {
+    Zero::Swap(mTable, other.mTable);
+    Zero::Swap(mControl, other.mControl);
+    Zero::Swap(mTableSize, other.mTableSize);
+    Zero::Swap(mSize, other.mSize);
+    Zero::Swap(mDeleted, other.mDeleted);
+    Zero::Swap(mMaxLoadFactor, other.mMaxLoadFactor);
+    Zero::Swap(mHasher, other.mHasher);
+  }
+
+  ////////////Insertion///////////////////////
+
+  //Override
+  static Node* OnCollisionOverride(Node* dest, const_reference value)
+  {
+    dest->Value = value;
+    return dest;
+  }
+
+  //Error
+  static Node* OnCollisionError(Node* dest, const_reference value)
+  {
+    (void)value;
+    (void)dest;
+    Error("Double Insert, value was not inserted!");
+    return nullptr;
+  }
+
+  //Just return the bucket
+  static Node* OnCollisionReturn(Node* dest, const_reference value)
+  {
+    (void)value;
+    return dest;
+  }
+
+  //Insert a value.
+  template <typename CollisionFunc>
+  InsertResult InsertInternal(const_reference value, CollisionFunc onCollison)
+  {
+    size_t hash = MixHash(mHasher(value));
+
+    //Check for the value already being in the table
+    Node* node = FindHashed(value, hash, mHasher);
+    if(node != cHashOpenNode)
+    {
+      onCollison(node, value);
+      return InsertResult(false, node);
+    }
+
+    //Deleted slots are counted as used so that there is always an empty slot to end a probe.
+    //If most of the used slots are deleted we just rehash at the same size to clear them out.
+    if(mTableSize == 0 || float(mSize + mDeleted + 1) > float(mTableSize) * mMaxLoadFactor)
+    {
+      if(mDeleted > mSize)
+        Rehash(mTableSize);
+      else
+        Rehash(mTableSize == 0 ? cFlatHashGroupWidth : mTableSize * 2);
+    }
+
+    node = FindOpenSlot(hash);
+    if(mControl[node - mTable] == cFlatHashDeleted)
+      --mDeleted;
+
+    FillOpenNode(node, hash, value);
+    return InsertResult(true, node);
+  }
+
+  ////////Find//////////////////////////////
+
+  //Find an element value that hashes and compares to a
+  //value in the hash map.
+  template<typename searchType, typename searchHasherType>
+  Node* InternalFindAs(const searchType& searchValue,
+                       searchHasherType searchHasher) const
+  {
+    if(mSize == 0)
+      return (Node*)cHashOpenNode;
+
+    return FindHashed(searchValue, MixHash(searchHasher(searchValue)), searchHasher);
+  }
+
+  size_t Count(const_reference value)
+  {
+    Node* foundNode = InternalFindAs(value, mHasher);
+    if(foundNode != cHashOpenNode)
+      return 1;
+    else
+      return 0;
+  }
+
+  ///////Erasing//////////////////////////
+
+  //Erase a value if found.
+  bool Erase(const_reference value)
+  {
+    Node* foundNode = InternalFindAs(value, mHasher);
+    if(foundNode != cHashOpenNode)
+    {
+      EraseNode(foundNode);
+      return true;
+    }
+    return false;
+  }
+
+  void EraseNode(Node* node)
+  {
+    size_type index = node - mTable;
+    ErrorIf(node == nullptr || index >= mTableSize || (mControl[index] & 0x80),
+            "Attempted to erase an invalid node.");
+
+    node->Value.~ValueType();
+    --mSize;
+
+    //If the group still has an empty slot then no probe ever continued past
+    //this group, so the slot can go straight back to being empty
+    size_type groupStart = index & ~(cFlatHashGroupWidth - 1);
+    if(FlatHashMatchGroup(mControl + groupStart, cFlatHashEmpty) != 0)
+    {
+      mControl[index] = cFlatHashEmpty;
+    }
+    else
+    {
+      mControl[index] = cFlatHashDeleted;
+      ++mDeleted;
+    }
+  }
+
+  //////////Information Functions///////////
+  size_type BucketCount() const { return mTableSize; }
+  size_type Size() const { return mSize; }
+  bool Empty()const { return mSize == 0; }
+
+  //////////Load Factor///////////////////////
+  float MaxLoadFactor()const { return mMaxLoadFactor; }
+  float LoadFactor() const { return float(mSize) / float(mTableSize); }
+  void SetMaxLoadFactor(float newMax)
+  {
+    //There must always be at least one empty slot so probing terminates
+    ErrorIf(newMax <= 0.0f || newMax > 0.875f, "Max load factor must be in (0, 0.875]");
+    if(newMax > 0.875f)
+      newMax = 0.875f;
+    mMaxLoadFactor = newMax;
+    if(mTableSize != 0 && float(mSize + mDeleted) > float(mTableSize) * mMaxLoadFactor)
+      Rehash(mTableSize * 2);
+  }
+
+  ///Equals///////////
+
+  bool operator==(const this_type& other)
+  {
+    if(other.Size() != this->Size())
+      return false;
+
+    range r = this->All();
+    while(!r.Empty())
+    {
+      Node* node = other.InternalFindAs(r.Front(), mHasher);
+      if(node == (Node*)cHashOpenNode)
+        return false;
+
+      if(r.Front() != node->Value)
+        return false;
+
+      r.PopFront();
+    }
+
+    return true;
+  }
+
+protected:
+  Node* mTable;
+  byte* mControl;
+  size_type mTableSize;
+  size_type mSize;
+  //Deleted slots (tombstones) that have not been reused yet
+  size_type mDeleted;
+  float mMaxLoadFactor;
+  Hasher mHasher;
+  typedef Node node_type;
+
+  //The hashers in Hashing.hpp only produce 32 bits and some types hash to small
+  //sequential ids, so the bits are mixed before they're split into the group
+  //index and the 7 bits stored in the control byte (finalizer from MurmurHash3)
+  static size_t MixHash(size_t hash)
+  {
+    u32 mixed = (u32)hash;
+    mixed ^= mixed >> 16;
+    mixed *= 0x85ebca6b;
+    mixed ^= mixed >> 13;
+    mixed *= 0xc2b2ae35;
+    mixed ^= mixed >> 16;
+    return mixed;
+  }
+
+  static byte GetControlHash(size_t hash)
+  {
+    return (byte)(hash & 0x7F);
+  }
+
+  static size_t GetAllocationSize(size_type tableSize)
+  {
+    return tableSize * sizeof(Node) + tableSize;
+  }
+
+  void AllocateTable(size_type tableSize)
+  {
+    mTable = (Node*)mAllocator.Allocate(GetAllocationSize(tableSize));
+    mControl = (byte*)(mTable + tableSize);
+    memset(mControl, cFlatHashEmpty, tableSize);
+    mTableSize = tableSize;
+    mDeleted = 0;
+  }
+
+  //Finds the node holding a value with the given (mixed) hash.
+  //Groups are visited in triangular number order, which visits every
+  //group exactly once when the group count is a power of two.
+  template<typename searchType, typename searchHasherType>
+  Node* FindHashed(const searchType& searchValue, size_t hash,
+                   searchHasherType& searchHasher) const
+  {
+    if(mTableSize == 0)
+      return (Node*)cHashOpenNode;
+
+    byte controlHash = GetControlHash(hash);
+    size_type groupMask = mTableSize / cFlatHashGroupWidth - 1;
+    size_type group = (hash >> 7) & groupMask;
+
+    for(size_type probe = 1; probe <= groupMask + 1; ++probe)
+    {
+      size_type groupStart = group * cFlatHashGroupWidth;
+      const byte* control = mControl + groupStart;
+
+      u32 matches = FlatHashMatchGroup(control, controlHash);
+      while(matches != 0)
+      {
+        Node* node = mTable + groupStart + CountTrailingZeros(matches);
+        if(searchHasher.Equal(searchValue, node->Value))
+          return node;
+
+        //Clear the lowest set bit
+        matches &= matches - 1;
+      }
+
+      //An empty slot means the value was never pushed past this group
+      if(FlatHashMatchGroup(control, cFlatHashEmpty) != 0)
+        break;
+
+      group = (group + probe) & groupMask;
+    }
+
+    return (Node*)cHashOpenNode;
+  }
+
+  //Finds the first empty or deleted slot along the probe sequence for a hash.
+  Node* FindOpenSlot(size_t hash)
+  {
+    size_type groupMask = mTableSize / cFlatHashGroupWidth - 1;
+    size_type group = (hash >> 7) & groupMask;
+
+    for(size_type probe = 1; probe <= groupMask + 1; ++probe)
+    {
+      size_type groupStart = group * cFlatHashGroupWidth;
+      u32 open = FlatHashMatchOpen(mControl + groupStart);
+      if(open != 0)
+        return mTable + groupStart + CountTrailingZeros(open);
+
+      group = (group + probe) & groupMask;
+    }
+
+    Error("No free slots. Hash map is not working correctly.");
+    return (Node*)cHashOpenNode;
+  }
+
+  void FillOpenNode(Node* node, size_t hash, const_reference value)
+  {
+    new(&node->Value) value_type(value);
+    mControl[node - mTable] = GetControlHash(hash);
+    ++mSize;
+  }
+
+  void DestructTableValues()
+  {
+    for(size_type i = 0; i < mTableSize; ++i)
+    {
+      //call the destructor on all the value types
+      if((mControl[i] & 0x80) == 0)
+        mTable[i].Value.~ValueType();
+
+      mControl[i] = cFlatHashEmpty;
+    }
+  }
+};
+
+//Table policy for HashMap and HashSet that stores values in a FlatHashedContainer.
+struct ZeroShared FlatHashTable
+{
+  template<typename ValueType, typename Hasher, typename Allocator>
+  struct Table
+  {
+    typedef FlatHashedContainer<ValueType, Hasher, Allocator> type;
+  };
+};
+
+}// namespace Zero
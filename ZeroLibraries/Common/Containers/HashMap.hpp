@@ -49,24 +49,26 @@ struct ZeroSharedTemplate PairHashAdapter
 ///Hash Map is an Associative Hashed Container. 
 //Stores values by hashing keys providing constant insertion, removal, and 
 //searching. Iteration is not in done is sort order.
+//The TablePolicy picks how the table is stored (ChainedHashTable or FlatHashTable).
 template< typename KeyType, typename DataType, 
           typename Hasher = HashPolicy<KeyType>, 
-          typename Allocator = DefaultAllocator >
-class ZeroSharedTemplate HashMap :  public HashedContainer< Pair<KeyType, DataType>, 
-                                                            PairHashAdapter< Hasher, KeyType, DataType >, 
-                                                            Allocator >
+          typename Allocator = DefaultAllocator,
+          typename TablePolicy = ChainedHashTable >
+class ZeroSharedTemplate HashMap :  public TablePolicy::template Table< Pair<KeyType, DataType>, 
+                                                                       PairHashAdapter< Hasher, KeyType, DataType >, 
+                                                                       Allocator >::type
 {
 public:
   typedef KeyType key_type;
   typedef DataType data_type;
-  typedef HashMap<KeyType, DataType> this_type;
+  typedef HashMap<KeyType, DataType, Hasher, Allocator, TablePolicy> this_type;
   typedef Pair<KeyType, DataType> value_type;
   typedef Pair<KeyType, DataType> pair;
   typedef size_t size_type;
   typedef data_type& reference;
-  typedef HashedContainer< value_type, 
-                           PairHashAdapter<Hasher, KeyType, DataType>, 
-                           Allocator > base_type;
+  typedef typename TablePolicy::template Table< value_type, 
+                                                PairHashAdapter<Hasher, KeyType, DataType>, 
+                                                Allocator >::type base_type;
   typedef typename base_type::Node* iterator;
   typedef typename base_type::Node Node;
   typedef typename base_type::range range;
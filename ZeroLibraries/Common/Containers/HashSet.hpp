@@ -37,22 +37,24 @@ struct SetHashAdapter
 };
 
 ///Hash Set is an Associative Hashed Container. 
+///The TablePolicy picks how the table is stored (ChainedHashTable or FlatHashTable).
 template< typename ValueType, 
           typename Hasher = HashPolicy<ValueType>, 
-          typename Allocator = DefaultAllocator >
-class ZeroSharedTemplate HashSet : public HashedContainer< ValueType, 
-                                                           SetHashAdapter< Hasher, ValueType >, 
-                                                           Allocator >
+          typename Allocator = DefaultAllocator,
+          typename TablePolicy = ChainedHashTable >
+class ZeroSharedTemplate HashSet : public TablePolicy::template Table< ValueType, 
+                                                                      SetHashAdapter< Hasher, ValueType >, 
+                                                                      Allocator >::type
 {
 public:
   typedef ValueType value_type;
   typedef size_t size_type;
   typedef value_type& reference;
   typedef const value_type& const_reference;
-  typedef HashSet<ValueType, Hasher, Allocator> this_type;
-  typedef HashedContainer< ValueType, 
-                           SetHashAdapter< Hasher, ValueType >,
-                           Allocator > base_type;
+  typedef HashSet<ValueType, Hasher, Allocator, TablePolicy> this_type;
+  typedef typename TablePolicy::template Table< ValueType, 
+                                                SetHashAdapter< Hasher, ValueType >,
+                                                Allocator >::type base_type;
   typedef typename base_type::Node* iterator;
   typedef typename base_type::Node Node;
   typedef typename base_type::range range;
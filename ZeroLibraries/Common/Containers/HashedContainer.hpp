@@ -586,4 +586,16 @@ protected:
   }
 
 };
+
+//Table policy for HashMap and HashSet that stores values in a HashedContainer.
+//This is the default (see FlatHashTable for the open addressed alternative).
+struct ZeroShared ChainedHashTable
+{
+  template<typename ValueType, typename Hasher, typename Allocator>
+  struct Table
+  {
+    typedef HashedContainer<ValueType, Hasher, Allocator> type;
+  };
+};
+
 }// namespace Zero
@@ -0,0 +1,283 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file RadixSort.hpp
+/// Stable least significant digit radix sort on 64 bit keys.
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "Array.hpp"
+
+namespace Zero
+{
+
+// Keys are sorted one byte at a time, lowest byte first
+const uint cRadixDigitBits = 8;
+const uint cRadixBucketCount = 1 << cRadixDigitBits;
+const uint cRadixDigitMask = cRadixBucketCount - 1;
+const uint cRadixPassCount = 64 / cRadixDigitBits;
+
+// How many values fall in each bucket for one digit
+struct RadixHistogram
+{
+  size_t mCounts[cRadixBucketCount];
+};
+
+inline uint RadixDigit(u64 key, uint pass)
+{
+  return (uint)(key >> (pass * cRadixDigitBits)) & cRadixDigitMask;
+}
+
+// Counts every digit of every key in one read of the data
+template<typename type, typename KeyGetter>
+void RadixCountAllDigits(const type* data, size_t count, KeyGetter getKey,
+                         RadixHistogram histograms[cRadixPassCount])
+{
+  memset(histograms, 0, sizeof(RadixHistogram) * cRadixPassCount);
+  for(size_t i = 0; i < count; ++i)
+  {
+    u64 key = getKey(data[i]);
+    for(uint pass = 0; pass < cRadixPassCount; ++pass)
+      ++histograms[pass].mCounts[RadixDigit(key, pass)];
+  }
+}
+
+// Counts one digit of every key
+template<typename type, typename KeyGetter>
+void RadixCountDigit(const type* data, size_t count, KeyGetter getKey, uint pass,
+                     RadixHistogram& histogram)
+{
+  memset(&histogram, 0, sizeof(RadixHistogram));
+  for(size_t i = 0; i < count; ++i)
+    ++histogram.mCounts[RadixDigit(getKey(data[i]), pass)];
+}
+
+// A pass can be skipped when every key has the same digit
+// (with packed keys most of the high bytes are usually the same)
+inline bool RadixPassIsTrivial(const RadixHistogram& histogram, size_t count)
+{
+  for(uint bucket = 0; bucket < cRadixBucketCount; ++bucket)
+  {
+    if(histogram.mCounts[bucket] != 0)
+      return histogram.mCounts[bucket] == count;
+  }
+  return true;
+}
+
+// Turns the counts into the index that each bucket starts at
+inline void RadixExclusivePrefixSum(RadixHistogram& histogram)
+{
+  size_t offset = 0;
+  for(uint bucket = 0; bucket < cRadixBucketCount; ++bucket)
+  {
+    size_t bucketCount = histogram.mCounts[bucket];
+    histogram.mCounts[bucket] = offset;
+    offset += bucketCount;
+  }
+}
+
+// Moves every value to the next index of its digit's bucket, values in the
+// same bucket keep their order so the sort is stable
+template<typename type, typename KeyGetter>
+void RadixScatterDigit(const type* source, size_t count, type* dest, KeyGetter getKey, uint pass,
+                       RadixHistogram& offsets)
+{
+  for(size_t i = 0; i < count; ++i)
+  {
+    uint digit = RadixDigit(getKey(source[i]), pass);
+    dest[offsets.mCounts[digit]++] = source[i];
+  }
+}
+
+// Stable sort of the values by the u64 that getKey returns for each one.
+// Scratch must hold at least count values. The values are moved
+// by assignment, so this is meant for small plain data like sort entries.
+template<typename type, typename KeyGetter>
+void RadixSort(type* data, size_t count, type* scratch, KeyGetter getKey)
+{
+  if(count < 2)
+    return;
+
+  RadixHistogram histograms[cRadixPassCount];
+  RadixCountAllDigits(data, count, getKey, histograms);
+
+  type* source = data;
+  type* dest = scratch;
+  for(uint pass = 0; pass < cRadixPassCount; ++pass)
+  {
+    if(RadixPassIsTrivial(histograms[pass], count))
+      continue;
+
+    RadixExclusivePrefixSum(histograms[pass]);
+    RadixScatterDigit(source, count, dest, getKey, pass, histograms[pass]);
+    Swap(source, dest);
+  }
+
+  // An odd number of passes leaves the result in the scratch
+  if(source != data)
+  {
+    for(size_t i = 0; i < count; ++i)
+      data[i] = source[i];
+  }
+}
+
+template<typename type, typename KeyGetter>
+void RadixSort(Array<type>& values, Array<type>& scratch, KeyGetter getKey)
+{
+  scratch.Resize(values.Size());
+  RadixSort(values.Data(), values.Size(), scratch.Data(), getKey);
+}
+
+//--------------------------------------------------------------- Block Radix Sort
+// RadixSortBlocks counts and scatters the values this many at a time
+const uint cRadixSortBlockSize = 4096;
+
+// Counts the digits of one pass (or every pass) for a range of blocks
+template<typename type, typename KeyGetter>
+struct RadixBlockCountTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      size_t start = (size_t)block * cRadixSortBlockSize;
+      size_t count = mCount - start < cRadixSortBlockSize ? mCount - start : cRadixSortBlockSize;
+      RadixHistogram* blockCounts = &(*mBlockCounts)[block * cRadixPassCount];
+      if(mAllDigits)
+        RadixCountAllDigits(mSource + start, count, mGetKey, blockCounts);
+      else
+        RadixCountDigit(mSource + start, count, mGetKey, mPass, blockCounts[mPass]);
+    }
+  }
+
+  const type* mSource;
+  size_t mCount;
+  uint mPass;
+  bool mAllDigits;
+  KeyGetter mGetKey;
+  Array<RadixHistogram>* mBlockCounts;
+};
+
+// Moves the values of a range of blocks to their place for one pass
+template<typename type, typename KeyGetter>
+struct RadixBlockScatterTask
+{
+  void operator()(uint blockStart, uint blockEnd)
+  {
+    for(uint block = blockStart; block < blockEnd; ++block)
+    {
+      size_t start = (size_t)block * cRadixSortBlockSize;
+      size_t count = mCount - start < cRadixSortBlockSize ? mCount - start : cRadixSortBlockSize;
+      RadixHistogram& offsets = (*mBlockCounts)[block * cRadixPassCount + mPass];
+      RadixScatterDigit(mSource + start, count, mDest, mGetKey, mPass, offsets);
+    }
+  }
+
+  const type* mSource;
+  type* mDest;
+  size_t mCount;
+  uint mPass;
+  KeyGetter mGetKey;
+  Array<RadixHistogram>* mBlockCounts;
+};
+
+// Runs every block of RadixSortBlocks on the calling thread
+struct RadixSerialFor
+{
+  template<typename RangeFunctor>
+  void operator()(uint begin, uint end, RangeFunctor& functor)
+  {
+    functor(begin, end);
+  }
+};
+
+// The same stable sort as RadixSort, but every pass is counted and scattered in blocks
+// that don't touch each other, so the blocks can be spread across threads.
+// parallelFor(begin, end, functor) must call functor(start, end) over sub ranges that
+// cover the blocks [begin, end) and only return once they're all done.
+// blockCounts holds the counts of every block and is kept by the caller so it can be reused.
+template<typename type, typename KeyGetter, typename ParallelFor>
+void RadixSortBlocks(type* data, size_t count, type* scratch, Array<RadixHistogram>& blockCounts,
+                     KeyGetter getKey, ParallelFor& parallelFor)
+{
+  if(count < 2)
+    return;
+
+  uint blockCount = (uint)((count + cRadixSortBlockSize - 1) / cRadixSortBlockSize);
+  blockCounts.Resize(blockCount * cRadixPassCount);
+
+  // Every digit is counted up front to find the passes that can be skipped,
+  // these counts are still valid for the blocks of the first pass that is not skipped
+  RadixBlockCountTask<type, KeyGetter> countTask;
+  countTask.mSource = data;
+  countTask.mCount = count;
+  countTask.mPass = 0;
+  countTask.mAllDigits = true;
+  countTask.mGetKey = getKey;
+  countTask.mBlockCounts = &blockCounts;
+  parallelFor(0, blockCount, countTask);
+
+  type* source = data;
+  type* dest = scratch;
+  bool countsValid = true;
+
+  for(uint pass = 0; pass < cRadixPassCount; ++pass)
+  {
+    // Only the first non skipped pass can use the counts of the original order
+    if(countsValid == false)
+    {
+      countTask.mSource = source;
+      countTask.mPass = pass;
+      countTask.mAllDigits = false;
+      parallelFor(0, blockCount, countTask);
+    }
+
+    RadixHistogram totals;
+    memset(&totals, 0, sizeof(totals));
+    for(uint block = 0; block < blockCount; ++block)
+    {
+      RadixHistogram& counts = blockCounts[block * cRadixPassCount + pass];
+      for(uint bucket = 0; bucket < cRadixBucketCount; ++bucket)
+        totals.mCounts[bucket] += counts.mCounts[bucket];
+    }
+
+    if(RadixPassIsTrivial(totals, count))
+      continue;
+
+    // Each block starts after the same bucket of every block before it,
+    // which keeps equal digits in their original order
+    size_t offset = 0;
+    for(uint bucket = 0; bucket < cRadixBucketCount; ++bucket)
+    {
+      for(uint block = 0; block < blockCount; ++block)
+      {
+        size_t& blockOffset = blockCounts[block * cRadixPassCount + pass].mCounts[bucket];
+        size_t bucketCount = blockOffset;
+        blockOffset = offset;
+        offset += bucketCount;
+      }
+    }
+
+    RadixBlockScatterTask<type, KeyGetter> scatterTask;
+    scatterTask.mSource = source;
+    scatterTask.mDest = dest;
+    scatterTask.mCount = count;
+    scatterTask.mPass = pass;
+    scatterTask.mGetKey = getKey;
+    scatterTask.mBlockCounts = &blockCounts;
+    parallelFor(0, blockCount, scatterTask);
+
+    Swap(source, dest);
+    countsValid = false;
+  }
+
+  // An odd number of passes leaves the result in the scratch
+  if(source != data)
+  {
+    for(size_t i = 0; i < count; ++i)
+      data[i] = source[i];
+  }
+}
+
+}//namespace Zero
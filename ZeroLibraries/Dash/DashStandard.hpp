@@ -84,5 +84,7 @@ namespace Zero
 #include "ReplicaChannel.hpp"
 #include "Replica.hpp"
 #include "ReplicaStream.hpp"
+#include "ReplicaInterest.hpp"
+#include "ReplicaBaseline.hpp"
 #include "ReplicatorLink.hpp"
 #include "Replicator.hpp"
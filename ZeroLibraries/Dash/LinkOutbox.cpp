@@ -423,7 +423,7 @@ MessageReceiptId LinkOutbox::PushMessage(Status& status, MoveReference<Message>
   }
 
   // Message data too large?
-  if(message->GetData().GetBitsWritten() > MaxMessageWholeDataBits)
+  if(message->GetDataStream().GetBitsWritten() > MaxMessageWholeDataBits)
   {
     // Failure
     status.SetFailed("Message data is too large");
@@ -469,7 +469,7 @@ MessageReceiptId LinkOutbox::PushMessage(Status& status, MoveReference<Message>
   }
 
   // Reset message data read cursor (just in case it was touched)
-  message->GetData().ClearBitsRead();
+  message->GetDataStream().ClearBitsRead();
 
   // Push new outgoing message to be sent later
   mOutMessages.Insert(OutMessagePtr(new OutMessage(ZeroMove(message), reliable, channelId, sequenceId, transferMode, receiptId, priority, lifetime, mLink->GetLocalTime())));
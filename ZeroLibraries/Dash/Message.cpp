@@ -9,6 +9,27 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                              SharedMessageData                                  //
+//---------------------------------------------------------------------------------//
+
+SharedMessageData::SharedMessageData(MoveReference<BitStream> data)
+  : mData(ZeroMove(data)),
+    mReferenceCount(1)
+{
+}
+
+void SharedMessageData::AddReference()
+{
+  AtomicPreIncrement(&mReferenceCount);
+}
+void SharedMessageData::Release()
+{
+  // No longer referenced?
+  if(AtomicPreDecrement(&mReferenceCount) == 0)
+    delete this;
+}
+
 //---------------------------------------------------------------------------------//
 //                                   Message                                       //
 //---------------------------------------------------------------------------------//
@@ -16,6 +37,7 @@ namespace Zero
 Message::Message()
   : mType(0),
     mData(),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -28,6 +50,7 @@ Message::Message()
 Message::Message(MessageType type, const BitStream& data)
   : mType(type),
     mData(data),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -39,6 +62,7 @@ Message::Message(MessageType type, const BitStream& data)
 Message::Message(MessageType type, MoveReference<BitStream> data)
   : mType(type),
     mData(ZeroMove(data)),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -51,6 +75,7 @@ Message::Message(MessageType type, MoveReference<BitStream> data)
 Message::Message(MessageType type)
   : mType(type),
     mData(),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -63,6 +88,7 @@ Message::Message(MessageType type)
 Message::Message(const BitStream& data)
   : mType(0),
     mData(data),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -74,6 +100,7 @@ Message::Message(const BitStream& data)
 Message::Message(MoveReference<BitStream> data)
   : mType(0),
     mData(ZeroMove(data)),
+    mSharedData(nullptr),
     mChannelId(0),
     mSequenceId(0),
     mTimestamp(cInvalidMessageTimestamp),
@@ -86,6 +113,7 @@ Message::Message(MoveReference<BitStream> data)
 Message::Message(const Message& rhs, bool doNotCopyData)
   : mType(rhs.mType),
     mData(),
+    mSharedData(nullptr),
     mChannelId(rhs.mChannelId),
     mSequenceId(rhs.mSequenceId),
     mTimestamp(rhs.mTimestamp),
@@ -98,6 +126,7 @@ Message::Message(const Message& rhs, bool doNotCopyData)
 Message::Message(const Message& rhs)
   : mType(rhs.mType),
     mData(rhs.mData),
+    mSharedData(rhs.mSharedData),
     mChannelId(rhs.mChannelId),
     mSequenceId(rhs.mSequenceId),
     mTimestamp(rhs.mTimestamp),
@@ -105,11 +134,15 @@ Message::Message(const Message& rhs)
     mFragmentIndex(rhs.mFragmentIndex),
     mIsFinalFragment(rhs.mIsFinalFragment)
 {
+  // Reference shared data (if any)
+  if(mSharedData)
+    mSharedData->AddReference();
 }
 
 Message::Message(MoveReference<Message> rhs)
   : mType(rhs->mType),
     mData(ZeroMove(rhs->mData)),
+    mSharedData(rhs->mSharedData),
     mChannelId(rhs->mChannelId),
     mSequenceId(rhs->mSequenceId),
     mTimestamp(rhs->mTimestamp),
@@ -117,12 +150,28 @@ Message::Message(MoveReference<Message> rhs)
     mFragmentIndex(rhs->mFragmentIndex),
     mIsFinalFragment(rhs->mIsFinalFragment)
 {
+  rhs->mSharedData = nullptr;
+}
+
+Message::~Message()
+{
+  // Release shared data (if any)
+  if(mSharedData)
+    mSharedData->Release();
 }
 
 Message& Message::operator =(const Message& rhs)
 {
+  // Reference shared data (if any)
+  // (Referenced before released in case of self assignment)
+  if(rhs.mSharedData)
+    rhs.mSharedData->AddReference();
+  if(mSharedData)
+    mSharedData->Release();
+
   mType            = rhs.mType;
   mData            = rhs.mData;
+  mSharedData      = rhs.mSharedData;
   mChannelId       = rhs.mChannelId;
   mSequenceId      = rhs.mSequenceId;
   mTimestamp       = rhs.mTimestamp;
@@ -134,8 +183,18 @@ Message& Message::operator =(const Message& rhs)
 }
 Message& Message::operator =(MoveReference<Message> rhs)
 {
+  // Self assignment?
+  if(this == &*rhs)
+    return *this;
+
+  // Release shared data (if any)
+  if(mSharedData)
+    mSharedData->Release();
+
   mType            = rhs->mType;
   mData            = ZeroMove(rhs->mData);
+  mSharedData      = rhs->mSharedData;
+  rhs->mSharedData = nullptr;
   mChannelId       = rhs->mChannelId;
   mSequenceId      = rhs->mSequenceId;
   mTimestamp       = rhs->mTimestamp;
@@ -186,26 +245,45 @@ MessageType Message::GetType() const
 
 bool Message::HasData() const
 {
-  return !mData.IsEmpty();
+  return !GetDataStream().IsEmpty();
 }
 
 void Message::SetData(const BitStream& data)
 {
+  UnshareData();
   mData = data;
 }
 void Message::SetData(MoveReference<BitStream> data)
 {
+  UnshareData();
   mData = ZeroMove(data);
 }
 const BitStream& Message::GetData() const
 {
+  UnshareData();
   return mData;
 }
 BitStream& Message::GetData()
 {
+  UnshareData();
   return mData;
 }
 
+void Message::ShareData()
+{
+  // Already shared?
+  if(mSharedData)
+    return;
+
+  // Move data into shared data
+  mData.ClearBitsRead();
+  mSharedData = new SharedMessageData(ZeroMove(mData));
+}
+bool Message::IsDataShared() const
+{
+  return mSharedData != nullptr;
+}
+
 bool Message::HasTimestamp() const
 {
   return mTimestamp != cInvalidMessageTimestamp;
@@ -262,7 +340,7 @@ Bits Message::GetHeaderBits(bool asFragment) const
 
 Bits Message::GetTotalBits() const
 {
-  return GetHeaderBits() + mData.GetBitsUnread();
+  return GetHeaderBits() + GetDataStream().GetBitsUnread();
 }
 
 //
@@ -287,6 +365,22 @@ bool Message::IsFinalFragment() const
   return mIsFinalFragment;
 }
 
+const BitStream& Message::GetDataStream() const
+{
+  return mSharedData ? mSharedData->mData : mData;
+}
+void Message::UnshareData() const
+{
+  // Not shared?
+  if(!mSharedData)
+    return;
+
+  // Copy shared data back into the message
+  mData = mSharedData->mData;
+  mSharedData->Release();
+  mSharedData = nullptr;
+}
+
 Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message& message)
 {
   // Write operation?
@@ -309,8 +403,11 @@ Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message
     // Write message sequence ID
     Bits bits2 = bitStream.Write(message.mSequenceId);
 
+    // Get message data (shared message data is written as is, without copying it into the message)
+    const BitStream& data = message.GetDataStream();
+
     // Write message data size
-    Bits bits3 = bitStream.WriteQuantized(message.mData.GetBitsWritten(), MinMessageDataBits, MaxMessageDataBits);
+    Bits bits3 = bitStream.WriteQuantized(data.GetBitsWritten(), MinMessageDataBits, MaxMessageDataBits);
 
     // Write 'Has timestamp?' flag
     bool hasTimestamp = message.HasTimestamp();
@@ -359,8 +456,8 @@ Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message
       //
       // Write Message Data
       //
-      bitsAppended = bitStream.AppendAll(message.mData);
-      Assert(bitsAppended == message.mData.GetBitsWritten());
+      bitsAppended = bitStream.AppendAll(data);
+      Assert(bitsAppended == data.GetBitsWritten());
     }
 
 #if ZeroDebug
@@ -573,6 +670,9 @@ TimeMs OutMessage::GetLifetime() const
 
 OutMessage OutMessage::TakeFragment(Bits dataSize)
 {
+  // (Fragments are read out of the message data using its read cursor, so it can't be shared)
+  UnshareData();
+
   // Not already a fragment?
   if(!mIsFragment)
   {
@@ -9,6 +9,29 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                              SharedMessageData                                  //
+//---------------------------------------------------------------------------------//
+
+/// Reference counted message data stream
+/// Written once and referenced by every copy of a message, instead of copied into each one
+/// (Never modified once shared)
+class SharedMessageData
+{
+public:
+  /// Constructor (starts with a single reference)
+  explicit SharedMessageData(MoveReference<BitStream> data);
+
+  /// Adds a reference
+  void AddReference();
+  /// Removes a reference, deleting the shared message data once unreferenced
+  void Release();
+
+  /// Data
+  BitStream    mData;           /// Shared message data stream
+  volatile s32 mReferenceCount; /// Number of messages referencing this
+};
+
 //---------------------------------------------------------------------------------//
 //                                   Message                                       //
 //---------------------------------------------------------------------------------//
@@ -38,6 +61,9 @@ public:
   /// Move Constructor
   Message(MoveReference<Message> rhs);
 
+  /// Destructor
+  ~Message();
+
   /// Copy Assignment Operator
   Message& operator =(const Message& rhs);
   /// Move Assignment Operator
@@ -63,11 +89,20 @@ public:
   bool HasData() const;
 
   /// Message data stream
+  /// (Shared message data is copied back into the message the first time it is accessed here)
   void SetData(const BitStream& data);
   void SetData(MoveReference<BitStream> data);
   const BitStream& GetData() const;
   BitStream& GetData();
 
+  /// Moves the message data stream into reference counted shared message data
+  /// Copies of this message then reference the same data instead of copying it,
+  /// which makes sending one message on many links cost a single serialization
+  /// (Call after the message data has been completely written)
+  void ShareData();
+  /// Returns true if the message data stream is shared, else false
+  bool IsDataShared() const;
+
   /// Returns true if the message has a valid timestamp, else false
   bool HasTimestamp() const;
 
@@ -104,10 +139,18 @@ protected:
   /// Returns true if the message is the final fragment, else false
   bool IsFinalFragment() const;
 
+  /// Returns the message data stream without copying shared message data
+  /// (Shared message data must not be modified, only written to packets)
+  const BitStream& GetDataStream() const;
+  /// Copies shared message data (if any) back into the message
+  void UnshareData() const;
+
   /// Message type ID
   MessageType          mType;
-  /// Message data stream
-  BitStream            mData;
+  /// Message data stream (mutable to copy shared message data back on access)
+  mutable BitStream    mData;
+  /// Shared message data stream (if shared)
+  mutable SharedMessageData* mSharedData;
   /// Message channel ID
   MessageChannelId     mChannelId;
   /// Message channel sequence ID
@@ -52,6 +52,79 @@ RawPacket& RawPacket::operator =(MoveReference<RawPacket> rhs)
   return *this;
 }
 
+//---------------------------------------------------------------------------------//
+//                                RawPacketRing                                    //
+//---------------------------------------------------------------------------------//
+
+RawPacketRing::RawPacketRing()
+  : mSlots(),
+    mSlotMask(0),
+    mWriteIndex(0),
+    mReadIndex(0)
+{
+}
+
+void RawPacketRing::Initialize(uint slotCount, Bytes slotCapacity)
+{
+  Uninitialize();
+
+  // Allocate slots up front
+  // (Power of two capacity lets indices wrap freely)
+  uint capacity = 1;
+  while(capacity < slotCount)
+    capacity <<= 1;
+  mSlots.Resize(capacity);
+  forRange(RawPacket& slot, mSlots.All())
+    slot.mData.Reserve(slotCapacity);
+  mSlotMask = capacity - 1;
+}
+void RawPacketRing::Uninitialize()
+{
+  mSlots.Clear();
+  mSlotMask   = 0;
+  mWriteIndex = 0;
+  mReadIndex  = 0;
+}
+
+uint RawPacketRing::GetCapacity() const
+{
+  return mSlots.Size();
+}
+
+uint RawPacketRing::GetWritableCount() const
+{
+  return GetCapacity() - (mWriteIndex.Load() - mReadIndex.Load());
+}
+RawPacket& RawPacketRing::GetWritable(uint offset)
+{
+  Assert(offset < GetWritableCount());
+  return mSlots[(mWriteIndex.Load() + offset) & mSlotMask];
+}
+void RawPacketRing::Push(uint count)
+{
+  Assert(count <= GetWritableCount());
+
+  // (Slot writes happen before the index is published)
+  mWriteIndex.Store(mWriteIndex.Load() + count);
+}
+
+uint RawPacketRing::GetReadableCount() const
+{
+  return mWriteIndex.Load() - mReadIndex.Load();
+}
+RawPacket& RawPacketRing::GetReadable(uint offset)
+{
+  Assert(offset < GetReadableCount());
+  return mSlots[(mReadIndex.Load() + offset) & mSlotMask];
+}
+void RawPacketRing::Pop(uint count)
+{
+  Assert(count <= GetReadableCount());
+
+  // (Slot reads happen before the index is published)
+  mReadIndex.Store(mReadIndex.Load() + count);
+}
+
 //---------------------------------------------------------------------------------//
 //                                    Packet                                       //
 //---------------------------------------------------------------------------------//
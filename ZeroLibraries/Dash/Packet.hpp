@@ -50,6 +50,59 @@ struct MoveWithoutDestructionOperator<RawPacket>
   }
 };
 
+//---------------------------------------------------------------------------------//
+//                                RawPacketRing                                    //
+//---------------------------------------------------------------------------------//
+
+/// Fixed capacity ring of reusable raw packets
+/// Passes raw packets from a single producer thread to a single consumer thread without locking
+/// Slots are allocated once on initialization, so data is received directly into them and never copied
+class RawPacketRing
+{
+public:
+  /// Constructor
+  RawPacketRing();
+
+  /// Allocates the specified number of slots (rounded up to a power of two), each reserving the specified capacity
+  /// (Neither thread may be using the ring)
+  void Initialize(uint slotCount, Bytes slotCapacity);
+  /// Frees all slots
+  /// (Neither thread may be using the ring)
+  void Uninitialize();
+
+  /// Returns the total number of slots
+  uint GetCapacity() const;
+
+  //
+  // Producer Thread
+  //
+
+  /// Returns the number of slots available to be written
+  uint GetWritableCount() const;
+  /// Returns the writable slot at the specified offset from the first writable slot
+  RawPacket& GetWritable(uint offset);
+  /// Publishes the specified number of written slots to the consumer
+  void Push(uint count);
+
+  //
+  // Consumer Thread
+  //
+
+  /// Returns the number of slots available to be read
+  uint GetReadableCount() const;
+  /// Returns the readable slot at the specified offset from the first readable slot
+  RawPacket& GetReadable(uint offset);
+  /// Returns the specified number of read slots to the producer
+  void Pop(uint count);
+
+private:
+  /// Data
+  Array<RawPacket> mSlots;      /// Reusable raw packet slots
+  uint             mSlotMask;   /// Slot index mask (capacity - 1)
+  Atomic<uint>     mWriteIndex; /// Total slots pushed (written by the producer)
+  Atomic<uint>     mReadIndex;  /// Total slots popped (written by the consumer)
+};
+
 //---------------------------------------------------------------------------------//
 //                                    Packet                                       //
 //---------------------------------------------------------------------------------//
@@ -260,4 +313,9 @@ static const Bytes TypicalPacketDataBytes = BITS_TO_BYTES(TypicalPacketDataBits)
 static const Bits  MinPacketDataBits      = MinPacketBits     - MaxPacketHeaderBits;
 static const Bytes MinPacketDataBytes     = BITS_TO_BYTES(MinPacketDataBits);
 
+/// Maximum number of packets received or sent with a single batched socket call
+static const uint PacketBatchCount   = 64;
+/// Number of raw incoming packets buffered per socket until processed by the user thread
+static const uint RawPacketRingSlots = 512;
+
 } // namespace Zero
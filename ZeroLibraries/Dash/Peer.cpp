@@ -25,9 +25,11 @@ void Peer::ResetSession()
   mFatalError = false;
 
   /// Packet Data
-  mIpv4RawPackets.Clear();
-  mIpv6RawPackets.Clear();
-  mSendBitStream.Clear(false);
+  mIpv4RawPackets.Uninitialize();
+  mIpv6RawPackets.Uninitialize();
+  mSendPackets.Clear();
+  mSendPacketCount = 0;
+  mSendDatagrams.Clear();
 
   InitializeStats();
 }
@@ -62,10 +64,10 @@ Peer::Peer(ProcessReceivedCustomPacketFn processReceivedCustomPacketFn, ProcessR
 
     /// Packet Data
     mIpv4RawPackets(),
-    mIpv4RawPacketsLock(),
     mIpv6RawPackets(),
-    mIpv6RawPacketsLock(),
-    mSendBitStream(),
+    mSendPackets(),
+    mSendPacketCount(0),
+    mSendDatagrams(),
     mReceiveStatsLock(),
     mReleasedCustomPackets(),
     mReleasedCustomPacketsLock(),
@@ -269,6 +271,18 @@ void Peer::Open(Status& status, ushort port, InternetProtocol::Enum internetProt
     return;
   }
 
+  //
+  // Allocate Packet Buffers
+  //
+
+  // Allocate outgoing packet batch
+  // (Allocated once so sending never allocates)
+  mSendPackets.Resize(PacketBatchCount);
+  forRange(RawPacket& sendPacket, mSendPackets.All())
+    sendPacket.mData.Reserve(EthernetMtuBytes);
+  mSendPacketCount = 0;
+  mSendDatagrams.Reserve(PacketBatchCount);
+
   //
   // Launch Threads
   //
@@ -276,6 +290,9 @@ void Peer::Open(Status& status, ushort port, InternetProtocol::Enum internetProt
   // Using IPv4 socket?
   if(mIpv4Socket.IsOpen())
   {
+    // Allocate raw IPv4 packet ring
+    mIpv4RawPackets.Initialize(RawPacketRingSlots, EthernetMtuBytes);
+
     // Launch IPv4 receive thread
     mExitIpv4ReceiveThread = false;
     bool result = mIpv4ReceiveThread.Initialize(Thread::ObjectEntryCreator<Peer, &Peer::Ipv4ReceiveThreadFn>, this, "PeerIpv4ReceiveThread");
@@ -291,6 +308,9 @@ void Peer::Open(Status& status, ushort port, InternetProtocol::Enum internetProt
   // Using IPv6 socket?
   if(mIpv6Socket.IsOpen())
   {
+    // Allocate raw IPv6 packet ring
+    mIpv6RawPackets.Initialize(RawPacketRingSlots, EthernetMtuBytes);
+
     // Launch IPv6 receive thread
     mExitIpv6ReceiveThread = false;
     bool result = mIpv6ReceiveThread.Initialize(Thread::ObjectEntryCreator<Peer, &Peer::Ipv6ReceiveThreadFn>, this, "PeerIpv6ReceiveThread");
@@ -365,6 +385,9 @@ void Peer::Close()
     SendPacket(packet);
   }
 
+  // Send unblocking packets
+  FlushSendPackets();
+
   //
   // Close Sockets
   //
@@ -428,8 +451,12 @@ bool Peer::Send(const IpAddress& ipAddress, const Message& message)
   // Add message
   outPacket.mMessages.PushBack(OutMessage(ZeroMove(messageCopy)));
 
-  // Send outgoing packet
-  return SendPacket(outPacket);
+  // Send outgoing packet immediately
+  // (Packets already queued are sent first, so the result is only this packet's)
+  FlushSendPackets();
+  if(!SendPacket(outPacket)) // Unable?
+    return false;
+  return FlushSendPackets();
 }
 bool Peer::Send(const IpAddress& ipAddress, const Array<Message>& messages)
 {
@@ -450,8 +477,12 @@ bool Peer::Send(const IpAddress& ipAddress, const Array<Message>& messages)
     outPacket.mMessages.PushBack(OutMessage(ZeroMove(messageCopy)));
   }
 
-  // Send outgoing packet
-  return SendPacket(outPacket);
+  // Send outgoing packet immediately
+  // (Packets already queued are sent first, so the result is only this packet's)
+  FlushSendPackets();
+  if(!SendPacket(outPacket)) // Unable?
+    return false;
+  return FlushSendPackets();
 }
 
 bool Peer::Update()
@@ -475,6 +506,9 @@ bool Peer::Update()
   UpdatePeerState();
   ProcessReceivedCustomPackets();
 
+  // Send all packets generated this update
+  FlushSendPackets();
+
   // Success
   return true;
 }
@@ -805,29 +839,71 @@ bool Peer::SendPacket(OutPacket& outPacket)
   if(!PluginEventOnPacketSend(outPacket))
     return true;
 
-  // Write packet to bitstream
-  mSendBitStream.Write(outPacket);
+  // Send packet buffers not allocated?
+  if(mSendPackets.Empty())
+    return false;
 
-  // Choose correct socket (IPv4 or IPv6)
-  Socket& socket = outPacket.GetDestinationIpAddress().GetInternetProtocol() == InternetProtocol::V4
-                 ? mIpv4Socket
-                 : mIpv6Socket;
+  // Batch is full?
+  if(mSendPacketCount == mSendPackets.Size())
+  {
+    // Send queued batch to make room
+    // (A failure here belongs to the packets queued before this one, this packet is still queued)
+    FlushSendPackets();
+  }
 
-  // Send packet over socket
-  Status status;
-  Bytes result = socket.SendTo(status, mSendBitStream.GetData(), mSendBitStream.GetBytesWritten(), outPacket.GetDestinationIpAddress());
-  if(result) // Successful?
+  // Write packet to the next batch slot
+  RawPacket& sendPacket = mSendPackets[mSendPacketCount++];
+  sendPacket.mIpAddress = outPacket.GetDestinationIpAddress();
+  sendPacket.mData.Write(outPacket);
+  return true;
+}
+bool Peer::FlushSendPackets()
+{
+  // Nothing to send?
+  if(mSendPacketCount == 0)
+    return true;
+
+  // Send queued packets over their correct socket (IPv4 or IPv6)
+  bool result = FlushSendPackets(mIpv4Socket, InternetProtocol::V4);
+  result      = FlushSendPackets(mIpv6Socket, InternetProtocol::V6) && result;
+
+  // Clear for next batch
+  for(uint i = 0; i < mSendPacketCount; ++i)
+    mSendPackets[i].mData.Clear(false);
+  mSendPacketCount = 0;
+  return result;
+}
+bool Peer::FlushSendPackets(Socket& socket, InternetProtocol::Enum internetProtocol)
+{
+  // Gather queued packets destined for this socket
+  // (Anything not IPv4 is sent over the IPv6 socket)
+  mSendDatagrams.Clear();
+  for(uint i = 0; i < mSendPacketCount; ++i)
   {
-    Assert(status.Succeeded());
-    Assert(result == mSendBitStream.GetBytesWritten());
+    RawPacket& sendPacket = mSendPackets[i];
+    if((sendPacket.mIpAddress.GetInternetProtocol() == InternetProtocol::V4) != (internetProtocol == InternetProtocol::V4))
+      continue;
 
-    // Update stats
-    UpdateSendStats(result);
+    SocketDatagram& datagram = mSendDatagrams.PushBack();
+    datagram.mData       = sendPacket.mData.GetDataExposed();
+    datagram.mDataLength = sendPacket.mData.GetBytesWritten();
+    datagram.mAddress    = &sendPacket.mIpAddress;
   }
 
-  // Clear for next send
-  mSendBitStream.Clear(false);
-  return (result != 0);
+  // Nothing to send?
+  if(mSendDatagrams.Empty())
+    return true;
+
+  // Send packets over socket
+  Status status;
+  size_t result = socket.SendToBatch(status, mSendDatagrams.Data(), mSendDatagrams.Size());
+
+  // Update stats
+  // (Failed datagrams are skipped without saying which, so the first ones sent are counted)
+  for(size_t i = 0; i < result; ++i)
+    UpdateSendStats(mSendDatagrams[i].mDataLength);
+
+  return (result == mSendDatagrams.Size());
 }
 
 void Peer::UpdateSendStats(Bytes sentPacketBytes)
@@ -897,39 +973,8 @@ OsInt Peer::Ipv4ReceiveThreadFn()
 {
 try
 {
-  //
-  // Receive Loop
-  //
-  RawPacket rawPacket;
-  rawPacket.mData.Reserve(EthernetMtuBytes);
-  while(!mExitIpv4ReceiveThread)
-  {
-    // Wait to receive a packet over socket
-    Status status;
-    SocketAddress sourceAddress;
-    Bytes result = mIpv4Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, sourceAddress);
-    rawPacket.mData.SetBytesWritten(result);
-    rawPacket.mIpAddress = sourceAddress;
-    if(result && IsValidRawPacket(rawPacket)) // Successful?
-    {
-      Assert(rawPacket.mIpAddress.IsValid());
-
-      { //<>-<>-<>-<>-< IPv4 Raw Packets Locked >-<>-<>-<>-<>-
-        Lock lock(mIpv4RawPacketsLock);
-
-        // Push raw packet copy
-        mIpv4RawPackets.PushBack(rawPacket);
-
-      } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
-
-      // Update stats
-      UpdateReceiveStats(result);
-    }
-
-    // Clear for next receive
-    rawPacket.mIpAddress.Clear();
-    rawPacket.mData.Clear(false);
-  }
+  // Receive raw IPv4 packets
+  ReceiveRawPackets(mIpv4Socket, mIpv4RawPackets, mExitIpv4ReceiveThread);
 
   // Success
   return 0;
@@ -951,37 +996,8 @@ OsInt Peer::Ipv6ReceiveThreadFn()
 {
 try
 {
-  //
-  // Receive Loop
-  //
-  RawPacket rawPacket;
-  rawPacket.mData.Reserve(EthernetMtuBytes);
-  while(!mExitIpv6ReceiveThread)
-  {
-    // Wait to receive a packet over socket
-    Status status;
-    Bytes result = mIpv6Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, rawPacket.mIpAddress);
-    rawPacket.mData.SetBytesWritten(result);
-    if(result && IsValidRawPacket(rawPacket)) // Successful?
-    {
-      Assert(rawPacket.mIpAddress.IsValid());
-
-      { //<>-<>-<>-<>-< IPv6 Raw Packets Locked >-<>-<>-<>-<>-
-        Lock lock(mIpv6RawPacketsLock);
-
-        // Push raw packet copy
-        mIpv6RawPackets.PushBack(rawPacket);
-
-      } //-<>-<>-<>-<>-< IPv6 Raw Packets Unlocked >-<>-<>-<>-<>
-
-      // Update stats
-      UpdateReceiveStats(result);
-    }
-
-    // Clear for next receive
-    rawPacket.mIpAddress.Clear();
-    rawPacket.mData.Clear(false);
-  }
+  // Receive raw IPv6 packets
+  ReceiveRawPackets(mIpv6Socket, mIpv6RawPackets, mExitIpv6ReceiveThread);
 
   // Success
   return 0;
@@ -999,17 +1015,71 @@ catch(...)
   // Failure
   return 1;
 }
+void Peer::ReceiveRawPackets(Socket& socket, RawPacketRing& rawPackets, Atomic<bool>& exitThread)
+{
+  //
+  // Receive Loop
+  //
+  SocketDatagram datagrams[PacketBatchCount];
+  while(!exitThread)
+  {
+    // Raw packet ring is full?
+    uint writableCount = std::min(rawPackets.GetWritableCount(), PacketBatchCount);
+    if(writableCount == 0)
+    {
+      // Wait for the user thread to process received packets
+      // (Incoming packets wait in the socket's receive buffer meanwhile)
+      Os::Sleep(1);
+      continue;
+    }
+
+    // Receive directly into free ring slots
+    for(uint i = 0; i < writableCount; ++i)
+    {
+      RawPacket& rawPacket = rawPackets.GetWritable(i);
+      rawPacket.mIpAddress.Clear();
+      rawPacket.mData.Clear(false);
+
+      datagrams[i].mData       = rawPacket.mData.GetDataExposed();
+      datagrams[i].mDataLength = EthernetMtuBytes;
+      datagrams[i].mAddress    = &rawPacket.mIpAddress;
+    }
+
+    // Wait to receive packets over socket
+    Status status;
+    uint result = uint(socket.ReceiveFromBatch(status, datagrams, writableCount));
+    for(uint i = 0; i < result; ++i)
+    {
+      // (Source address is written without building its host string, the user thread does that when translating)
+      RawPacket& rawPacket = rawPackets.GetWritable(i);
+      rawPacket.mData.SetBytesWritten(datagrams[i].mDataLength);
+      if(datagrams[i].mDataLength && IsValidRawPacket(rawPacket)) // Successful?
+      {
+        Assert(rawPacket.mIpAddress.IsValid());
+
+        // Update stats
+        UpdateReceiveStats(datagrams[i].mDataLength);
+      }
+      else
+      {
+        // Discard invalid packet
+        rawPacket.mData.Clear(false);
+      }
+    }
+
+    // Push raw packets
+    rawPackets.Push(result);
+  }
+}
 
 void Peer::UpdatePeerState()
 {
   //
   // Update Peer
   //
-  Array<RawPacket> rawPackets;
   Array<InPacket>  inPackets;
   TimeMs           elapsedExitGraceDuration = 0;
   TimeMs           lastExitGraceTime        = 0;
-  mSendBitStream.Reserve(EthernetMtuBytes);
 
   //
   // Update Plugin Set
@@ -1112,34 +1182,14 @@ void Peer::UpdatePeerState()
   }
 
   //
-  // Translate Raw IPv4 Packets
+  // Translate Raw Packets
   //
-  Assert(rawPackets.Empty());
-  { //<>-<>-<>-<>-< IPv4 Raw Packets Locked >-<>-<>-<>-<>-
-    Lock lock(mIpv4RawPacketsLock);
-
-    // Get raw IPv4 packets
-    rawPackets.Swap(mIpv4RawPackets);
-
-  } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
 
   // Translate raw IPv4 packets
-  TranslateRawPackets(rawPackets, inPackets);
-
-  //
-  // Translate Raw IPv6 Packets
-  //
-  Assert(rawPackets.Empty());
-  { //<>-<>-<>-<>-< IPv6 Raw Packets Locked >-<>-<>-<>-<>-
-    Lock lock(mIpv6RawPacketsLock);
-
-    // Get raw IPv6 packets
-    rawPackets.Swap(mIpv6RawPackets);
-
-  } //-<>-<>-<>-<>-< IPv6 Raw Packets Unlocked >-<>-<>-<>-<>
+  TranslateRawPackets(mIpv4RawPackets, inPackets);
 
   // Translate raw IPv6 packets
-  TranslateRawPackets(rawPackets, inPackets);
+  TranslateRawPackets(mIpv6RawPackets, inPackets);
 
   //
   // Process Received Packets
@@ -1242,17 +1292,27 @@ void Peer::ProcessReceivedCustomPacket(InPacket& packet)
   return mProcessReceivedCustomPacketFn(this, packet);
 }
 
-void Peer::TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& inPackets)
+void Peer::TranslateRawPackets(RawPacketRing& rawPackets, Array<InPacket>& inPackets)
 {
-  // For all RawPackets
-  forRange(RawPacket& rawPacket, rawPackets.All())
+  // For all received RawPackets
+  uint count = rawPackets.GetReadableCount();
+  for(uint i = 0; i < count; ++i)
   {
+    RawPacket& rawPacket = rawPackets.GetReadable(i);
+
+    // Discarded by the receive thread?
+    if(rawPacket.mData.GetBitsWritten() == 0)
+      continue;
+
     // Read as InPacket
-    InPacket inPacket(rawPacket.mIpAddress);
+    // (Rebuilds the source IP address from the socket address written by the receive thread)
+    InPacket inPacket(IpAddress(static_cast<const SocketAddress&>(rawPacket.mIpAddress)));
     if(rawPacket.mData.Read(inPacket)) // Successful?
       inPackets.PushBack(ZeroMove(inPacket));
   }
-  rawPackets.Clear();
+
+  // Return slots to the receive thread
+  rawPackets.Pop(count);
 }
 
 bool Peer::PluginEventOnPacketSend(OutPacket& packet)
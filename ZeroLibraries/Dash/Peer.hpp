@@ -231,9 +231,16 @@ public:
   /// (Exclusively used by the Peer's receive thread)
   TimeMs UpdateAndGetReceiveTime();
 
-  /// Sends an outgoing packet to the network
-  /// Returns true if successful, else false
+  /// Queues an outgoing packet to be sent to the network with the next batch
+  /// Sends the queued batch first if it is full
+  /// Returns true if the packet was queued (or stopped by a plugin), else false
   bool SendPacket(OutPacket& outPacket);
+  /// Sends all queued outgoing packets to the network
+  /// Returns true if all were sent, else false
+  bool FlushSendPackets();
+  /// Sends all queued outgoing packets of the specified IP protocol over the socket
+  /// Returns true if all were sent, else false
+  bool FlushSendPackets(Socket& socket, InternetProtocol::Enum internetProtocol);
 
   /// Updates packet send statistics
   void UpdateSendStats(Bytes sentPacketBytes);
@@ -247,6 +254,8 @@ public:
   OsInt Ipv4ReceiveThreadFn();
   /// Receives incoming IPv6 packets from the network
   OsInt Ipv6ReceiveThreadFn();
+  /// Receives incoming packets from the network directly into the raw packet ring until told to exit
+  void ReceiveRawPackets(Socket& socket, RawPacketRing& rawPackets, Atomic<bool>& exitThread);
 
   /// Processes incoming packets, updates peer and link state, and generates outgoing packets
   void UpdatePeerState();
@@ -256,7 +265,7 @@ public:
   void ProcessReceivedCustomPacket(InPacket& packet);
 
   // Translate raw incoming packets into packets that can be processed
-  void TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& inPackets);
+  void TranslateRawPackets(RawPacketRing& rawPackets, Array<InPacket>& inPackets);
 
   /// Called before a packet is sent
   /// Return true to continue sending the packet, else false
@@ -305,14 +314,14 @@ public:
   uint64 mLocalFrameId; /// Local update frame ID
 
   /// Packet Data
-  Array<RawPacket>   mIpv4RawPackets;            /// Raw incoming IPv4 packets
-  mutable ThreadLock mIpv4RawPacketsLock;        /// Raw incoming IPv4 packets thread lock
-  Array<RawPacket>   mIpv6RawPackets;            /// Raw incoming IPv6 packets
-  mutable ThreadLock mIpv6RawPacketsLock;        /// Raw incoming IPv6 packets thread lock
-  BitStream          mSendBitStream;             /// Reusable outgoing packet bitstream
-  mutable ThreadLock mReceiveStatsLock;          /// Receive stats thread lock
-  Array<InPacket>    mReleasedCustomPackets;     /// Released incoming user packets
-  mutable ThreadLock mReleasedCustomPacketsLock; /// Released incoming user packets thread lock
+  RawPacketRing         mIpv4RawPackets;            /// Raw incoming IPv4 packets
+  RawPacketRing         mIpv6RawPackets;            /// Raw incoming IPv6 packets
+  Array<RawPacket>      mSendPackets;               /// Reusable outgoing packet batch
+  uint                  mSendPacketCount;           /// Outgoing packets queued in the batch
+  Array<SocketDatagram> mSendDatagrams;             /// Reusable outgoing datagram batch
+  mutable ThreadLock    mReceiveStatsLock;          /// Receive stats thread lock
+  Array<InPacket>       mReleasedCustomPackets;     /// Released incoming user packets
+  mutable ThreadLock    mReleasedCustomPacketsLock; /// Released incoming user packets thread lock
 
   /// Link Data
   PeerLinkSet mCreatedLinks;   /// Links which were just created, need to be added
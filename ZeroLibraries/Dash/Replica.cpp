@@ -31,6 +31,7 @@ Replica::Replica()
     mAccurateTimestampOnInitialization(false),
     mAccurateTimestampOnChange(false),
     mAccurateTimestampOnUninitialization(false),
+    mInterestMode(InterestMode::Spatial),
     mReplicaChannels(),
     mUserData(nullptr)
 {
@@ -54,6 +55,7 @@ Replica::Replica(const CreateContext& createContext, const ReplicaType& replicaT
     mAccurateTimestampOnInitialization(false),
     mAccurateTimestampOnChange(false),
     mAccurateTimestampOnUninitialization(false),
+    mInterestMode(InterestMode::Spatial),
     mReplicaChannels(),
     mUserData(nullptr)
 {
@@ -261,6 +263,7 @@ void Replica::ResetConfig()
   SetAccurateTimestampOnInitialization();
   SetAccurateTimestampOnChange();
   SetAccurateTimestampOnUninitialization();
+  SetInterestMode();
 }
 
 void Replica::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -326,6 +329,15 @@ bool Replica::GetAccurateTimestampOnUninitialization() const
   return mAccurateTimestampOnUninitialization;
 }
 
+void Replica::SetInterestMode(InterestMode::Enum interestMode)
+{
+  mInterestMode = interestMode;
+}
+InterestMode::Enum Replica::GetInterestMode() const
+{
+  return mInterestMode;
+}
+
 //
 // Replica Channel Management
 //
@@ -148,6 +148,11 @@ public:
   void SetAccurateTimestampOnUninitialization(bool accurateTimestampOnUninitialization = false);
   bool GetAccurateTimestampOnUninitialization() const;
 
+  /// Controls which links the replica is relevant to when the replicator uses interest management
+  /// (Only spawned replicas are ever filtered, emplaced replicas are always relevant)
+  void SetInterestMode(InterestMode::Enum interestMode = InterestMode::Spatial);
+  InterestMode::Enum GetInterestMode() const;
+
   //
   // Replica Channel Management
   //
@@ -214,6 +219,7 @@ public:
   bool              mAccurateTimestampOnInitialization;   /// Accurate timestamp when initialized?
   bool              mAccurateTimestampOnChange;           /// Accurate timestamp when changed (on any replica channel)?
   bool              mAccurateTimestampOnUninitialization; /// Accurate timestamp when uninitialized?
+  InterestMode::Enum mInterestMode;                       /// Interest mode
   ReplicaChannelSet mReplicaChannels;                     /// Replica channels
   void*             mUserData;                            /// Optional user data
 
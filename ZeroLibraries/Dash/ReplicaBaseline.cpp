@@ -0,0 +1,376 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Zero runs are written as a single byte count
+static const uint cMaxZeroRun = 256;
+
+/// Returns the snapshot byte at the index XOR'd against the baseline byte at the same index (if any)
+inline byte GetDeltaByte(const ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline, uint index)
+{
+  if(baseline && index < baseline->Size())
+    return snapshot[index] ^ (*baseline)[index];
+  return snapshot[index];
+}
+
+bool WriteSnapshotDelta(BitStream& bitStream, const ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline)
+{
+  // Write snapshot size
+  if(snapshot.Size() > MaxMessageWholeDataBytes) // Too large?
+  {
+    Assert(false);
+    return false;
+  }
+  bitStream.WriteQuantized(Bytes(snapshot.Size()), Bytes(0), Bytes(MaxMessageWholeDataBytes));
+
+  // For all snapshot bytes
+  for(uint i = 0; i < snapshot.Size();)
+  {
+    byte delta = GetDeltaByte(snapshot, baseline, i);
+
+    // Unchanged byte?
+    if(delta == 0)
+    {
+      // Measure run of unchanged bytes
+      uint run = 1;
+      while(i + run < snapshot.Size() && run < cMaxZeroRun && GetDeltaByte(snapshot, baseline, i + run) == 0)
+        ++run;
+
+      // Write zero run
+      bitStream.Write(true);
+      bitStream.Write(byte(run - 1));
+      i += run;
+    }
+    // Changed byte?
+    else
+    {
+      // Write delta byte
+      bitStream.Write(false);
+      bitStream.Write(delta);
+      ++i;
+    }
+  }
+
+  // Success
+  return true;
+}
+bool ReadSnapshotDelta(const BitStream& bitStream, ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline)
+{
+  // Read snapshot size
+  Bytes size = 0;
+  if(!bitStream.ReadQuantized(size, Bytes(0), Bytes(MaxMessageWholeDataBytes))) // Unable?
+    return false;
+  snapshot.Resize(size);
+
+  // For all snapshot bytes
+  for(uint i = 0; i < snapshot.Size();)
+  {
+    // Read zero run flag
+    bool isZeroRun;
+    if(!bitStream.Read(isZeroRun)) // Unable?
+      return false;
+
+    // Read zero run or delta byte
+    byte value;
+    if(!bitStream.Read(value)) // Unable?
+      return false;
+
+    // Zero run?
+    uint run = isZeroRun ? (uint(value) + 1) : 1;
+    if(i + run > snapshot.Size()) // Invalid?
+      return false;
+
+    // Undo delta against the baseline
+    for(uint end = i + run; i < end; ++i)
+    {
+      byte delta = isZeroRun ? 0 : value;
+      snapshot[i] = (baseline && i < baseline->Size()) ? byte(delta ^ (*baseline)[i]) : delta;
+    }
+  }
+
+  // Success
+  return true;
+}
+
+//---------------------------------------------------------------------------------//
+//                             OutReplicaBaselines                                 //
+//---------------------------------------------------------------------------------//
+
+OutReplicaBaselines::OutReplicaBaselines()
+  : mNextBaselineId(0),
+    mHasBaseline(false),
+    mBaselineId(0),
+    mBaseline(),
+    mSentSnapshots()
+{
+}
+
+BaselineId OutReplicaBaselines::Write(BitStream& bitStream, const ReplicaSnapshot& snapshot)
+{
+  // Get snapshot baseline ID
+  BaselineId baselineId = mNextBaselineId++;
+
+  // Baseline is too old to still be remembered remotely?
+  if(mHasBaseline && (baselineId - mBaselineId).value() >= cBaselineHistoryCount)
+  {
+    // Stop using it
+    mHasBaseline = false;
+    mBaseline.Clear();
+  }
+
+  // Write snapshot header
+  bitStream.Write(baselineId);
+  bitStream.Write(mHasBaseline);
+  if(mHasBaseline)
+    bitStream.Write(mBaselineId);
+
+  // Write snapshot
+  WriteSnapshotDelta(bitStream, snapshot, mHasBaseline ? &mBaseline : nullptr);
+  return baselineId;
+}
+
+void OutReplicaBaselines::AddSent(MessageReceiptId receiptId, BaselineId baselineId, const ReplicaSnapshot& snapshot)
+{
+  // Too many snapshots awaiting receipt?
+  // (Their baseline IDs would be too old to use by the time they are receipted)
+  if(mSentSnapshots.Size() >= cBaselineHistoryCount)
+    mSentSnapshots.Erase(mSentSnapshots.Begin()); // Forget the oldest
+
+  // Add sent snapshot
+  SentSnapshot sentSnapshot;
+  sentSnapshot.mBaselineId = baselineId;
+  sentSnapshot.mSnapshot   = snapshot;
+  mSentSnapshots.Insert(receiptId, sentSnapshot);
+}
+void OutReplicaBaselines::OnReceipt(MessageReceiptId receiptId, Receipt::Enum receipt)
+{
+  // Find sent snapshot
+  SentSnapshots::iterator iter = mSentSnapshots.FindIterator(receiptId);
+  if(iter == mSentSnapshots.End()) // Unable?
+    return;
+
+  // Not acknowledged?
+  // (MAYBE indicates a sequenced message may have been discarded on arrival, so it can't be relied on as a baseline)
+  if(receipt != Receipt::ACK)
+  {
+    // Forget snapshot
+    mSentSnapshots.Erase(iter);
+    return;
+  }
+
+  // Newer than our current baseline?
+  SentSnapshot& sentSnapshot = iter->second;
+  if(!mHasBaseline || sentSnapshot.mBaselineId > mBaselineId)
+  {
+    // Use as our new baseline
+    mHasBaseline = true;
+    mBaselineId  = sentSnapshot.mBaselineId;
+    mBaseline    = ZeroMove(sentSnapshot.mSnapshot);
+  }
+
+  // Forget this and all older snapshots
+  // (Older snapshots are no longer useful as baselines)
+  mSentSnapshots.Erase(mSentSnapshots.SubRange(0, (iter - mSentSnapshots.Begin()) + 1));
+}
+void OutReplicaBaselines::Reset()
+{
+  // Stop using our baseline
+  mHasBaseline = false;
+  mBaseline.Clear();
+
+  // Forget snapshots awaiting receipt
+  // (They may have been written against the baseline the remote peer is missing, so they can't be relied on either)
+  mSentSnapshots.Clear();
+}
+
+//---------------------------------------------------------------------------------//
+//                              InReplicaBaselines                                 //
+//---------------------------------------------------------------------------------//
+
+InReplicaBaselines::InReplicaBaselines()
+  : mSnapshots(),
+    mResetRequested(false)
+{
+  mSnapshots.Resize(cBaselineHistoryCount);
+}
+
+bool InReplicaBaselines::Read(const BitStream& bitStream, ReplicaSnapshot& snapshot)
+{
+  // Read snapshot header
+  BaselineId baselineId;
+  bool       hasBaseline;
+  if(!bitStream.Read(baselineId)
+  || !bitStream.Read(hasBaseline)) // Unable?
+    return false;
+
+  // Get baseline snapshot (if any)
+  const ReplicaSnapshot* baseline = nullptr;
+  if(hasBaseline)
+  {
+    BaselineId deltaBaselineId;
+    if(!bitStream.Read(deltaBaselineId)) // Unable?
+      return false;
+
+    // Baseline no longer remembered?
+    const ReceivedSnapshot& receivedBaseline = mSnapshots[deltaBaselineId.value() % cBaselineHistoryCount];
+    if(!receivedBaseline.mIsValid || receivedBaseline.mBaselineId != deltaBaselineId)
+      return false;
+
+    baseline = &receivedBaseline.mSnapshot;
+  }
+
+  // Read snapshot
+  if(!ReadSnapshotDelta(bitStream, snapshot, baseline)) // Unable?
+    return false;
+
+  // Written without a baseline?
+  // (The sender has either reset or never had a baseline, a new reset may be requested if we fail again)
+  if(!hasBaseline)
+    mResetRequested = false;
+
+  // Remember snapshot (it may be used as a baseline later)
+  ReceivedSnapshot& receivedSnapshot = mSnapshots[baselineId.value() % cBaselineHistoryCount];
+  receivedSnapshot.mIsValid    = true;
+  receivedSnapshot.mBaselineId = baselineId;
+  receivedSnapshot.mSnapshot   = snapshot;
+  return true;
+}
+
+bool InReplicaBaselines::ShouldRequestReset()
+{
+  // Already requested?
+  if(mResetRequested)
+    return false;
+
+  mResetRequested = true;
+  return true;
+}
+
+//---------------------------------------------------------------------------------//
+//                                  Unit Tests                                     //
+//---------------------------------------------------------------------------------//
+
+/// Returns a snapshot of pseudo-random bytes
+ReplicaSnapshot MakeTestSnapshot(uint size, uint seed)
+{
+  ReplicaSnapshot snapshot;
+  snapshot.Resize(size);
+  for(uint i = 0; i < size; ++i)
+  {
+    seed = seed * 1664525 + 1013904223;
+    snapshot[i] = byte(seed >> 24);
+  }
+  return snapshot;
+}
+
+/// Returns true if the snapshot is read back exactly as written, else false
+bool RoundTripSnapshot(const ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline)
+{
+  BitStream bitStream;
+  if(!WriteSnapshotDelta(bitStream, snapshot, baseline))
+    return false;
+
+  ReplicaSnapshot result;
+  if(!ReadSnapshotDelta(bitStream, result, baseline))
+    return false;
+
+  return result == snapshot && bitStream.GetBitsUnread() == 0;
+}
+
+void RunReplicaBaselineUnitTests()
+{
+  //
+  // Snapshot Deltas
+  //
+
+  ReplicaSnapshot empty;
+  ReplicaSnapshot snapshot = MakeTestSnapshot(1000, 1);
+  ErrorIf(!RoundTripSnapshot(empty, nullptr), "Empty snapshot did not round trip");
+  ErrorIf(!RoundTripSnapshot(snapshot, nullptr), "Snapshot without a baseline did not round trip");
+  ErrorIf(!RoundTripSnapshot(snapshot, &empty), "Snapshot against an empty baseline did not round trip");
+
+  // Unchanged against the baseline (several zero runs longer than a single run can hold)
+  ErrorIf(!RoundTripSnapshot(snapshot, &snapshot), "Snapshot against itself did not round trip");
+  BitStream unchanged;
+  WriteSnapshotDelta(unchanged, snapshot, &snapshot);
+  ErrorIf(unchanged.GetBytesWritten() > 16, "Unchanged snapshot was not run length encoded");
+
+  // A few changed bytes, including the first and last
+  ReplicaSnapshot changed = snapshot;
+  changed[0] ^= 0xFF;
+  changed[500] += 1;
+  changed[999] = 0;
+  ErrorIf(!RoundTripSnapshot(changed, &snapshot), "Partially changed snapshot did not round trip");
+
+  // Baselines shorter and longer than the snapshot
+  ReplicaSnapshot shorter = MakeTestSnapshot(300, 2);
+  ReplicaSnapshot longer  = MakeTestSnapshot(2000, 3);
+  ErrorIf(!RoundTripSnapshot(snapshot, &shorter), "Snapshot against a shorter baseline did not round trip");
+  ErrorIf(!RoundTripSnapshot(snapshot, &longer), "Snapshot against a longer baseline did not round trip");
+  ErrorIf(!RoundTripSnapshot(shorter, &snapshot), "Shorter snapshot did not round trip");
+
+  // Truncated data
+  BitStream truncated;
+  WriteSnapshotDelta(truncated, snapshot, nullptr);
+  BitStream partial;
+  partial.WriteBytes(truncated.GetData(), truncated.GetBytesWritten() / 2);
+  ReplicaSnapshot result;
+  ErrorIf(ReadSnapshotDelta(partial, result, nullptr), "Truncated snapshot was read");
+
+  //
+  // Baselines
+  //
+
+  OutReplicaBaselines out;
+  InReplicaBaselines in;
+  MessageReceiptId receiptId = 1;
+
+  // First snapshot has no baseline
+  ReplicaSnapshot first = MakeTestSnapshot(100, 4);
+  BitStream firstStream;
+  BaselineId firstId = out.Write(firstStream, first);
+  out.AddSent(receiptId, firstId, first);
+  ErrorIf(!in.Read(firstStream, result) || result != first, "First snapshot was not read");
+
+  // A MAYBE receipt does not become the baseline
+  out.OnReceipt(receiptId++, Receipt::MAYBE);
+  ErrorIf(out.mHasBaseline, "MAYBE receipt became the baseline");
+
+  // An ACK does
+  BitStream secondStream;
+  BaselineId secondId = out.Write(secondStream, first);
+  out.AddSent(receiptId, secondId, first);
+  ErrorIf(!in.Read(secondStream, result) || result != first, "Second snapshot was not read");
+  out.OnReceipt(receiptId++, Receipt::ACK);
+  ErrorIf(!out.mHasBaseline || out.mBaselineId != secondId, "ACK did not become the baseline");
+
+  // Later snapshots are written against it
+  ReplicaSnapshot third = changed;
+  third.Resize(100);
+  BitStream thirdStream;
+  out.Write(thirdStream, third);
+  ErrorIf(!in.Read(thirdStream, result) || result != third, "Delta compressed snapshot was not read");
+
+  // A receiver that is missing the baseline can't read it, and requests a reset only once
+  InReplicaBaselines missing;
+  thirdStream.ClearBitsRead();
+  ErrorIf(missing.Read(thirdStream, result), "Snapshot was read without its baseline");
+  ErrorIf(!missing.ShouldRequestReset(), "Baseline reset was not requested");
+  ErrorIf(missing.ShouldRequestReset(), "Baseline reset was requested twice");
+
+  // After a reset the next snapshot is written without a baseline, which allows another reset request
+  out.Reset();
+  ErrorIf(out.mHasBaseline || !out.mSentSnapshots.Empty(), "Reset kept the baseline");
+  BitStream resetStream;
+  out.Write(resetStream, third);
+  ErrorIf(!missing.Read(resetStream, result) || result != third, "Snapshot after a reset was not read");
+  ErrorIf(!missing.ShouldRequestReset(), "Baseline reset could not be requested again");
+}
+
+} // namespace Zero
@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+/// Number of recent snapshots remembered per replica channel
+/// (Acknowledged baselines older than this many snapshots are no longer used)
+static const uint cBaselineHistoryCount = 64;
+StaticAssertWithinRange(Range18, cBaselineHistoryCount, 1, (uint(1) << (BASELINE_ID_BITS - 1)));
+
+/// Replica channel snapshot
+/// All replica property values of a replica channel, serialized in full
+typedef Array<byte> ReplicaSnapshot;
+
+/// Writes the snapshot XOR'd against the baseline (or as is, without a baseline), zero-run encoded
+/// Returns true if successful, else false
+bool WriteSnapshotDelta(BitStream& bitStream, const ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline);
+/// Reads a snapshot XOR'd against the baseline (or as is, without a baseline), zero-run encoded
+/// Returns true if successful, else false
+bool ReadSnapshotDelta(const BitStream& bitStream, ReplicaSnapshot& snapshot, const ReplicaSnapshot* baseline);
+
+/// Round trips snapshots through the delta encoding and the outgoing and incoming baselines
+/// (Errors on any failure)
+void RunReplicaBaselineUnitTests();
+
+//---------------------------------------------------------------------------------//
+//                             OutReplicaBaselines                                 //
+//---------------------------------------------------------------------------------//
+
+/// Outgoing Replica Baselines
+/// Snapshots of a replica channel sent on a link, and the latest one the link has acknowledged
+class OutReplicaBaselines
+{
+public:
+  /// Constructor
+  OutReplicaBaselines();
+
+  /// Writes the snapshot, delta compressed against the latest acknowledged baseline (if any)
+  /// Returns the snapshot's baseline ID
+  BaselineId Write(BitStream& bitStream, const ReplicaSnapshot& snapshot);
+
+  /// Remembers the snapshot until the message it was sent with is receipted
+  void AddSent(MessageReceiptId receiptId, BaselineId baselineId, const ReplicaSnapshot& snapshot);
+  /// Handles the receipt of the message a snapshot was sent with
+  /// Acknowledged snapshots newer than the current baseline become the new baseline
+  void OnReceipt(MessageReceiptId receiptId, Receipt::Enum receipt);
+  /// Stops using the acknowledged baseline and forgets every snapshot awaiting receipt
+  /// (Called when the remote peer could not read a snapshot, the next snapshot is written without a baseline)
+  void Reset();
+
+  /// Sent Snapshot
+  struct SentSnapshot
+  {
+    BaselineId      mBaselineId; /// Snapshot baseline ID
+    ReplicaSnapshot mSnapshot;   /// Snapshot data
+  };
+
+  /// Typedefs
+  typedef ArrayMap<MessageReceiptId, SentSnapshot> SentSnapshots;
+
+  /// Data
+  BaselineId      mNextBaselineId;  /// Next snapshot baseline ID
+  bool            mHasBaseline;     /// Has an acknowledged baseline?
+  BaselineId      mBaselineId;      /// Acknowledged baseline ID
+  ReplicaSnapshot mBaseline;        /// Acknowledged baseline snapshot
+  SentSnapshots   mSentSnapshots;   /// Sent snapshots awaiting receipt (by message receipt ID)
+};
+
+//---------------------------------------------------------------------------------//
+//                              InReplicaBaselines                                 //
+//---------------------------------------------------------------------------------//
+
+/// Incoming Replica Baselines
+/// Recent snapshots of a replica channel received on a link
+class InReplicaBaselines
+{
+public:
+  /// Constructor
+  InReplicaBaselines();
+
+  /// Reads a snapshot, delta compressed against the baseline it was written with (if any)
+  /// Returns true if successful, else false (the baseline is no longer remembered)
+  bool Read(const BitStream& bitStream, ReplicaSnapshot& snapshot);
+
+  /// Returns true if a baseline reset should be requested after failing to read a snapshot, else false
+  /// (Only requested once, until a snapshot written without a baseline is read)
+  bool ShouldRequestReset();
+
+  /// Received Snapshot
+  struct ReceivedSnapshot
+  {
+    ReceivedSnapshot() : mIsValid(false), mBaselineId(0), mSnapshot() {}
+
+    bool            mIsValid;    /// Received?
+    BaselineId      mBaselineId; /// Snapshot baseline ID
+    ReplicaSnapshot mSnapshot;   /// Snapshot data
+  };
+
+  /// Data
+  Array<ReceivedSnapshot> mSnapshots;      /// Recent snapshots (indexed by baseline ID modulo history count)
+  bool                    mResetRequested; /// Has requested a baseline reset not yet answered?
+};
+
+} // namespace Zero
@@ -468,13 +468,13 @@ bool ReplicaChannel::ObserveForChange()
   }
 }
 
-bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll) const
 {
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = GetReplicaChannelType();
 
   // (For the initialization replication phase we want to forcefully serialize all replica properties to ensure a valid initial value state)
-  bool forceAll = (replicationPhase == ReplicationPhase::Initialization);
+  forceAll |= (replicationPhase == ReplicationPhase::Initialization);
 
   //    Serialize all replica properties?
   // OR There is only a single replica property?
@@ -487,7 +487,7 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
     forRange(ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Write replica property
-      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp);
+      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp, forceAll);
       if(!result) // Unable?
       {
         Assert(false);
@@ -522,13 +522,13 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
   // Success
   return true;
 }
-bool ReplicaChannel::Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp)
+bool ReplicaChannel::Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll)
 {
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = GetReplicaChannelType();
 
   // (For the initialization replication phase we want to forcefully deserialize all replica properties to ensure a valid initial value state)
-  bool forceAll = (replicationPhase == ReplicationPhase::Initialization);
+  forceAll |= (replicationPhase == ReplicationPhase::Initialization);
 
   //    Serialize all replica properties?
   // OR There is only a single replica property?
@@ -541,7 +541,7 @@ bool ReplicaChannel::Deserialize(const BitStream& bitStream, ReplicationPhase::E
     forRange(ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Read replica property
-      bool result = replicaProperty->Deserialize(bitStream, replicationPhase, timestamp);
+      bool result = replicaProperty->Deserialize(bitStream, replicationPhase, timestamp, forceAll);
       if(!result) // Unable?
       {
         //Assert(false);
@@ -926,6 +926,8 @@ void ReplicaChannelType::ResetConfig()
   SetReliabilityMode();
   SetTransferMode();
   SetAccurateTimestampOnChange();
+  SetPriority();
+  SetDeltaCompression();
 }
 
 void ReplicaChannelType::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -1132,4 +1134,31 @@ bool ReplicaChannelType::GetAccurateTimestampOnChange() const
   return mAccurateTimestampOnChange;
 }
 
+void ReplicaChannelType::SetPriority(float priority)
+{
+  // (Priority cannot be negative)
+  mPriority = Math::Max(priority, 0.0f);
+}
+float ReplicaChannelType::GetPriority() const
+{
+  return mPriority;
+}
+
+void ReplicaChannelType::SetDeltaCompression(bool deltaCompression)
+{
+  // Already valid?
+  if(IsValid())
+  {
+    // Unable to modify configuration
+    Error("ReplicaChannelType is already valid, unable to modify configuration");
+    return;
+  }
+
+  mDeltaCompression = deltaCompression;
+}
+bool ReplicaChannelType::GetDeltaCompression() const
+{
+  return mDeltaCompression;
+}
+
 } // namespace Zero
@@ -142,11 +142,13 @@ public:
   bool ObserveForChange();
 
   /// Serializes the replica channel
+  /// (All replica property values are serialized in full when forced, or for the initialization replication phase)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll = false) const;
   /// Deserializes the replica channel
+  /// (All replica property values are deserialized in full when forced, or for the initialization replication phase)
   /// Returns true if successful, else false
-  bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
+  bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll = false);
 
   /// Data
   String               mName;                /// Replica channel name
@@ -347,6 +349,18 @@ public:
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
 
+  /// Controls how much priority replica channel changes accumulate every frame they wait to be sent, relative to other replica channel types
+  /// (Only used when the replicator prioritizes changes)
+  void SetPriority(float priority = 1);
+  float GetPriority() const;
+
+  /// Controls whether or not replica channel changes are sent in full, delta compressed against the last change each link acknowledged
+  /// Property values are XOR'd against the acknowledged baseline and runs of unchanged bytes are written as a single count
+  /// (Intended for unreliable replica channels whose properties change by small amounts every frame)
+  /// (Cannot be modified after the replica channel type has been made valid)
+  void SetDeltaCompression(bool deltaCompression = false);
+  bool GetDeltaCompression() const;
+
   /// Data
   String                   mName;                           /// Replica channel type name
   Replicator*              mReplicator;                     /// Operating replicator
@@ -369,6 +383,8 @@ public:
   ReliabilityMode::Enum    mReliabilityMode;                /// Change message reliability mode
   TransferMode::Enum       mTransferMode;                   /// Change message transfer mode
   bool                     mAccurateTimestampOnChange;      /// Accurate timestamp when changed?
+  float                    mPriority;                       /// Change priority accumulated every frame
+  bool                     mDeltaCompression;               /// Delta compress changes against acknowledged baselines?
 };
 
 /// Typedefs
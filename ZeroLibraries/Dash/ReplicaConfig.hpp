@@ -40,6 +40,11 @@ StaticAssertWithinRange(Range14, REPLICA_TYPE_ID_BITS, 1, UINTMAX_BITS);
 #define EMPLACE_CONTEXT_ID_BITS 11
 StaticAssertWithinRange(Range15, EMPLACE_CONTEXT_ID_BITS, 1, UINTMAX_BITS);
 
+/// Baseline ID bits
+/// Determines how many delta compressed replica channel changes may be sent before baseline IDs wrap around
+#define BASELINE_ID_BITS 8
+StaticAssertWithinRange(Range17, BASELINE_ID_BITS, 8, UINTMAX_BITS);
+
 /// Replica should use a virtual destructor?
 /// Enable this if you're relying on replica polymorphism for deletion
 #define REPLICA_USE_VIRTUAL_DESTRUCTOR 0
@@ -180,6 +185,15 @@ typedef UintN<ReplicaTypeIdBits> ReplicaTypeId;
 static const Bits EmplaceContextIdBits = EMPLACE_CONTEXT_ID_BITS;
 typedef UintN<EmplaceContextIdBits> EmplaceContextId;
 
+//---------------------------------------------------------------------------------//
+//                                Baseline ID                                      //
+//---------------------------------------------------------------------------------//
+
+/// Baseline ID
+/// Identifies a replica channel snapshot sent on a link (used as a baseline for delta compression once acknowledged)
+static const Bits BaselineIdBits = BASELINE_ID_BITS;
+typedef UintN<BaselineIdBits, true> BaselineId;
+
 //---------------------------------------------------------------------------------//
 //                             Property Functions                                  //
 //---------------------------------------------------------------------------------//
@@ -239,7 +253,7 @@ DeclareEnum2(AuthorityMode,
   Fixed);  /// Authority is fixed and cannot be modified after a replica is made valid
 
 /// Replicator Plugin Message Types
-DeclareEnum11(ReplicatorMessageType,
+DeclareEnum12(ReplicatorMessageType,
   ConnectConfirmation,     /// Connect confirmation
   CreateContextItems,      /// Creation context cache items
   ReplicaTypeItems,        /// Replica type cache items
@@ -250,7 +264,8 @@ DeclareEnum11(ReplicatorMessageType,
   Destroy,                 /// Destroy command
   Change,                  /// Replica channel change
   Interrupt,               /// Interrupt step command
-  ReverseReplicaChannels); /// Reverse replica channel mappings
+  ReverseReplicaChannels,  /// Reverse replica channel mappings
+  BaselineReset);          /// Delta compressed replica channel baseline reset request
 
 // Replica Stream Serialization Mode
 DeclareEnum5(ReplicaStreamMode,
@@ -308,6 +323,11 @@ DeclareEnum3(ReplicationPhase,
   Uninitialization,  /// Replica/Channel/Property uninitialization
   Change);           /// Replica/Channel/Property change
 
+/// Replica Interest Mode
+DeclareEnum2(InterestMode,
+  Spatial, /// Relevant to links with an interest volume containing the replica (replicas without a position are always relevant)
+  Always); /// Always relevant to every link
+
 /// Replica Property Convergence State
 DeclareEnum3(ConvergenceState,
   None,     /// No convergence is being applied
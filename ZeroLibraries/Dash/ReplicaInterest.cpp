@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Cell coordinates are packed into 21 bits per axis
+static const int cCellCoordinateBits   = 21;
+static const int cCellCoordinateOffset = 1 << (cCellCoordinateBits - 1);
+static const u64 cCellCoordinateMask   = (u64(1) << cCellCoordinateBits) - 1;
+
+//---------------------------------------------------------------------------------//
+//                                InterestVolume                                   //
+//---------------------------------------------------------------------------------//
+
+InterestVolume::InterestVolume()
+  : mSpace(0),
+    mCenter(Vector3::cZero),
+    mRadius(0)
+{
+}
+InterestVolume::InterestVolume(ReplicaId space, const Vector3& center, float radius)
+  : mSpace(space),
+    mCenter(center),
+    mRadius(radius)
+{
+}
+
+bool InterestVolume::Contains(ReplicaId space, const Vector3& position, float padding) const
+{
+  // Different space?
+  if(space != mSpace)
+    return false;
+
+  float radius = mRadius + padding;
+  return Math::LengthSq(position - mCenter) <= radius * radius;
+}
+
+//---------------------------------------------------------------------------------//
+//                                 InterestGrid                                    //
+//---------------------------------------------------------------------------------//
+
+InterestGrid::InterestGrid()
+  : mCellSize(0),
+    mEntries(),
+    mSpaces(),
+    mIndices()
+{
+  SetCellSize();
+}
+
+void InterestGrid::SetCellSize(float cellSize)
+{
+  // (Cell size must be positive)
+  mCellSize = Math::Max(cellSize, 0.001f);
+}
+float InterestGrid::GetCellSize() const
+{
+  return mCellSize;
+}
+
+void InterestGrid::Clear()
+{
+  mEntries.Clear();
+  mSpaces.Clear();
+  mIndices.Clear();
+}
+
+void InterestGrid::Insert(Replica* replica, ReplicaId space, const Vector3& position)
+{
+  Entry& entry = mEntries.PushBack();
+  entry.mSpace    = space;
+  entry.mCell     = GetCellKey(GetCellCoordinate(position.x), GetCellCoordinate(position.y), GetCellCoordinate(position.z));
+  entry.mReplica  = replica;
+  entry.mPosition = position;
+}
+void InterestGrid::Build()
+{
+  mSpaces.Clear();
+  mIndices.Clear();
+
+  // Sort entries so that each space's entries, and each cell's entries within it, are contiguous
+  Sort(mEntries.All());
+
+  // Map each occupied space to its occupied cells
+  for(uint i = 0; i < mEntries.Size();)
+  {
+    ReplicaId   space      = mEntries[i].mSpace;
+    SpaceCells& spaceCells = mSpaces.FindOrInsert(space);
+    spaceCells.mEntries.first = i;
+
+    // Map each occupied cell to its range of entries
+    while(i < mEntries.Size() && mEntries[i].mSpace == space)
+    {
+      uint start = i;
+      u64  cell  = mEntries[i].mCell;
+      for(; i < mEntries.Size() && mEntries[i].mSpace == space && mEntries[i].mCell == cell; ++i)
+        mIndices.Insert(mEntries[i].mReplica, i);
+
+      spaceCells.mCells.Insert(cell, EntryRange(start, i));
+    }
+
+    spaceCells.mEntries.second = i;
+  }
+}
+
+bool InterestGrid::HasReplica(Replica* replica) const
+{
+  return mIndices.ContainsKey(replica);
+}
+bool InterestGrid::GetPosition(Replica* replica, ReplicaId& space, Vector3& position) const
+{
+  const uint* index = mIndices.FindPointer(replica);
+  if(!index) // Not added?
+    return false;
+
+  // Success
+  space    = mEntries[*index].mSpace;
+  position = mEntries[*index].mPosition;
+  return true;
+}
+
+void InterestGrid::Query(const InterestVolume& volume, float padding, ReplicaArray& result) const
+{
+  // No replicas in the volume's space?
+  const SpaceCells* spaceCells = mSpaces.FindPointer(volume.mSpace);
+  if(!spaceCells)
+    return;
+
+  float   radius = volume.mRadius + padding;
+  Vector3 extent(radius, radius, radius);
+  Vector3 min = volume.mCenter - extent;
+  Vector3 max = volume.mCenter + extent;
+
+  int minX = GetCellCoordinate(min.x), maxX = GetCellCoordinate(max.x);
+  int minY = GetCellCoordinate(min.y), maxY = GetCellCoordinate(max.y);
+  int minZ = GetCellCoordinate(min.z), maxZ = GetCellCoordinate(max.z);
+
+  // Volume overlaps more cells than there are occupied cells?
+  u64 cellCount = u64(maxX - minX + 1) * u64(maxY - minY + 1) * u64(maxZ - minZ + 1);
+  if(cellCount > spaceCells->mCells.Size())
+  {
+    // Testing every entry in the space is cheaper than visiting every cell
+    for(uint i = spaceCells->mEntries.first; i < spaceCells->mEntries.second; ++i)
+      if(volume.Contains(mEntries[i].mSpace, mEntries[i].mPosition, padding))
+        result.PushBack(mEntries[i].mReplica);
+    return;
+  }
+
+  // For all cells overlapping the volume
+  for(int z = minZ; z <= maxZ; ++z)
+  for(int y = minY; y <= maxY; ++y)
+  for(int x = minX; x <= maxX; ++x)
+  {
+    const EntryRange* range = spaceCells->mCells.FindPointer(GetCellKey(x, y, z));
+    if(!range) // Empty cell?
+      continue;
+
+    // Add replicas inside the volume
+    for(uint i = range->first; i < range->second; ++i)
+      if(volume.Contains(mEntries[i].mSpace, mEntries[i].mPosition, padding))
+        result.PushBack(mEntries[i].mReplica);
+  }
+}
+
+uint InterestGrid::GetReplicaCount() const
+{
+  return mEntries.Size();
+}
+
+int InterestGrid::GetCellCoordinate(float value) const
+{
+  // (Clamp to the range of a packed cell coordinate)
+  float cell = Math::Floor(value / mCellSize);
+  cell = Math::Clamp(cell, float(-cCellCoordinateOffset), float(cCellCoordinateOffset - 1));
+  return int(cell);
+}
+u64 InterestGrid::GetCellKey(int x, int y, int z)
+{
+  return ((u64(x + cCellCoordinateOffset) & cCellCoordinateMask))
+       | ((u64(y + cCellCoordinateOffset) & cCellCoordinateMask) << cCellCoordinateBits)
+       | ((u64(z + cCellCoordinateOffset) & cCellCoordinateMask) << (cCellCoordinateBits * 2));
+}
+
+} // namespace Zero
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2017, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+//---------------------------------------------------------------------------------//
+//                                InterestVolume                                   //
+//---------------------------------------------------------------------------------//
+
+/// Interest Volume
+/// A sphere of space a replicator link is interested in
+/// Spatial replicas inside one of a link's interest volumes are relevant to that link
+/// Positions are only comparable within the same space, identified by the ID of the replica that owns it
+class InterestVolume
+{
+public:
+  /// Constructors
+  InterestVolume();
+  InterestVolume(ReplicaId space, const Vector3& center, float radius);
+
+  /// Returns true if the position is in the volume's space and inside the volume, with its radius extended by padding, else false
+  bool Contains(ReplicaId space, const Vector3& position, float padding = 0) const;
+
+  /// Data
+  ReplicaId mSpace;  /// Space the volume is in
+  Vector3   mCenter; /// Volume center
+  float     mRadius; /// Volume radius
+};
+
+/// Typedefs
+typedef Array<InterestVolume> InterestVolumeArray;
+
+//---------------------------------------------------------------------------------//
+//                                 InterestGrid                                    //
+//---------------------------------------------------------------------------------//
+
+/// Interest Grid
+/// Uniform grid spatial index over replica positions, kept separately for every space
+/// Rebuilt every replicator update, so queries are a lookup of the few cells overlapping a volume
+class InterestGrid
+{
+public:
+  /// Constructor
+  InterestGrid();
+
+  /// Controls the size of each grid cell
+  /// (Should be about the size of the smallest interest volume)
+  void SetCellSize(float cellSize = 32);
+  float GetCellSize() const;
+
+  /// Removes all replicas
+  void Clear();
+
+  /// Adds the replica at the specified position in the specified space
+  /// (Build must be called after adding replicas and before querying)
+  void Insert(Replica* replica, ReplicaId space, const Vector3& position);
+  /// Sorts all added replicas into the grid cells of their space
+  void Build();
+
+  /// Returns true if the replica was added, else false
+  bool HasReplica(Replica* replica) const;
+  /// Gets the space and position the replica was added at
+  /// Returns true if successful, else false (the replica was not added)
+  bool GetPosition(Replica* replica, ReplicaId& space, Vector3& position) const;
+
+  /// Adds all replicas in the volume's space inside the volume, with its radius extended by padding, to the result
+  void Query(const InterestVolume& volume, float padding, ReplicaArray& result) const;
+
+  /// Returns the number of replicas added
+  uint GetReplicaCount() const;
+
+private:
+  /// Grid Entry
+  struct Entry
+  {
+    bool operator<(const Entry& rhs) const
+    {
+      if(mSpace != rhs.mSpace)
+        return mSpace < rhs.mSpace;
+      return mCell < rhs.mCell;
+    }
+
+    ReplicaId mSpace;    /// Space the replica is in
+    u64       mCell;     /// Cell key
+    Replica*  mReplica;  /// Replica in the cell
+    Vector3   mPosition; /// Replica position
+  };
+
+  /// Typedefs
+  typedef Pair<uint, uint> EntryRange;
+
+  /// Occupied cells of a single space
+  struct SpaceCells
+  {
+    EntryRange               mEntries; /// Range of entries in the space
+    HashMap<u64, EntryRange> mCells;   /// Occupied cells mapped to their range of entries
+  };
+  typedef ArrayMap<ReplicaId, SpaceCells> SpaceCellsMap;
+
+  /// Returns the cell coordinate containing the value along one axis
+  int GetCellCoordinate(float value) const;
+  /// Returns the key of the specified cell
+  static u64 GetCellKey(int x, int y, int z);
+
+  /// Data
+  float                       mCellSize; /// Grid cell size
+  Array<Entry>                mEntries;  /// Replicas sorted by space and cell (once built)
+  SpaceCellsMap               mSpaces;   /// Occupied spaces mapped to their cells
+  HashMap<Replica*, uint>     mIndices;  /// Replicas mapped to their entry
+};
+
+} // namespace Zero
@@ -1508,10 +1508,10 @@ bool DeserializeQuantizedArithmetic(Variant& newValue, BitStream& bitStream, Rep
   return true;
 }
 
-bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll) const
 {
   // (For the initialization replication phase we want to forcefully serialize all primitive-components to ensure a valid initial value state)
-  bool forceAll = (replicationPhase == ReplicationPhase::Initialization);
+  forceAll |= (replicationPhase == ReplicationPhase::Initialization);
 
   // Get replica property type
   ReplicaPropertyType* replicaPropertyType = GetReplicaPropertyType();
@@ -1569,10 +1569,10 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
     }
   }
 }
-bool ReplicaProperty::Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp)
+bool ReplicaProperty::Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll)
 {
   // (For the initialization replication phase we want to forcefully deserialize all primitive-components to ensure a valid initial value state)
-  bool forceAll = (replicationPhase == ReplicationPhase::Initialization);
+  forceAll |= (replicationPhase == ReplicationPhase::Initialization);
 
   // Get replica property type
   ReplicaPropertyType* replicaPropertyType = GetReplicaPropertyType();
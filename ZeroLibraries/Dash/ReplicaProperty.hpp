@@ -133,11 +133,13 @@ public:
   //
 
   /// Serializes the replica property
+  /// (All primitive members are serialized in full when forced, or for the initialization replication phase)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll = false) const;
   /// Deserializes the replica property
+  /// (All primitive members are deserialized in full when forced, or for the initialization replication phase)
   /// Returns true if successful, else false
-  bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
+  bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceAll = false);
 
   /// Data
   String                 mName;                        /// Replica property name
@@ -27,6 +27,7 @@ void Replicator::ResetSession()
   mCreateContextCacher.Reset();
   mReplicaTypeCacher.Reset();
   mEmplaceContextCacher.Reset();
+  mInterestGrid.Clear();
   // mUserData = nullptr;
   // mFrameFillWarning = 0;
   // mFrameFillSkip = 0;
@@ -574,6 +575,10 @@ void Replicator::ResetConfig()
 {
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetInterestManagement();
+  SetInterestCellSize();
+  SetInterestHysteresis();
+  SetPrioritizeChanges();
 }
 
 void Replicator::SetFrameFillWarning(float frameFillWarning)
@@ -594,6 +599,42 @@ float Replicator::GetFrameFillSkip() const
   return mFrameFillSkip;
 }
 
+void Replicator::SetInterestManagement(bool interestManagement)
+{
+  mInterestManagement = interestManagement;
+}
+bool Replicator::GetInterestManagement() const
+{
+  return mInterestManagement;
+}
+
+void Replicator::SetInterestCellSize(float interestCellSize)
+{
+  mInterestGrid.SetCellSize(interestCellSize);
+}
+float Replicator::GetInterestCellSize() const
+{
+  return mInterestGrid.GetCellSize();
+}
+
+void Replicator::SetInterestHysteresis(float interestHysteresis)
+{
+  mInterestHysteresis = Math::Max(interestHysteresis, 0.0f);
+}
+float Replicator::GetInterestHysteresis() const
+{
+  return mInterestHysteresis;
+}
+
+void Replicator::SetPrioritizeChanges(bool prioritizeChanges)
+{
+  mPrioritizeChanges = prioritizeChanges;
+}
+bool Replicator::GetPrioritizeChanges() const
+{
+  return mPrioritizeChanges;
+}
+
 //
 // Replica Channel Type Management
 //
@@ -1149,6 +1190,173 @@ void Replicator::ReleaseEmplaceId(Replica* replica)
   Assert(replica->GetEmplaceId() == 0);
 }
 
+//
+// Interest Helpers
+//
+
+bool Replicator::IsReplicaRelevant(ReplicatorLink* link, Replica* replica, float padding)
+{
+  // Not using interest management or link is interested in every replica?
+  if(!mInterestManagement || !link->HasInterestVolumes())
+    return true;
+
+  // Only spawned replicas can be destroyed and cloned again remotely
+  // (Emplaced replicas would not be recreated once destroyed remotely)
+  if(!replica->IsSpawned() || replica->GetInterestMode() == InterestMode::Always)
+    return true;
+
+  // Replica has no position?
+  ReplicaId space;
+  Vector3   position;
+  if(!GetReplicaInterestPosition(replica, space, position))
+    return true;
+
+  return link->IsInterestedIn(space, position, padding);
+}
+const ReplicaArray& Replicator::GetRelevantReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& relevantReplicas)
+{
+  // Not using interest management or link is interested in every replica?
+  if(!mInterestManagement || !link->HasInterestVolumes())
+    return replicas;
+
+  // For all replicas
+  bool filtered = false;
+  relevantReplicas.Clear();
+  forRange(Replica* replica, replicas.All())
+  {
+    // Absent replica?
+    if(!replica)
+      continue; // Skip
+
+    // Relevant to link?
+    if(IsReplicaRelevant(link, replica))
+      relevantReplicas.PushBack(replica);
+    else
+      filtered = true;
+  }
+
+  return filtered ? relevantReplicas : replicas;
+}
+const ReplicaArray& Replicator::GetExpectedReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& expectedReplicas)
+{
+  // Replicas may not have been replicated to every link (because of interest management or an explicit route)
+  // For all replicas
+  bool filtered = false;
+  expectedReplicas.Clear();
+  forRange(Replica* replica, replicas.All())
+  {
+    // Absent replica?
+    if(!replica)
+      continue; // Skip
+
+    // Expected remotely by link?
+    if(link->HasReplica(replica))
+      expectedReplicas.PushBack(replica);
+    else
+      filtered = true;
+  }
+
+  return filtered ? expectedReplicas : replicas;
+}
+
+void Replicator::UpdateInterest(const PeerLinkSet& links, TimeMs now)
+{
+  // Not using interest management?
+  if(!mInterestManagement || GetRole() != Role::Server)
+    return;
+
+  ProfileScopeTree("Interest", "Replication", Color::Orange);
+
+  //
+  // Build Spatial Index
+  //
+
+  // For all live replicas
+  mInterestGrid.Clear();
+  forRange(Replica* replica, mReplicaSet.All())
+  {
+    // Not interest managed?
+    if(!replica->IsSpawned() || replica->GetInterestMode() == InterestMode::Always)
+      continue; // Skip
+
+    // Has a position?
+    ReplicaId space;
+    Vector3   position;
+    if(GetReplicaInterestPosition(replica, space, position))
+      mInterestGrid.Insert(replica, space, position);
+  }
+  mInterestGrid.Build();
+
+  //
+  // Update Links
+  //
+
+  ReplicaArray relevantReplicas;
+  ReplicaArray cloneReplicas;
+  ReplicaArray destroyReplicas;
+
+  // For all links
+  forRange(PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // Link is interested in every replica?
+    if(!replicatorLink->HasInterestVolumes())
+      continue; // Skip
+
+    // For all replicas expected remotely
+    destroyReplicas.Clear();
+    forRange(Replica* replica, replicatorLink->GetReplicas().All())
+    {
+      // Not interest managed?
+      ReplicaId space;
+      Vector3   position;
+      if(!mInterestGrid.GetPosition(replica, space, position))
+        continue; // Skip
+
+      // Left all interest volumes in its space (past the hysteresis distance)?
+      if(!replicatorLink->IsInterestedIn(space, position, mInterestHysteresis))
+        destroyReplicas.PushBack(replica);
+    }
+
+    // Replicas no longer relevant?
+    // (The destroy command releases their remote copies, locally they stay live)
+    if(!destroyReplicas.Empty())
+      replicatorLink->SendDestroy(destroyReplicas, now);
+
+    // Skipping replication on this link because of bandwidth?
+    // (Replicas that became relevant are cloned once the link has room for them)
+    if(replicatorLink->ShouldSkipChangeReplication())
+      continue; // Skip
+
+    // Find replicas inside the link's interest volumes
+    relevantReplicas.Clear();
+    forRange(const InterestVolume& interestVolume, replicatorLink->GetInterestVolumes().All())
+      mInterestGrid.Query(interestVolume, 0, relevantReplicas);
+
+    // (Interest volumes may overlap)
+    Sort(relevantReplicas.All());
+
+    // For all relevant replicas
+    cloneReplicas.Clear();
+    for(uint i = 0; i < relevantReplicas.Size(); ++i)
+    {
+      Replica* replica = relevantReplicas[i];
+
+      // Duplicate or already expected remotely?
+      if((i != 0 && relevantReplicas[i - 1] == replica) || replicatorLink->HasReplica(replica))
+        continue; // Skip
+
+      cloneReplicas.PushBack(replica);
+    }
+
+    // Replicas became relevant?
+    if(!cloneReplicas.Empty())
+      replicatorLink->SendClone(cloneReplicas, GetInitializationTimestamp(cloneReplicas));
+  }
+}
+
 //
 // Replication Helpers
 //
@@ -1458,13 +1666,19 @@ bool Replicator::RouteSpawn(const ReplicaArray& replicas, const Route& route, Ti
   PeerLinkSet links = GetLinks(route);
 
   // For all links in route
+  ReplicaArray relevantReplicas;
   forRange(PeerLink* link, links.All())
   {
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Get replicas relevant to this link
+    const ReplicaArray& linkReplicas = GetRelevantReplicas(replicatorLink, replicas, relevantReplicas);
+    if(linkReplicas.Empty() && !replicas.Empty()) // None?
+      continue; // Skip
+
     // Send spawn command
-    replicatorLink->SendSpawn(replicas, timestamp);
+    replicatorLink->SendSpawn(linkReplicas, timestamp);
   }
 
   // Success
@@ -1550,13 +1764,19 @@ bool Replicator::RouteClone(const ReplicaArray& replicas, const Route& route, Ti
   PeerLinkSet links = GetLinks(route);
 
   // For all links in route
+  ReplicaArray relevantReplicas;
   forRange(PeerLink* link, links.All())
   {
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Get replicas relevant to this link
+    const ReplicaArray& linkReplicas = GetRelevantReplicas(replicatorLink, replicas, relevantReplicas);
+    if(linkReplicas.Empty() && !replicas.Empty()) // None?
+      continue; // Skip
+
     // Send clone command
-    replicatorLink->SendClone(replicas, timestamp);
+    replicatorLink->SendClone(linkReplicas, timestamp);
   }
 
   // Success
@@ -1660,13 +1880,19 @@ bool Replicator::RouteForget(const ReplicaArray& replicas, const Route& route, T
   PeerLinkSet links = GetLinks(route);
 
   // For all links in route
+  ReplicaArray expectedReplicas;
   forRange(PeerLink* link, links.All())
   {
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Get replicas this link has
+    const ReplicaArray& linkReplicas = GetExpectedReplicas(replicatorLink, replicas, expectedReplicas);
+    if(linkReplicas.Empty() && !replicas.Empty()) // None?
+      continue; // Skip
+
     // Send forget command
-    replicatorLink->SendForget(replicas, timestamp);
+    replicatorLink->SendForget(linkReplicas, timestamp);
   }
 
   // Success
@@ -1769,13 +1995,19 @@ bool Replicator::RouteDestroy(const ReplicaArray& replicas, const Route& route,
   PeerLinkSet links = GetLinks(route);
 
   // For all links in route
+  ReplicaArray expectedReplicas;
   forRange(PeerLink* link, links.All())
   {
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Get replicas this link has
+    const ReplicaArray& linkReplicas = GetExpectedReplicas(replicatorLink, replicas, expectedReplicas);
+    if(linkReplicas.Empty() && !replicas.Empty()) // None?
+      continue; // Skip
+
     // Send destroy command
-    replicatorLink->SendDestroy(replicas, timestamp);
+    replicatorLink->SendDestroy(linkReplicas, timestamp);
   }
 
   // Success
@@ -1805,19 +2037,36 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
       message.SetTimestamp(timestamp);
     }
 
+    // Share the serialized change between all links
+    // (Each link's copy of the message references the same data instead of copying it)
+    // (Delta compressed changes are rewritten per link, so they read the data instead)
+    if(!replicaChannel->GetReplicaChannelType()->GetDeltaCompression())
+      message.ShareData();
+
     // For all replicator links in route
     forRange(PeerLink* link, links.All())
     {
       // Get replicator link
       ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+      // Doesn't have replica remotely?
+      if(!replicatorLink->HasReplica(replica))
+        continue; // Skip link
+
+      // Prioritizing changes?
+      if(mPrioritizeChanges)
+      {
+        // Schedule replica channel change (sent at the end of the update, by priority)
+        replicatorLink->ScheduleChange(replicaChannel, message);
+        continue;
+      }
+
       // Should skip change replication?
       if(replicatorLink->ShouldSkipChangeReplication())
         continue; // Skip link
 
-      // Has replica remotely?
-      if(replicatorLink->HasReplica(replica))
-        replicatorLink->SendChange(replicaChannel, message); // Send replica channel change
+      // Send replica channel change
+      replicatorLink->SendChange(replicaChannel, message);
     }
   }
 
@@ -1829,8 +2078,11 @@ bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& messag
   // Serialize replica channel change
   BitStream& bitStream = message.GetData();
 
+  // (Delta compressed changes are a full snapshot of the replica channel, compressed per link against that link's acknowledged baseline)
+  bool forceAll = replicaChannel->GetReplicaChannelType()->GetDeltaCompression();
+
   // Write replica channel
-  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp);
+  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp, forceAll);
   if(!result) // Unable?
   {
     Assert(false);
@@ -1946,6 +2198,9 @@ void Replicator::OnUpdate()
     replicatorLink->UpdateStart(now);
   }
 
+  // Update which replicas each link has before replicating changes
+  UpdateInterest(links, now);
+
   //
   // Update
   //
@@ -1974,6 +2229,9 @@ void Replicator::OnUpdate()
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Send the highest priority scheduled changes (if any)
+    replicatorLink->SendScheduledChanges(now);
+
     // Handle update end
     replicatorLink->UpdateEnd(now);
   }
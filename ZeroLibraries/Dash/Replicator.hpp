@@ -197,6 +197,28 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls whether or not spawned replicas are only replicated to the links they are relevant to
+  /// Relevant replicas are cloned to a link as they enter one of its interest volumes and destroyed remotely as they leave
+  /// (See Replica::SetInterestMode and ReplicatorLink::AddInterestVolume)
+  void SetInterestManagement(bool interestManagement = false);
+  bool GetInterestManagement() const;
+
+  /// [Server] Controls the cell size of the spatial index used for interest management
+  void SetInterestCellSize(float interestCellSize = 32);
+  float GetInterestCellSize() const;
+
+  /// [Server] Controls how far outside of all of a link's interest volumes a replica must be before it's destroyed on that link
+  /// (Keeps replicas moving along the edge of an interest volume from being repeatedly cloned and destroyed)
+  void SetInterestHysteresis(float interestHysteresis = 8);
+  float GetInterestHysteresis() const;
+
+  /// Controls whether or not replica channel changes are scheduled by priority instead of sent immediately
+  /// Every frame, waiting changes accumulate priority (see ReplicaChannelType::SetPriority, scaled down by distance from the link's interest volumes)
+  /// and the highest priority changes are sent until the link's outgoing frame fill skip threshold is reached
+  /// (Changes that don't fit keep accumulating priority until they are sent, instead of being skipped)
+  void SetPrioritizeChanges(bool prioritizeChanges = false);
+  bool GetPrioritizeChanges() const;
+
   //
   // Replica Channel Type Management
   //
@@ -266,6 +288,11 @@ public:
   /// Returns true if successful, else false
   virtual bool ReleaseReplicas(const ReplicaArray& replicas) = 0;
 
+  /// Gets the position of the replica used for interest management, and the space that position is in
+  /// (The space is identified by the ID of the replica that owns it, positions in different spaces are never compared)
+  /// Returns true if successful, else false (replicas without a position are always relevant)
+  virtual bool GetReplicaInterestPosition(Replica* replica, ReplicaId& space, Vector3& position) { return false; }
+
   /// Called before a replica is made valid (registered with the replicator)
   void ValidReplica(Replica* replica);
   virtual void OnValidReplica(Replica* replica) {}
@@ -379,6 +406,22 @@ public:
   /// Releases an emplace ID from the specified replica
   void ReleaseEmplaceId(Replica* replica);
 
+  //
+  // Interest Helpers
+  //
+
+  /// Returns true if the replica is relevant to the link, considering interest volumes extended by padding, else false
+  bool IsReplicaRelevant(ReplicatorLink* link, Replica* replica, float padding = 0);
+  /// Returns the replicas that are relevant to the link (the same array if they all are)
+  /// Absent replicas are removed if any replicas are filtered
+  const ReplicaArray& GetRelevantReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& relevantReplicas);
+  /// Returns the replicas that are expected remotely by the link (the same array if they all are)
+  /// Absent replicas are removed if any replicas are filtered
+  const ReplicaArray& GetExpectedReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& expectedReplicas);
+
+  /// [Server] Clones replicas on links they became relevant to and destroys replicas on links they are no longer relevant to
+  void UpdateInterest(const PeerLinkSet& links, TimeMs now);
+
   //
   // Replication Helpers
   //
@@ -707,6 +750,10 @@ public:
   void*                  mUserData;             /// Optional user data
   float                  mFrameFillWarning;     /// Controls when the user will be warned of their current frame's outgoing bandwidth utilization ratio on any given link
   float                  mFrameFillSkip;        /// Controls when to skip change replication for the current frame because of remaining outgoing bandwidth utilization ratio on any given link
+  bool                   mInterestManagement;   /// Only replicate spawned replicas to the links they are relevant to?
+  float                  mInterestHysteresis;   /// Distance outside of all interest volumes before a replica is no longer relevant
+  InterestGrid           mInterestGrid;         /// Spatial index of interest managed replicas (rebuilt every update)
+  bool                   mPrioritizeChanges;    /// Schedule replica channel changes by priority?
   ReplicaChannelTypeSet  mReplicaChannelTypes;  /// Replica channel type set
   ReplicaPropertyTypeSet mReplicaPropertyTypes; /// Replica property type set
 
@@ -9,6 +9,26 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                               ScheduledChange                                   //
+//---------------------------------------------------------------------------------//
+
+ScheduledChange::ScheduledChange()
+  : mReplicaChannel(nullptr),
+    mPriority(0),
+    mMessages()
+{
+}
+
+/// Orders scheduled changes by descending priority
+struct ScheduledChangePriorityPolicy
+{
+  bool operator()(const ScheduledChange* lhs, const ScheduledChange* rhs) const
+  {
+    return lhs->mPriority > rhs->mPriority;
+  }
+};
+
 //---------------------------------------------------------------------------------//
 //                               ReplicatorLink                                    //
 //---------------------------------------------------------------------------------//
@@ -28,7 +48,12 @@ ReplicatorLink::ReplicatorLink(Replicator* replicator)
     mLastConnectResponseData(),
     mShouldSkipChangeReplication(false),
     mLastFrameFillSkipNotificationTime(0),
-    mLastFrameFillWarningNotificationTime(0)
+    mLastFrameFillWarningNotificationTime(0),
+    mInterestVolumes(),
+    mScheduledChanges(),
+    mOutBaselines(),
+    mInBaselines(),
+    mBaselineReceipts()
 {
 }
 
@@ -187,6 +212,199 @@ bool ReplicatorLink::ShouldSkipChangeReplication() const
   return mShouldSkipChangeReplication;
 }
 
+//
+// Interest Management
+//
+
+void ReplicatorLink::AddInterestVolume(const InterestVolume& interestVolume)
+{
+  mInterestVolumes.PushBack(interestVolume);
+}
+void ReplicatorLink::ClearInterestVolumes()
+{
+  mInterestVolumes.Clear();
+}
+const InterestVolumeArray& ReplicatorLink::GetInterestVolumes() const
+{
+  return mInterestVolumes;
+}
+bool ReplicatorLink::HasInterestVolumes() const
+{
+  return !mInterestVolumes.Empty();
+}
+
+bool ReplicatorLink::IsInterestedIn(ReplicaId space, const Vector3& position, float padding) const
+{
+  // For all interest volumes
+  forRange(const InterestVolume& interestVolume, mInterestVolumes.All())
+  {
+    // Position inside volume?
+    if(interestVolume.Contains(space, position, padding))
+      return true;
+  }
+
+  return false;
+}
+
+//
+// Change Scheduling
+//
+
+/// Returns true if every change of the replica channel contains the value of every replica property, else false
+/// (Otherwise a change only contains the properties, or primitive members, that changed since the last one)
+bool ChangesContainFullState(ReplicaChannel* replicaChannel)
+{
+  // Delta compressed changes are always serialized as a full snapshot
+  ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
+  if(replicaChannelType->GetDeltaCompression())
+    return true;
+
+  // Only changed replica properties are serialized?
+  if(replicaChannelType->GetSerializationMode() == SerializationMode::Changed
+  && replicaChannel->GetReplicaProperties().Size() != 1)
+    return false;
+
+  // For all replica properties
+  forRange(ReplicaProperty* replicaProperty, replicaChannel->GetReplicaProperties().All())
+  {
+    // Only changed primitive members are serialized?
+    if(replicaProperty->GetReplicaPropertyType()->GetSerializationMode() == SerializationMode::Changed)
+      return false;
+  }
+
+  return true;
+}
+
+void ReplicatorLink::ScheduleChange(ReplicaChannel* replicaChannel, const Message& message)
+{
+  Assert(HasReplica(replicaChannel->GetReplica()));
+
+  // Get or add scheduled change
+  ScheduledChange& scheduledChange = mScheduledChanges[replicaChannel];
+  scheduledChange.mReplicaChannel = replicaChannel;
+
+  //    Unreliable change?
+  // AND Contains the full replica channel state?
+  // (A newer unreliable change supersedes an older one, the older one was never guaranteed to arrive anyway)
+  // (Partial changes are kept, dropping one would lose the properties only it contains)
+  if(replicaChannel->GetReplicaChannelType()->GetReliabilityMode() == ReliabilityMode::Unreliable
+  && ChangesContainFullState(replicaChannel))
+    scheduledChange.mMessages.Clear();
+
+  // Too many change messages waiting?
+  // (A frequently changing replica channel that keeps losing to higher priority changes would otherwise queue without bound)
+  else if(scheduledChange.mMessages.Size() >= cMaxScheduledChangeMessages)
+  {
+    // Send waiting change messages now (in order)
+    forRange(Message& waitingMessage, scheduledChange.mMessages.All())
+      SendChange(replicaChannel, waitingMessage);
+    scheduledChange.mMessages.Clear();
+  }
+
+  // Add change message
+  scheduledChange.mMessages.PushBack(message);
+}
+void ReplicatorLink::UnscheduleChanges(ReplicaChannel* replicaChannel)
+{
+  mScheduledChanges.Erase(replicaChannel);
+}
+
+void ReplicatorLink::SendScheduledChanges(TimeMs now)
+{
+  // No scheduled changes?
+  if(mScheduledChanges.Empty())
+    return;
+
+  // Get replicator
+  Replicator* replicator = GetReplicator();
+
+  //
+  // Accumulate Priority
+  //
+
+  Array<ScheduledChange*> scheduledChanges;
+  scheduledChanges.Reserve(mScheduledChanges.Size());
+
+  // For all scheduled changes
+  forRange(ScheduledChanges::value_type& entry, mScheduledChanges.All())
+  {
+    ScheduledChange& scheduledChange = entry.second;
+
+    // Start with the configured replica channel type priority
+    float priority = scheduledChange.mReplicaChannel->GetReplicaChannelType()->GetPriority();
+
+    // Replica has a position and link has interest volumes?
+    ReplicaId space;
+    Vector3   position;
+    if(HasInterestVolumes()
+    && replicator->GetReplicaInterestPosition(scheduledChange.mReplicaChannel->GetReplica(), space, position))
+    {
+      // Find distance to the nearest interest volume center in the same space
+      bool  found      = false;
+      float distanceSq = Math::PositiveMax();
+      forRange(const InterestVolume& interestVolume, mInterestVolumes.All())
+      {
+        // Different space?
+        if(interestVolume.mSpace != space)
+          continue; // Skip
+
+        found      = true;
+        distanceSq = Math::Min(distanceSq, Math::LengthSq(position - interestVolume.mCenter));
+      }
+
+      // Scale priority down with distance (measured in interest grid cells)
+      if(found)
+        priority /= (1.0f + Math::Sqrt(distanceSq) / replicator->GetInterestCellSize());
+    }
+
+    // Accumulate priority
+    // (Changes not sent this frame continue accumulating, so they are eventually sent)
+    scheduledChange.mPriority += priority;
+    scheduledChanges.PushBack(&scheduledChange);
+  }
+
+  // Highest priority first
+  Sort(scheduledChanges.All(), ScheduledChangePriorityPolicy());
+
+  //
+  // Send Changes
+  //
+
+  // Determine this frame's remaining outgoing bandwidth
+  // (Uses the same frame fill skip threshold as unscheduled change replication)
+  PeerLink* link       = GetLink();
+  double    frameLimit = double(link->GetOutgoingFrameCapacity()) * double(replicator->GetFrameFillSkip());
+  double    frameBits  = double(link->GetOutgoingFrameSize());
+
+  // For all scheduled changes (highest priority first)
+  Array<ReplicaChannel*> sentReplicaChannels;
+  forRange(ScheduledChange* scheduledChange, scheduledChanges.All())
+  {
+    // Frame's outgoing bandwidth used?
+    // (The last change sent may overrun it, the overrun is deducted from the next frame)
+    if(frameBits >= frameLimit)
+      break; // Stop
+
+    // Send change messages
+    forRange(Message& message, scheduledChange->mMessages.All())
+    {
+      frameBits += double(message.GetTotalBits());
+      SendChange(scheduledChange->mReplicaChannel, message);
+    }
+
+    sentReplicaChannels.PushBack(scheduledChange->mReplicaChannel);
+  }
+
+  // Remove sent changes
+  forRange(ReplicaChannel* replicaChannel, sentReplicaChannels.All())
+    mScheduledChanges.Erase(replicaChannel);
+}
+
+size_t ReplicatorLink::GetScheduledChangeCount() const
+{
+  return mScheduledChanges.Size();
+}
+
 //
 // Internal
 //
@@ -1141,7 +1359,7 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
   Assert(message.HasTimestamp());
 
   // Deserialize replica channel change
-  const BitStream& bitStream = message.GetData();
+  const BitStream* bitStream = &message.GetData();
 
   // Get replica channel
   ReplicaChannel* replicaChannel = GetIncomingReplicaChannel(message.GetChannelId());
@@ -1155,6 +1373,29 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
   ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
   ReturnIf(!replicaChannelType, false, "ReplicaChannelType was null");
 
+  // Delta compressed change?
+  // (Decoded before any change is ignored, the sender expects every acknowledged change to be usable as a baseline)
+  BitStream snapshotBitStream;
+  bool deltaCompression = replicaChannelType->GetDeltaCompression();
+  if(deltaCompression)
+  {
+    // Read snapshot
+    ReplicaSnapshot snapshot;
+    InReplicaBaselines& baselines = mInBaselines[replicaChannel];
+    if(!baselines.Read(*bitStream, snapshot)) // Unable?
+    {
+      // (The baseline this change was compressed against is no longer remembered, but the transport still acknowledges
+      // the message, so the sender would go on to use this change as its baseline as well, ask it to stop using baselines)
+      if(baselines.ShouldRequestReset())
+        SendBaselineReset(message.GetChannelId());
+      return false;
+    }
+
+    // Deserialize from the snapshot instead
+    snapshotBitStream.WriteBytes(snapshot.Data(), snapshot.Size());
+    bitStream = &snapshotBitStream;
+  }
+
   // Get replica
   Replica*              replica = replicaChannel->GetReplica();
   ReturnIf(!replica, false, "Replica was null");
@@ -1181,7 +1422,7 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
   }
 
   // Read replica channel
-  bool result = replicaChannel->Deserialize(bitStream, ReplicationPhase::Change, timestamp);
+  bool result = replicaChannel->Deserialize(*bitStream, ReplicationPhase::Change, timestamp, deltaCompression);
   if(!result) // Unable?
   {
     //Assert(false);
@@ -1240,6 +1481,10 @@ bool ReplicatorLink::SendChange(ReplicaChannel* replicaChannel, Message& message
     return false;
   }
 
+  // Delta compressed change?
+  if(replicaChannelType->GetDeltaCompression())
+    return SendDeltaChange(replicaChannel, message, channelId);
+
   // Send change message
   Status status;
   LinkPlugin::Send(status, message, (replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable), channelId, false);
@@ -1249,6 +1494,35 @@ bool ReplicatorLink::SendChange(ReplicaChannel* replicaChannel, Message& message
   // Success
   return true;
 }
+bool ReplicatorLink::SendDeltaChange(ReplicaChannel* replicaChannel, const Message& message, MessageChannelId channelId)
+{
+  // Get replica channel type
+  ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
+
+  // Get snapshot
+  // (The change message contains all replica property values, serialized in full)
+  const BitStream& bitStream = message.GetData();
+  ReplicaSnapshot snapshot;
+  snapshot.Assign(bitStream.GetData(), bitStream.GetData() + bitStream.GetBytesWritten());
+
+  // Write snapshot, delta compressed against this link's acknowledged baseline
+  OutReplicaBaselines& baselines = mOutBaselines[replicaChannel];
+  Message deltaMessage(message, true);
+  BaselineId baselineId = baselines.Write(deltaMessage.GetData(), snapshot);
+
+  // Send change message
+  Status status;
+  MessageReceiptId receiptId = LinkPlugin::Send(status, ZeroMove(deltaMessage), (replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable), channelId, true);
+  if(status.Failed()) // Unable?
+    return false;
+
+  // Remember snapshot until receipted
+  baselines.AddSent(receiptId, baselineId, snapshot);
+  mBaselineReceipts.Insert(receiptId, replicaChannel);
+
+  // Success
+  return true;
+}
 bool ReplicatorLink::ReceiveChange(const Message& message)
 {
   Assert(message.GetType() == ReplicatorMessageType::Change);
@@ -1260,6 +1534,53 @@ bool ReplicatorLink::ReceiveChange(const Message& message)
   return DeserializeChange(message, timestamp);
 }
 
+bool ReplicatorLink::SendBaselineReset(MessageChannelId channelId)
+{
+  // Serialize baseline reset request
+  // (Our incoming message channel ID is their outgoing message channel ID)
+  Message message(ReplicatorMessageType::BaselineReset);
+  message.GetData().Write(channelId);
+
+  // Send baseline reset message
+  Assert(GetCommandChannelId());
+  Status status;
+  LinkPlugin::Send(status, ZeroMove(message), true, GetCommandChannelId());
+  if(status.Failed()) // Unable?
+    return false;
+
+  // Success
+  return true;
+}
+bool ReplicatorLink::ReceiveBaselineReset(const Message& message)
+{
+  Assert(message.GetType() == ReplicatorMessageType::BaselineReset);
+
+  // Read outgoing message channel ID
+  MessageChannelId channelId;
+  if(!message.GetData().Read(channelId)) // Unable?
+  {
+    Assert(false);
+    return false;
+  }
+
+  // Find outgoing replica channel
+  forRange(OutReplicaChannels::value_type& entry, mOutReplicaChannels.All())
+  {
+    if(entry.second != channelId)
+      continue;
+
+    // Find outgoing baselines
+    // (The replica channel may have stopped using delta compression since)
+    OutReplicaBaselines* baselines = mOutBaselines.FindPointer(entry.first);
+    if(baselines)
+      baselines->Reset();
+    return true;
+  }
+
+  // (The replica channel may have been closed since)
+  return true;
+}
+
 bool ReplicatorLink::SendInterrupt(Message& message)
 {
   Assert(GetReplicator()->GetRole() == Role::Server);
@@ -1450,6 +1771,12 @@ MessageChannelId ReplicatorLink::OpenOutgoingReplicaChannel(ReplicaChannel* repl
 }
 void ReplicatorLink::CloseOutgoingReplicaChannel(ReplicaChannel* replicaChannel)
 {
+  // Remove scheduled changes (if any)
+  UnscheduleChanges(replicaChannel);
+
+  // Remove outgoing baselines (if any)
+  mOutBaselines.Erase(replicaChannel);
+
   // Find outgoing message channel
   OutReplicaChannels::iterator iter = mOutReplicaChannels.FindIterator(replicaChannel);
   if(iter == mOutReplicaChannels.End()) // Unable?
@@ -1496,6 +1823,9 @@ bool ReplicatorLink::SetIncomingReplicaChannel(MessageChannelId channelId, Repli
 }
 void ReplicatorLink::ClearIncomingReplicaChannel(ReplicaChannel* replicaChannel)
 {
+  // Remove incoming baselines (if any)
+  mInBaselines.Erase(replicaChannel);
+
   // Find incoming message channel (in flipped map)
   InReplicaChannelsFlipped::iterator iter = mInReplicaChannelsFlipped.FindIterator(replicaChannel);
   if(iter == mInReplicaChannelsFlipped.End()) // Unable?
@@ -1839,6 +2169,10 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
       ReceiveReverseReplicaChannels(message);
       break;
 
+    case ReplicatorMessageType::BaselineReset:
+      ReceiveBaselineReset(message);
+      break;
+
     default:
       Assert(false);
       break;
@@ -1886,6 +2220,10 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
       ReceiveChange(message);
       break;
 
+    case ReplicatorMessageType::BaselineReset:
+      ReceiveBaselineReset(message);
+      break;
+
     case ReplicatorMessageType::Interrupt:
       continueProcessingCustomMessages = false;
       break;
@@ -1896,5 +2234,26 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
     }
   }
 }
+void ReplicatorLink::OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt)
+{
+  // Find delta compressed change receipt
+  MessageReceiptId receiptId = message->GetReceiptID();
+  BaselineReceiptMap::iterator iter = mBaselineReceipts.FindIterator(receiptId);
+  if(iter == mBaselineReceipts.End()) // Unable?
+    return;
+
+  // Get replica channel
+  ReplicaChannel* replicaChannel = iter->second;
+  mBaselineReceipts.Erase(iter);
+
+  // Find outgoing baselines
+  // (The replica channel may have been closed since)
+  OutReplicaBaselines* baselines = mOutBaselines.FindPointer(replicaChannel);
+  if(!baselines) // Unable?
+    return;
+
+  // Handle receipt
+  baselines->OnReceipt(receiptId, receipt);
+}
 
 } // namespace Zero
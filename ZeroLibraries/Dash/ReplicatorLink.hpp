@@ -9,6 +9,35 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                               ScheduledChange                                   //
+//---------------------------------------------------------------------------------//
+
+/// Maximum number of change messages a single replica channel may have waiting to be sent
+/// (Past this the waiting messages are sent right away, regardless of priority)
+static const size_t cMaxScheduledChangeMessages = 16;
+
+/// Scheduled Change
+/// Replica channel changes waiting to be sent on a replicator link
+/// Accumulates priority every update until sent
+class ScheduledChange
+{
+public:
+  /// Constructor
+  ScheduledChange();
+
+  /// Data
+  ReplicaChannel* mReplicaChannel; /// Changed replica channel
+  float           mPriority;       /// Accumulated priority
+  Array<Message>  mMessages;       /// Change messages (in the order they were routed)
+};
+
+/// Typedefs
+typedef HashMap<ReplicaChannel*, ScheduledChange> ScheduledChanges;
+typedef HashMap<ReplicaChannel*, OutReplicaBaselines> OutBaselineMap;
+typedef HashMap<ReplicaChannel*, InReplicaBaselines> InBaselineMap;
+typedef HashMap<MessageReceiptId, ReplicaChannel*> BaselineReceiptMap;
+
 //---------------------------------------------------------------------------------//
 //                               ReplicatorLink                                    //
 //---------------------------------------------------------------------------------//
@@ -81,6 +110,42 @@ public:
   /// Returns true if change replication should be skipped for this link
   bool ShouldSkipChangeReplication() const;
 
+  //
+  // Interest Management
+  //
+
+  /// [Server] Adds an interest volume
+  /// When the replicator uses interest management, spatial replicas are only relevant to this link while inside one of its interest volumes
+  void AddInterestVolume(const InterestVolume& interestVolume);
+  /// [Server] Removes all interest volumes
+  /// (A link without interest volumes is interested in every replica)
+  void ClearInterestVolumes();
+  /// Returns all interest volumes
+  const InterestVolumeArray& GetInterestVolumes() const;
+  /// Returns true if the link has any interest volumes, else false
+  bool HasInterestVolumes() const;
+
+  /// Returns true if the position is inside one of the link's interest volumes in the same space, with their radius extended by padding, else false
+  bool IsInterestedIn(ReplicaId space, const Vector3& position, float padding = 0) const;
+
+  //
+  // Change Scheduling
+  //
+
+  /// Schedules a replica channel change to be sent once the link has bandwidth available for it
+  /// Unreliable changes containing the full replica channel state replace any change of the same replica channel still waiting to be sent,
+  /// all other changes are kept in order (and sent right away once cMaxScheduledChangeMessages are waiting)
+  void ScheduleChange(ReplicaChannel* replicaChannel, const Message& message);
+  /// Removes all scheduled changes of the replica channel
+  void UnscheduleChanges(ReplicaChannel* replicaChannel);
+
+  /// Accumulates the priority of every scheduled change, then sends the highest priority changes until this frame's outgoing bandwidth is used
+  /// Changes that are not sent keep their priority and continue accumulating
+  void SendScheduledChanges(TimeMs now);
+
+  /// Returns the number of replica channels with changes waiting to be sent
+  size_t GetScheduledChangeCount() const;
+
   //
   // Internal
   //
@@ -225,10 +290,20 @@ public:
   /// Sends a replica channel change
   /// Returns true if successful, else false
   bool SendChange(ReplicaChannel* replicaChannel, Message& message);
+  /// Sends a replica channel change, delta compressed against the last change this link acknowledged
+  /// Returns true if successful, else false
+  bool SendDeltaChange(ReplicaChannel* replicaChannel, const Message& message, MessageChannelId channelId);
   /// Receives a replica channel change
   /// Returns true if successful, else false
   bool ReceiveChange(const Message& message);
 
+  /// Requests that the sender of a delta compressed replica channel stop using its baseline
+  /// Returns true if successful, else false
+  bool SendBaselineReset(MessageChannelId channelId);
+  /// Receives a baseline reset request for one of our outgoing delta compressed replica channels
+  /// Returns true if successful, else false
+  bool ReceiveBaselineReset(const Message& message);
+
   /// [Server] Sends an interrupt command
   /// Returns true if successful, else false
   bool SendInterrupt(Message& message);
@@ -299,6 +374,8 @@ public:
 
   /// Called after a plugin message is received
   void OnPluginMessageReceive(MoveReference<Message> message, bool& continueProcessingCustomMessages) override;
+  /// Called after a plugin message is receipted
+  void OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt) override;
 
   /// Data
   Replicator* const        mReplicator;                           /// Operating replicator
@@ -315,6 +392,11 @@ public:
   bool                     mShouldSkipChangeReplication;          /// Should skip change replication? (Updated at the start of every frame)
   TimeMs                   mLastFrameFillSkipNotificationTime;    /// Last frame fill skip notification time
   TimeMs                   mLastFrameFillWarningNotificationTime; /// Last frame fill warning notification time
+  InterestVolumeArray      mInterestVolumes;                      /// Interest volumes
+  ScheduledChanges         mScheduledChanges;                     /// Replica channel changes waiting to be sent
+  OutBaselineMap           mOutBaselines;                         /// Outgoing delta compressed replica channel baselines
+  InBaselineMap            mInBaselines;                          /// Incoming delta compressed replica channel baselines
+  BaselineReceiptMap       mBaselineReceipts;                     /// Delta compressed change receipts awaited (receipt ID to replica channel)
 
 private:
   /// No copy constructor
@@ -29,6 +29,143 @@ UseEventMemoryPool(EventDispatchList);
 UseEventMemoryPool(EventReceiver);
 UseEventMemoryPool(EventDispatcher);
 
+//------------------------------------------------------------------- Event Name
+// Names are interned from any thread (including static initialization of the
+// DefineEvent constants) but are looked up on every string keyed dispatch, so
+// lookups never lock. The table is open addressed and insert only, a slot is
+// published by storing its id last, and a table that gets too full is copied
+// into a larger one that replaces it atomically. Replaced tables are never
+// freed since a lookup on another thread may still be reading them.
+const size_t cInitialEventNameCapacity = 2048;
+
+struct EventNameSlot
+{
+  EventNameSlot() : mHash(0), mId(cInvalidEventNameId) {}
+
+  size_t mHash;
+  String mName;
+  // Set last, once a slot has an id it never changes
+  Atomic<EventNameId> mId;
+};
+
+struct EventNameSlots
+{
+  EventNameSlots(size_t capacity)
+    : mCapacity(capacity),
+      mSlots(new EventNameSlot[capacity])
+  {
+  }
+
+  // Always a power of two
+  size_t mCapacity;
+  EventNameSlot* mSlots;
+};
+
+struct EventNameTable
+{
+  EventNameTable()
+    : mCount(0)
+  {
+    mSlots = new EventNameSlots(cInitialEventNameCapacity);
+  }
+
+  EventNameSlots* GetSlots()
+  {
+    return (EventNameSlots*)AtomicLoad(&mSlots);
+  }
+
+  // Only taken to intern a new name
+  ThreadLock mLock;
+  void* volatile mSlots;
+  // Also the last id handed out (id 0 is reserved for names that were never interned)
+  size_t mCount;
+};
+
+EventNameTable& GetEventNameTable()
+{
+  static EventNameTable table;
+  return table;
+}
+
+// Returns the id of the name in the slots, else cInvalidEventNameId and the index of
+// the empty slot the name would go in (the slots are never full so one is always found)
+EventNameId FindEventNameSlot(EventNameSlots* slots, StringParam eventId, size_t hash, size_t& emptyIndex)
+{
+  size_t mask = slots->mCapacity - 1;
+  for(size_t i = hash & mask; ; i = (i + 1) & mask)
+  {
+    EventNameSlot& slot = slots->mSlots[i];
+    EventNameId id = slot.mId;
+    if(id == cInvalidEventNameId)
+    {
+      emptyIndex = i;
+      return cInvalidEventNameId;
+    }
+
+    if(slot.mHash == hash && slot.mName == eventId)
+      return id;
+  }
+}
+
+EventNameId InternEventName(StringParam eventId)
+{
+  EventNameTable& table = GetEventNameTable();
+  size_t hash = eventId.Hash();
+
+  // Almost every name is already interned
+  size_t emptyIndex = 0;
+  EventNameId id = FindEventNameSlot(table.GetSlots(), eventId, hash, emptyIndex);
+  if(id != cInvalidEventNameId)
+    return id;
+
+  table.mLock.Lock();
+
+  // Another thread may have interned it before we took the lock
+  EventNameSlots* slots = table.GetSlots();
+  id = FindEventNameSlot(slots, eventId, hash, emptyIndex);
+  if(id == cInvalidEventNameId)
+  {
+    // Keep the slots at most half full so probes stay short
+    if((table.mCount + 1) * 2 > slots->mCapacity)
+    {
+      EventNameSlots* newSlots = new EventNameSlots(slots->mCapacity * 2);
+      for(size_t i = 0; i < slots->mCapacity; ++i)
+      {
+        EventNameSlot& slot = slots->mSlots[i];
+        if(slot.mId == cInvalidEventNameId)
+          continue;
+
+        size_t newIndex = 0;
+        FindEventNameSlot(newSlots, slot.mName, slot.mHash, newIndex);
+        EventNameSlot& newSlot = newSlots->mSlots[newIndex];
+        newSlot.mHash = slot.mHash;
+        newSlot.mName = slot.mName;
+        newSlot.mId = (EventNameId)slot.mId;
+      }
+
+      // Lookups that already have the old slots can keep reading them
+      AtomicStore(&table.mSlots, (void*)newSlots);
+      slots = newSlots;
+      FindEventNameSlot(slots, eventId, hash, emptyIndex);
+    }
+
+    id = (EventNameId)(++table.mCount);
+    EventNameSlot& slot = slots->mSlots[emptyIndex];
+    slot.mHash = hash;
+    slot.mName = eventId;
+    slot.mId = id;
+  }
+
+  table.mLock.Unlock();
+  return id;
+}
+
+EventNameId FindEventNameId(StringParam eventId)
+{
+  size_t emptyIndex = 0;
+  return FindEventNameSlot(GetEventNameTable().GetSlots(), eventId, eventId.Hash(), emptyIndex);
+}
+
 namespace Events
 {
   DefineEvent(ObjectDestroyed);
@@ -362,27 +499,26 @@ EventDispatcher::~EventDispatcher()
 
 void EventDispatcher::DisconnectEvent(StringParam eventId, ObjPtr thisObject)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
+  EventDispatchList* list = mEvents.FindValue(FindEventNameId(eventId), nullptr);
+  if(list)
   {
-    r.Front().second->Disconnect(thisObject);
+    list->Disconnect(thisObject);
   }
 }
 
 bool EventDispatcher::IsConnected(StringParam eventId, ObjPtr thisObject)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
+  EventDispatchList* list = mEvents.FindValue(FindEventNameId(eventId), nullptr);
+  if(list)
   {
-    return r.Front().second->IsConnected(thisObject);
+    return list->IsConnected(thisObject);
   }
   return false;
 }
 
 bool EventDispatcher::IsAnyConnected(StringParam eventId)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  return !r.Empty();
+  return HasReceivers(eventId);
 }
 
 void EventDispatcher::Disconnect(ObjPtr thisObject)
@@ -395,16 +531,55 @@ void EventDispatcher::Disconnect(ObjPtr thisObject)
 }
 
 void EventDispatcher::Dispatch(StringParam eventId, Event* event)
+{
+  if(!ValidateDispatch(eventId, event))
+    return;
+
+  // Nothing can be connected to a name that was never interned
+  if(mEvents.Empty())
+    return;
+
+  DispatchValidated(FindEventNameId(eventId), eventId, event);
+}
+
+void EventDispatcher::Dispatch(const InternedEventName& eventId, Event* event)
+{
+  if(!ValidateDispatch(eventId, event))
+    return;
+
+  DispatchValidated(eventId.mId, eventId, event);
+}
+
+bool EventDispatcher::ValidateDispatch(StringParam eventId, Event* event)
 {
   if(event == NULL)
   {
     DoNotifyException("Invalid event", "Cannot dispatch a null event");
-    return;
+    return false;
   }
 
-  if(event->mTerminated)
-    return;
+  return ValidateEventType(eventId, event);
+}
 
+bool EventDispatcher::ValidateDispatch(const InternedEventName& eventId, Event* event)
+{
+  if(event == NULL)
+  {
+    DoNotifyException("Invalid event", "Cannot dispatch a null event");
+    return false;
+  }
+
+  // Native code sends its event constants with the type they were bound with, and
+  // checking looks the name up, so only debug builds check (scripts always do)
+#if defined(ZeroDebug)
+  return ValidateEventType(eventId, event);
+#else
+  return true;
+#endif
+}
+
+bool EventDispatcher::ValidateEventType(StringParam eventId, Event* event)
+{
   BoundType* sentEventType = ZilchVirtualTypeId(event);
 
   // Validate that, if this event is bound, we're actually sending the proper event!
@@ -426,50 +601,57 @@ void EventDispatcher::Dispatch(StringParam eventId, Event* event)
         String message = String::Format("The event was bound as a %s but you attempted to send a %s",
           boundEventType->Name.c_str(), sentEventType->Name.c_str());
         DoNotifyException("Events", message);
-        return;
+        return false;
       }
     }
   }
 
+  return true;
+}
+
+void EventDispatcher::DispatchValidated(EventNameId id, StringParam eventId, Event* event)
+{
+  if(event->mTerminated)
+    return;
+
+  EventDispatchList* list = mEvents.FindValue(id, nullptr);
+  if(list == nullptr)
+    return;
+
   // Store the event Id so we can restore it after
   String previousEventId = event->EventId;
 
   event->EventId = eventId;
 
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
-  {
-    //Object is listening to this signal.
-    //Signal all objects in the signal chain.
-    r.Front().second->Dispatch(event);
-  }
-  else
-  {
-    //do nothing
-  }
+  //Object is listening to this signal.
+  //Signal all objects in the signal chain.
+  list->Dispatch(event);
 
   event->EventId = previousEventId;
 }
 
 bool EventDispatcher::HasReceivers(StringParam eventId)
 {
-  return !mEvents.Find(eventId).Empty();
+  if(mEvents.Empty())
+    return false;
+  return mEvents.FindPointer(FindEventNameId(eventId)) != nullptr;
+}
+
+bool EventDispatcher::HasReceivers(const InternedEventName& eventId)
+{
+  return mEvents.FindPointer(eventId.mId) != nullptr;
 }
 
 void EventDispatcher::Connect(StringParam eventId, EventConnection* connection)
 {
   //Check to see if the signal has been mapped
-  EventMapType::range r = mEvents.Find(eventId);
-  EventDispatchList* list = nullptr;
-  if(!r.Empty())
-  {
-    list = r.Front().second;
-  }
-  else
+  EventNameId id = InternEventName(eventId);
+  EventDispatchList* list = mEvents.FindValue(id, nullptr);
+  if(list == nullptr)
   {
     //Event with that eventId not yet mapped. Make a new list and map the event id
     list = new EventDispatchList();
-    mEvents.Insert(eventId, list);
+    mEvents.Insert(id, list);
   }
 
   //Bind the connection to the event list
@@ -481,9 +663,19 @@ void EventObject::DispatchEvent(StringParam eventId, Event* event)
   this->GetDispatcher()->Dispatch(eventId, event);
 }
 
+void EventObject::DispatchEvent(const InternedEventName& eventId, Event* event)
+{
+  this->GetDispatcher()->Dispatch(eventId, event);
+}
+
 bool EventObject::HasReceivers(StringParam eventId)
 {
   return GetDispatcher()->HasReceivers(eventId);
 }
 
+bool EventObject::HasReceivers(const InternedEventName& eventId)
+{
+  return GetDispatcher()->HasReceivers(eventId);
+}
+
 }//namespace Zero
@@ -15,6 +15,36 @@ namespace Zero
 class EventReceiver;
 class EventDispatcher;
 
+//------------------------------------------------------------------- Event Name
+/// Every event name is interned once into a compact integer id so that
+/// dispatchers are keyed by the id instead of hashing and comparing strings.
+typedef u32 EventNameId;
+const EventNameId cInvalidEventNameId = 0;
+
+/// Returns the id of the event name, interning the name if it is new.
+/// Ids are never released so they stay valid across script recompiles.
+EventNameId InternEventName(StringParam eventId);
+
+/// Returns the id of an already interned event name, or cInvalidEventNameId
+/// if the name was never interned (nothing can be connected to it).
+/// Never locks, so it is cheap enough for every string keyed dispatch.
+EventNameId FindEventNameId(StringParam eventId);
+
+/// An event name constant that carries its interned id. It is still a String,
+/// so it can be used anywhere an event name is expected, but dispatching with
+/// it does not have to look the name up. Made by DefineEvent.
+class InternedEventName : public String
+{
+public:
+  explicit InternedEventName(cstr name)
+    : String(name)
+  {
+    mId = InternEventName(*this);
+  }
+
+  EventNameId mId;
+};
+
 //------------------------------------------------------------------------ Event
 
 ///Base event class. All events types inherit from this class.
@@ -184,9 +214,21 @@ public:
 
   /// Dispatch event to all connections
   void Dispatch(StringParam eventId, Event* event);
+  /// Dispatch with an event constant, which skips looking up the name
+  void Dispatch(const InternedEventName& eventId, Event* event);
+
+  /// Checks that an event can be sent under the name. It must not be null, and if the
+  /// name was bound with an event type the event must be that type (or derive from it).
+  /// Event constants only have their type checked in debug builds.
+  static bool ValidateDispatch(StringParam eventId, Event* event);
+  static bool ValidateDispatch(const InternedEventName& eventId, Event* event);
+  /// Dispatch an event that was already validated under an id that was already found,
+  /// so an event sent to many dispatchers is only checked and looked up once.
+  void DispatchValidated(EventNameId id, StringParam eventId, Event* event);
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const InternedEventName& eventId);
 
   /// Add a new EventConnection to this Dispatcher
   void Connect(StringParam eventId, EventConnection* connect);
@@ -209,7 +251,10 @@ public:
   bool IsAnyConnected(StringParam eventId);
 
 private:
-  typedef HashMap<String, EventDispatchList*> EventMapType;
+  static bool ValidateEventType(StringParam eventId, Event* event);
+
+  // Sorted by interned id, most dispatchers only have a handful of events
+  typedef ArrayMap<EventNameId, EventDispatchList*> EventMapType;
   EventMapType mEvents;
 };
 
@@ -254,9 +299,9 @@ inline void Connect(targetType* dispatcher, StringParam eventId,
     receiver->GetReceiver(), dispatcher->GetDispatcher());
 }
 
-#define DeclareEvent(name) extern const String name
+#define DeclareEvent(name) extern const InternedEventName name
 
-#define DefineEvent(name) const String name = #name
+#define DefineEvent(name) const InternedEventName name(#name)
 
 #define ConnectThisTo(target, eventname, handle) \
   do { Zero::Connect(target, eventname, this, &ZilchSelf::handle); } while (false)
@@ -308,11 +353,13 @@ public:
   EventReceiver* GetReceiverObject() override { return GetReceiver(); }
 
   void DispatchEvent(StringParam eventId, Event* event);
+  void DispatchEvent(const InternedEventName& eventId, Event* event);
   EventDispatcher* GetDispatcher() { return &mDispatcher; }
   EventReceiver* GetReceiver() { return &mTracker; }
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const InternedEventName& eventId);
 
 protected:
   EventReceiver mTracker;
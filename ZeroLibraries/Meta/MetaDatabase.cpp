@@ -90,6 +90,9 @@ void MetaDatabase::AddLibrary(LibraryParam library, bool sendModifiedEvent)
     {
       String eventName = sendsEvents->Name;
 
+      // Script events are interned when their library is compiled instead of on first connection
+      InternEventName(eventName);
+
       // If the event already exists in the database skip it (can have duplicate sends event entries)
       if(mEventMap.ContainsKey(eventName))
         continue;
@@ -22,6 +22,11 @@ void Sleep(uint ms)
   Error("Not implemented");
 }
 
+uint GetProcessorCount()
+{
+  return 1;
+}
+
 void SetTimerFrequency(uint ms)
 {
   Error("Not implemented");
@@ -17,6 +17,11 @@
 #include <netdb.h>
 #include <fcntl.h>
 
+// Batched datagram system calls (recvmmsg / sendmmsg) are Linux specific
+#if defined(__linux__)
+#define ZERO_SOCKET_BATCH_SYSCALLS
+#endif
+
 // Platform Conversion Types and Macros
 typedef int              SOCKET_TYPE;
 typedef ushort           SOCKET_ADDRESS_FAMILY;
@@ -55,6 +60,9 @@ typedef sockaddr_storage SOCKET_ADDRESS_STORAGE;
 namespace Zero
 {
 
+/// Maximum number of datagrams passed to a single batched system call
+static const size_t SocketBatchSyscallMaxDatagrams = 64;
+
 /// Sets the status error code and optional error string
 void FailOnError(Status& status, int errorCode, StringParam errorString)
 {
@@ -1387,6 +1395,125 @@ size_t Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, Soc
   return result;
 }
 
+size_t Socket::SendToBatch(Status& status, const SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+#if defined(ZERO_SOCKET_BATCH_SYSCALLS)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  // Send datagrams over socket to their specified remote addresses, a chunk per system call
+  size_t next = 0;
+  size_t sent = 0;
+  while(next < datagramCount)
+  {
+    mmsghdr messages[SocketBatchSyscallMaxDatagrams];
+    iovec   buffers[SocketBatchSyscallMaxDatagrams];
+    memset(messages, 0, sizeof(messages));
+
+    size_t count = datagramCount - next;
+    if(count > SocketBatchSyscallMaxDatagrams)
+      count = SocketBatchSyscallMaxDatagrams;
+    for(size_t i = 0; i < count; ++i)
+    {
+      const SocketDatagram& datagram = datagrams[next + i];
+      buffers[i].iov_base                = datagram.mData;
+      buffers[i].iov_len                 = datagram.mDataLength;
+      messages[i].msg_hdr.msg_name       = datagram.mAddress->mPrivateData;
+      messages[i].msg_hdr.msg_namelen    = sizeof(SOCKET_ADDRESS_STORAGE);
+      messages[i].msg_hdr.msg_iov        = &buffers[i];
+      messages[i].msg_hdr.msg_iovlen     = 1;
+    }
+
+    // (sendmmsg stops at the first datagram it fails to send, and only fails itself if that is the first one of the chunk)
+    int result = sendmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)count, (int)flags);
+    if(result == SOCKET_ERROR) // Unable?
+    {
+      // Skip the failed datagram so the rest of the batch is still sent
+      FailOnLastError(status);
+      next += 1;
+      continue;
+    }
+
+    next += result;
+    sent += result;
+  }
+
+  return sent;
+#else
+  // Send datagrams over socket one at a time
+  size_t sent = 0;
+  for(size_t i = 0; i < datagramCount; ++i)
+  {
+    const SocketDatagram& datagram = datagrams[i];
+    Status sendStatus;
+    SendTo(sendStatus, datagram.mData, datagram.mDataLength, *datagram.mAddress, flags);
+    if(sendStatus.Failed()) // Unable?
+    {
+      // Skip the failed datagram so the rest of the batch is still sent
+      status = sendStatus;
+      continue;
+    }
+
+    ++sent;
+  }
+
+  return sent;
+#endif
+}
+
+size_t Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  if(datagramCount == 0)
+    return 0;
+
+#if defined(ZERO_SOCKET_BATCH_SYSCALLS)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  // Receive datagrams over socket from any remote address, blocking only until the first arrives
+  mmsghdr messages[SocketBatchSyscallMaxDatagrams];
+  iovec   buffers[SocketBatchSyscallMaxDatagrams];
+  memset(messages, 0, sizeof(messages));
+
+  size_t count = datagramCount;
+  if(count > SocketBatchSyscallMaxDatagrams)
+    count = SocketBatchSyscallMaxDatagrams;
+  for(size_t i = 0; i < count; ++i)
+  {
+    SocketDatagram& datagram = datagrams[i];
+    buffers[i].iov_base                = datagram.mData;
+    buffers[i].iov_len                 = datagram.mDataLength;
+    messages[i].msg_hdr.msg_name       = datagram.mAddress->mPrivateData;
+    messages[i].msg_hdr.msg_namelen    = sizeof(SOCKET_ADDRESS_STORAGE);
+    messages[i].msg_hdr.msg_iov        = &buffers[i];
+    messages[i].msg_hdr.msg_iovlen     = 1;
+  }
+
+  int result = recvmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)count, (int)flags | MSG_WAITFORONE, nullptr);
+  if(result == SOCKET_ERROR) // Unable?
+  {
+    FailOnLastError(status);
+    return 0;
+  }
+
+  // Set received lengths
+  for(int i = 0; i < result; ++i)
+    datagrams[i].mDataLength = messages[i].msg_len;
+
+  // Success
+  return result;
+#else
+  // Receive a single datagram over socket from any remote address
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mDataLength = ReceiveFrom(status, datagram.mData, datagram.mDataLength, *datagram.mAddress, flags);
+  if(status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+#endif
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
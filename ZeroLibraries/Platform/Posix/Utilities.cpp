@@ -27,6 +27,14 @@ void Sleep(uint ms)
   usleep (ms * 1000);
 }
 
+uint GetProcessorCount()
+{
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  if(count < 1)
+    return 1;
+  return (uint)count;
+}
+
 void DebugBreak()
 {
   __builtin_trap();
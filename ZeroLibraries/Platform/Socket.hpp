@@ -185,6 +185,22 @@ ZeroShared SocketAddress StringToIpv4Address(StringParam address, ushort port);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address, ushort port);
 
+//---------------------------------------------------------------------------------//
+//                                SocketDatagram                                   //
+//---------------------------------------------------------------------------------//
+
+/// Datagram sent or received by a batched socket operation
+/// (Refers to caller owned memory, nothing is allocated per datagram)
+struct ZeroShared SocketDatagram
+{
+  /// Data to send, or buffer to receive into
+  byte*          mData;
+  /// Data length to send, or buffer capacity to receive into (set to the length received)
+  size_t         mDataLength;
+  /// Remote address to send to, or set to the remote address received from
+  SocketAddress* mAddress;
+};
+
 //---------------------------------------------------------------------------------//
 //                                    Socket                                       //
 //---------------------------------------------------------------------------------//
@@ -331,6 +347,13 @@ public:
   /// Returns the number of bytes sent (0 if an error occurs, status will contain the error)
   size_t SendTo(Status& status, const byte* data, size_t dataLength, const SocketAddress& to, SocketFlags::Enum flags = SocketFlags::None);
 
+  /// Sends each datagram on the open socket to its remote address
+  /// Sends the whole batch with a single system call where supported (sendmmsg on Linux), else one at a time
+  /// Will block if the send buffer is full (unless the socket is set to non-blocking)
+  /// Datagrams that fail to send are skipped and the rest of the batch is still sent
+  /// Returns the number of datagrams sent (less than datagramCount if an error occurs, status will contain the last error)
+  size_t SendToBatch(Status& status, const SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags = SocketFlags::None);
+
   /// Receives data on the connected socket from the connected remote address
   /// Will block if the receive buffer is empty (unless the socket is set to non-blocking)
   /// Returns the number of bytes received (0 if an error occurs, status will contain the error)
@@ -341,6 +364,12 @@ public:
   /// Returns the number of bytes received (0 if an error occurs, status will contain the error)
   size_t ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, SocketAddress& from, SocketFlags::Enum flags = SocketFlags::None);
 
+  /// Receives up to datagramCount datagrams on the open socket from any remote address
+  /// Receives the whole batch with a single system call where supported (recvmmsg on Linux), else one datagram
+  /// Will block until the first datagram is received (unless the socket is set to non-blocking), then only takes datagrams already waiting
+  /// Returns the number of datagrams received (0 if an error occurs, status will contain the error)
+  size_t ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags = SocketFlags::None);
+
   /// Returns true if the specified socket capability is ready for use, else false
   /// In a high efficiency situation, mechanisms other than select should be used
   bool Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const;
@@ -1264,6 +1264,45 @@ size_t Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, Soc
   return result;
 }
 
+size_t Socket::SendToBatch(Status& status, const SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  // Send datagrams over socket one at a time
+  // (Winsock has no batched datagram send)
+  size_t sent = 0;
+  for(size_t i = 0; i < datagramCount; ++i)
+  {
+    const SocketDatagram& datagram = datagrams[i];
+    Status sendStatus;
+    SendTo(sendStatus, datagram.mData, datagram.mDataLength, *datagram.mAddress, flags);
+    if(sendStatus.Failed()) // Unable?
+    {
+      // Skip the failed datagram so the rest of the batch is still sent
+      status = sendStatus;
+      continue;
+    }
+
+    ++sent;
+  }
+
+  return sent;
+}
+
+size_t Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  if(datagramCount == 0)
+    return 0;
+
+  // Receive a single datagram over socket from any remote address
+  // (Winsock has no batched datagram receive)
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mDataLength = ReceiveFrom(status, datagram.mData, datagram.mDataLength, *datagram.mAddress, flags);
+  if(status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
@@ -28,6 +28,13 @@ void Sleep(uint ms)
   ::Sleep(ms);
 }
 
+uint GetProcessorCount()
+{
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return (uint)systemInfo.dwNumberOfProcessors;
+}
+
 void SetTimerFrequency(uint ms)
 {
   ::timeBeginPeriod(ms);
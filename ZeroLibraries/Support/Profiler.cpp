@@ -10,6 +10,7 @@
 #include "Precompiled.hpp"
 #include "Profiler.hpp"
 #include "Platform/Timer.hpp"
+#include "Platform/File.hpp"
 #include "Utility/Misc.hpp"
 
 namespace Zero
@@ -19,10 +20,69 @@ namespace Profile
 
 uint Record::sSampleIndex = 0;
 
+// The event buffer of the current thread (created the first time the thread profiles anything)
+ZeroThreadLocal ThreadEventBuffer* tThreadEvents = nullptr;
+
+//------------------------------------------------------------ ThreadEventBuffer
+ThreadEventBuffer::ThreadEventBuffer(uint threadIndex)
+  : mThreadIndex(threadIndex),
+    mWriteIndex(0),
+    mReadIndex(0)
+{
+  mName = String::Format("Thread %u", threadIndex);
+}
+
+void ThreadEventBuffer::Push(Record* record, ProfileTime time, bool begin)
+{
+  // We're the only writer, so we can read our own index without any ordering
+  s64 writeIndex = mWriteIndex.Load();
+  ProfileEvent& event = mEvents[writeIndex & (cEventCount - 1)];
+  event.mRecord = record;
+  event.mTime = time;
+  event.mBegin = begin;
+
+  // Publish the event to the reader
+  mWriteIndex.Store(writeIndex + 1);
+}
+
+void ThreadEventBuffer::Read(Array<ProfileEvent>& eventsOut)
+{
+  s64 writeIndex = mWriteIndex.Load();
+
+  // If the writer has lapped us the oldest events are already gone
+  s64 readIndex = mReadIndex;
+  if(writeIndex - readIndex > (s64)cEventCount)
+    readIndex = writeIndex - cEventCount;
+
+  size_t start = eventsOut.Size();
+  for(s64 i = readIndex; i < writeIndex; ++i)
+    eventsOut.PushBack(mEvents[i & (cEventCount - 1)]);
+
+  // The writer kept going while we copied, so anything it has since
+  // overwritten may be torn and has to be thrown away. The slot the writer
+  // is filling right now is also the slot of the oldest event, so that one
+  // can't be trusted either
+  s64 oldestValid = mWriteIndex.Load() - cEventCount + 1;
+  if(oldestValid > readIndex)
+  {
+    size_t torn = (size_t)Math::Min(oldestValid - readIndex, writeIndex - readIndex);
+    eventsOut.Erase(eventsOut.SubRange(start, torn));
+  }
+
+  mReadIndex = writeIndex;
+}
+
+void ThreadEventBuffer::SkipToEnd()
+{
+  mReadIndex = mWriteIndex.Load();
+}
+
+//---------------------------------------------------------------- ProfileSystem
 ProfileSystem* ProfileSystem::Instance = nullptr;
 void ProfileSystem::Initialize()
 {
   Instance = new ProfileSystem();
+  Instance->SetThreadName("Main");
 }
 
 void ProfileSystem::Shutdown()
@@ -30,6 +90,18 @@ void ProfileSystem::Shutdown()
   SafeDelete(Instance);
 }
 
+ProfileSystem::ProfileSystem()
+{
+  mCaptureFramesLeft = 0;
+  mCaptureStart = 0;
+}
+
+ProfileSystem::~ProfileSystem()
+{
+  // Threads still holding onto their buffer will not profile after this point
+  DeleteObjectsInContainer(mThreads);
+}
+
 float ProfileSystem::GetTimeInSeconds(ProfileTime time)
 {
   return (float)mTimer.TicksToSeconds(time);
@@ -37,11 +109,16 @@ float ProfileSystem::GetTimeInSeconds(ProfileTime time)
 
 void ProfileSystem::Add(Record* record)
 {
+  mRecordLock.Lock();
   mRecordList.PushBack(record);
+  mRecordLock.Unlock();
 }
 
 void ProfileSystem::Add(cstr parentName, Record* record)
 {
+  // Records are static locals so the first use on another thread adds them from that thread
+  mRecordLock.Lock();
+
   Array<Record*>::range r = mRecordList.All();
   //if this object has a parent, then walk through the record list
   //to find the parent
@@ -59,14 +136,159 @@ void ProfileSystem::Add(cstr parentName, Record* record)
 
   //always add this record to the record list
   mRecordList.PushBack(record);
+
+  mRecordLock.Unlock();
 }
 
 ProfileTime ProfileSystem::GetTime()
 {
-  //TODO: Fix for multiple threads. (Thread local storage?)
+  // The tick time is read straight from the performance counter so any thread can call this
   return mTimer.GetTickTime();
 }
 
+ThreadEventBuffer* ProfileSystem::GetThreadEvents()
+{
+  if(tThreadEvents != nullptr)
+    return tThreadEvents;
+
+  mThreadLock.Lock();
+  tThreadEvents = new ThreadEventBuffer(mThreads.Size());
+  mThreads.PushBack(tThreadEvents);
+  mThreadLock.Unlock();
+  return tThreadEvents;
+}
+
+void ProfileSystem::SetThreadName(StringParam name)
+{
+  ThreadEventBuffer* threadEvents = GetThreadEvents();
+  mThreadLock.Lock();
+  threadEvents->mName = name;
+  mThreadLock.Unlock();
+}
+
+void ProfileSystem::CaptureFrames(uint frameCount, StringParam filePath)
+{
+  mCapturePath = filePath;
+  mCaptureStart = GetTime();
+  mCaptureFrames.Clear();
+  mCaptureEvents.Clear();
+
+  // Only events from this point on are part of the capture
+  mThreadLock.Lock();
+  forRange(ThreadEventBuffer* threadEvents, mThreads.All())
+    threadEvents->SkipToEnd();
+  mThreadLock.Unlock();
+
+  mCaptureFramesLeft = frameCount;
+}
+
+bool ProfileSystem::IsCapturing()
+{
+  return mCaptureFramesLeft != 0;
+}
+
+void ProfileSystem::EndFrame()
+{
+  if(mCaptureFramesLeft == 0)
+    return;
+
+  mCaptureFrames.PushBack(GetTime());
+
+  // Read the events every frame so the ring buffers don't wrap during the capture
+  ReadThreadEvents();
+
+  --mCaptureFramesLeft;
+  if(mCaptureFramesLeft == 0)
+    WriteCapture();
+}
+
+void ProfileSystem::ReadThreadEvents()
+{
+  mThreadLock.Lock();
+  mCaptureEvents.Resize(mThreads.Size());
+  for(uint i = 0; i < mThreads.Size(); ++i)
+    mThreads[i]->Read(mCaptureEvents[i]);
+  mThreadLock.Unlock();
+}
+
+// Writes a string as a json string value
+static void AppendJsonString(StringBuilder& builder, cstr text)
+{
+  builder.Append('"');
+  for(cstr c = text; *c != '\0'; ++c)
+  {
+    if(*c == '"' || *c == '\\')
+      builder.Append('\\');
+    builder.Append(*c);
+  }
+  builder.Append('"');
+}
+
+void ProfileSystem::WriteCapture()
+{
+  StringBuilder builder;
+  builder.Append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  mThreadLock.Lock();
+
+  // Name every thread first
+  for(uint i = 0; i < mThreads.Size(); ++i)
+  {
+    builder.AppendFormat("{\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", i);
+    AppendJsonString(builder, mThreads[i]->mName.c_str());
+    builder.Append("}},\n");
+  }
+
+  mThreadLock.Unlock();
+
+  // Timestamps are in microseconds from the start of the capture
+  for(uint i = 0; i < mCaptureEvents.Size(); ++i)
+  {
+    // The capture can start or end in the middle of a scope, ends that
+    // happen before their begin was captured are skipped
+    uint depth = 0;
+    forRange(ProfileEvent& event, mCaptureEvents[i].All())
+    {
+      double time = mTimer.TicksToSeconds(event.mTime - mCaptureStart) * 1000000.0;
+      if(event.mBegin)
+      {
+        builder.Append("{\"ph\":\"B\",\"name\":");
+        AppendJsonString(builder, event.mRecord->GetName());
+        builder.AppendFormat(",\"pid\":0,\"tid\":%u,\"ts\":%.3f},\n", i, time);
+        ++depth;
+      }
+      else if(depth != 0)
+      {
+        builder.AppendFormat("{\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f},\n", i, time);
+        --depth;
+      }
+    }
+
+    // Close any scopes that were still open at the end of the capture
+    double endTime = mTimer.TicksToSeconds(mCaptureFrames.Back() - mCaptureStart) * 1000000.0;
+    for(; depth != 0; --depth)
+      builder.AppendFormat("{\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f},\n", i, endTime);
+  }
+
+  // Mark each frame on the main thread's timeline
+  for(uint i = 0; i < mCaptureFrames.Size(); ++i)
+  {
+    double time = mTimer.TicksToSeconds(mCaptureFrames[i] - mCaptureStart) * 1000000.0;
+    builder.AppendFormat("{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame %u\",\"pid\":0,\"tid\":0,\"ts\":%.3f}", i, time);
+    if(i + 1 != mCaptureFrames.Size())
+      builder.Append(',');
+    builder.Append('\n');
+  }
+
+  builder.Append("]}\n");
+
+  String json = builder.ToString();
+  WriteToFile(mCapturePath.c_str(), (const byte*)json.c_str(), json.SizeInBytes());
+
+  mCaptureFrames.Clear();
+  mCaptureEvents.Clear();
+}
+
 Record::Record(void)
 {
   mName = nullptr;
@@ -162,12 +384,17 @@ void Record::AddChild(Record* record)
 
 void Record::EnterRecord(ProfileTime time)
 {
-  ++mHits;
-  mTotalTime+=time;
+  // The same record can be entered from more than one thread
+  AtomicPreIncrement((volatile s32*)&mHits);
+  AtomicFetchAdd((volatile s64*)&mTotalTime, (s64)time);
+
   //update the max time that was ever spent in this record.
-  if(time > mMaxTime)
+  ProfileTime maxTime = mMaxTime;
+  while(time > maxTime)
   {
-    mMaxTime = time;
+    if(AtomicCompareExchangeBool((volatile s64*)&mMaxTime, (s64)time, (s64)maxTime))
+      break;
+    maxTime = mMaxTime;
     //if(mInstantAvg != 0.0f && 3.0f * mInstantAvg < (float)time)
     //  DebugPrint("%s has an average of %g and spike with %g\n",mName,mInstantAvg,(float)time);
   }
@@ -176,12 +403,15 @@ void Record::EnterRecord(ProfileTime time)
 ScopeTimer::ScopeTimer(Record* data)
 {
   mData = data;
+  mThreadEvents = ProfileSystem::Instance->GetThreadEvents();
   mStartTime = ProfileSystem::Instance->GetTime();
+  mThreadEvents->Push(data, mStartTime, true);
 }
 
 ScopeTimer::~ScopeTimer()
 {
   ProfileTime endTime = ProfileSystem::Instance->GetTime();
+  mThreadEvents->Push(mData, endTime, false);
   mData->EnterRecord(endTime-mStartTime);
 }
 
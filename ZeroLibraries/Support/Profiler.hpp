@@ -12,6 +12,9 @@
 #include "Utility/Typedefs.hpp"
 #include "Containers/Array.hpp"
 #include "Containers/InList.hpp"
+#include "String/String.hpp"
+#include "Utility/Atomic.hpp"
+#include "Utility/SpinLock.hpp"
 #include "Platform/Timer.hpp"
 
 namespace Zero
@@ -24,6 +27,42 @@ namespace Profile
 typedef u64 ProfileTime;
 class Record;
 
+/// The start or end of a ScopeTimer on some thread.
+struct ProfileEvent
+{
+  Record* mRecord;
+  ProfileTime mTime;
+  bool mBegin;
+};
+
+/// The profile events of a single thread. Only the owning thread ever writes
+/// to the buffer so pushing an event needs no locks. The buffer is a ring, so
+/// if nobody is capturing (or the capture falls behind) the oldest events are
+/// simply overwritten.
+class ThreadEventBuffer
+{
+public:
+  static const uint cEventCount = 16384;
+
+  ThreadEventBuffer(uint threadIndex);
+
+  /// Adds an event (only called from the owning thread).
+  void Push(Record* record, ProfileTime time, bool begin);
+  /// Copies out every event written since the last read. Any events that were
+  /// overwritten before or during the copy are dropped.
+  void Read(Array<ProfileEvent>& eventsOut);
+  /// Skips every event that has been written so far.
+  void SkipToEnd();
+
+  String mName;
+  uint mThreadIndex;
+
+private:
+  ProfileEvent mEvents[cEventCount];
+  Atomic<s64> mWriteIndex;
+  s64 mReadIndex;
+};
+
 /// System to manage all of the profile records.
 class ProfileSystem
 {
@@ -31,14 +70,44 @@ public:
   static ProfileSystem* Instance;
   static void Initialize();
   static void Shutdown();
+  ProfileSystem();
+  ~ProfileSystem();
   void Add(Record* record);
   void Add(cstr parentName, Record* record);
   float GetTimeInSeconds(ProfileTime time);
   ProfileTime GetTime();
   Array<Record*>::range GetRecords(){ return mRecordList.All(); }
+
+  /// Gets the event buffer of the calling thread (created on first use).
+  ThreadEventBuffer* GetThreadEvents();
+  /// Sets the name that the calling thread is shown with in captures.
+  void SetThreadName(StringParam name);
+
+  /// Records every thread's events for the next frames and then writes them
+  /// to the file in the Chrome trace json format (chrome://tracing or Perfetto).
+  void CaptureFrames(uint frameCount, StringParam filePath);
+  bool IsCapturing();
+  /// Marks the end of a frame for captures (called once per engine update).
+  void EndFrame();
+
 private:
+  void ReadThreadEvents();
+  void WriteCapture();
+
   Array<Record*> mRecordList;
+  SpinLock mRecordLock;
   Timer mTimer;
+
+  // Thread events
+  Array<ThreadEventBuffer*> mThreads;
+  SpinLock mThreadLock;
+
+  // Capture
+  uint mCaptureFramesLeft;
+  String mCapturePath;
+  ProfileTime mCaptureStart;
+  Array<ProfileTime> mCaptureFrames;
+  Array< Array<ProfileEvent> > mCaptureEvents;
 };
 
 /// Stores a timed record for a given name. This record may have a parent
@@ -106,7 +175,8 @@ private:
   InListBaseLink<Record> mChildren;
 };
 
-/// A timer that keeps a record for the given variable scope.
+/// A timer that keeps a record for the given variable scope. The start and
+/// end are also pushed to the calling thread's event buffer.
 class ScopeTimer
 {
 public:
@@ -115,6 +185,7 @@ public:
 
   Record* mData;
   ProfileTime mStartTime;
+  ThreadEventBuffer* mThreadEvents;
 };
 
 void PrintProfileGraph();
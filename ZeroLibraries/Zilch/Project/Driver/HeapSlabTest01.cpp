@@ -0,0 +1,124 @@
+#include "Precompiled.hpp"
+using namespace Zilch;
+
+// Every check is written out as an expected and actual line so a failure shows which one didn't match
+static void Check(Array<Diff>& diffs, cstr name, size_t expected, size_t actual)
+{
+  diffs.PushBack(Diff(String::Format("%s: %d", name, (int)expected), String::Format("%s: %d", name, (int)actual)));
+}
+
+static void CheckTrue(Array<Diff>& diffs, cstr name, bool actual)
+{
+  Check(diffs, name, 1, actual ? 1 : 0);
+}
+
+// Checks that the live blocks reported by the allocator are exactly the ones we expect
+static void CheckLiveBlocks(Array<Diff>& diffs, cstr name, HeapSlabAllocator& allocator, Array<byte*>& expected)
+{
+  Array<byte*> live;
+  allocator.GetLiveBlocks(live);
+  Check(diffs, name, expected.Size(), live.Size());
+
+  HashSet<byte*> liveSet;
+  ZilchForEach(byte* block, live)
+    liveSet.Insert(block);
+
+  size_t found = 0;
+  ZilchForEach(byte* block, expected)
+  {
+    if (liveSet.Contains(block))
+      ++found;
+  }
+  Check(diffs, name, expected.Size(), found);
+}
+
+void HeapSlabTest01(Array<Diff>& diffs)
+{
+  HeapSlabAllocator allocator;
+
+  // Size class routing: sizes within the same granularity share a slab and block size
+  byte* small0 = allocator.Allocate(1);
+  byte* small1 = allocator.Allocate(HeapSlabGranularity);
+  Check(diffs, "Same size class uses one slab", 1, allocator.GetSlabCount());
+  Check(diffs, "Same size class block spacing", HeapSlabGranularity, (size_t)(small1 - small0));
+
+  byte* medium0 = allocator.Allocate(HeapSlabGranularity + 1);
+  byte* medium1 = allocator.Allocate(HeapSlabGranularity * 2);
+  Check(diffs, "Next size class gets its own slab", 2, allocator.GetSlabCount());
+  Check(diffs, "Next size class block spacing", HeapSlabGranularity * 2, (size_t)(medium1 - medium0));
+
+  byte* largest = allocator.Allocate(HeapSlabMaxBlockSize);
+  Check(diffs, "Largest slab size class", 3, allocator.GetSlabCount());
+
+  // Large block fallback: too big for a slab, but still tracked and live
+  byte* large = allocator.Allocate(HeapSlabMaxBlockSize + 1);
+  Check(diffs, "Large blocks don't create slabs", 3, allocator.GetSlabCount());
+  CheckTrue(diffs, "Large block is live", allocator.IsLive(large));
+  CheckTrue(diffs, "Large block interior is not live", allocator.IsLive(large + 1) == false);
+  Check(diffs, "Live count with large block", 6, allocator.GetLiveCount());
+
+  bool largeZeroed = true;
+  for (size_t i = 0; i < HeapSlabMaxBlockSize + 1; ++i)
+    largeZeroed &= (large[i] == 0);
+  CheckTrue(diffs, "Large block is zeroed", largeZeroed);
+
+  allocator.Deallocate(large);
+  CheckTrue(diffs, "Freed large block is not live", allocator.IsLive(large) == false);
+  Check(diffs, "Live count after freeing large block", 5, allocator.GetLiveCount());
+
+  // Slab reuse: the block that was just freed is the next one handed out, and it comes back zeroed
+  memset(small1, 0xCD, HeapSlabGranularity);
+  allocator.Deallocate(small1);
+  byte* reused = allocator.Allocate(HeapSlabGranularity);
+  CheckTrue(diffs, "Freed block is reused", reused == small1);
+
+  bool reusedZeroed = true;
+  for (size_t i = 0; i < HeapSlabGranularity; ++i)
+    reusedZeroed &= (reused[i] == 0);
+  CheckTrue(diffs, "Reused block is zeroed", reusedZeroed);
+
+  // Live bitmap: only the start of a live block is live, and pointers we never handed out are not
+  int onStack = 0;
+  CheckTrue(diffs, "Block start is live", allocator.IsLive(small0));
+  CheckTrue(diffs, "Block interior is not live", allocator.IsLive(small0 + 1) == false);
+  CheckTrue(diffs, "Foreign pointer is not live", allocator.IsLive((byte*)&onStack) == false);
+  CheckTrue(diffs, "Null is not live", allocator.IsLive(nullptr) == false);
+
+  allocator.Deallocate(small0);
+  allocator.Deallocate(reused);
+  allocator.Deallocate(medium0);
+  allocator.Deallocate(medium1);
+  allocator.Deallocate(largest);
+  Check(diffs, "Everything freed", 0, allocator.GetLiveCount());
+
+  // Fill a slab (spanning many words of the live bitmap) and spill one block into a second slab
+  size_t blocksPerSlab = HeapSlabPageSize / HeapSlabGranularity;
+  size_t slabsBefore = allocator.GetSlabCount();
+  Array<byte*> blocks;
+  for (size_t i = 0; i < blocksPerSlab + 1; ++i)
+    blocks.PushBack(allocator.Allocate(HeapSlabGranularity));
+  Check(diffs, "Full slab spills into a new slab", slabsBefore + 1, allocator.GetSlabCount());
+
+  // Free every other block and make sure the bitmap reports exactly the rest
+  Array<byte*> expectedLive;
+  for (size_t i = 0; i < blocks.Size(); ++i)
+  {
+    if (i % 2 == 0)
+      allocator.Deallocate(blocks[i]);
+    else
+      expectedLive.PushBack(blocks[i]);
+  }
+  CheckLiveBlocks(diffs, "Live blocks after freeing every other block", allocator, expectedLive);
+
+  for (size_t i = 0; i < blocks.Size(); i += 2)
+    CheckTrue(diffs, "Freed slab block is not live", allocator.IsLive(blocks[i]) == false);
+
+  // Once both slabs are empty only one is kept around for the size class
+  ZilchForEach(byte* block, expectedLive)
+    allocator.Deallocate(block);
+  Check(diffs, "Empty slabs are given back", slabsBefore, allocator.GetSlabCount());
+  Check(diffs, "Everything freed again", 0, allocator.GetLiveCount());
+
+  Array<byte*> noBlocks;
+  CheckLiveBlocks(diffs, "No live blocks", allocator, noBlocks);
+}
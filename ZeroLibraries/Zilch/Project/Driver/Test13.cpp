@@ -0,0 +1,53 @@
+#include "Precompiled.hpp"
+using namespace Zilch;
+
+// Signed overflow is undefined in C++, so the wrapping the script relies on is done in unsigned
+static Integer WrapAdd(Integer left, Integer right)
+{
+  return (Integer)((unsigned int)left + (unsigned int)right);
+}
+
+static Integer WrapSubtract(Integer left, Integer right)
+{
+  return (Integer)((unsigned int)left - (unsigned int)right);
+}
+
+static Integer WrapMultiply(Integer left, Integer right)
+{
+  return (Integer)((unsigned int)left * (unsigned int)right);
+}
+
+Integer Test13()
+{
+  Integer total = WrapAdd(2147483600, 100);
+  total = WrapAdd(total, WrapMultiply(65536, 65536));
+  total = WrapAdd(total, WrapMultiply(46341, 46341));
+  total = WrapSubtract(total, WrapSubtract(-2147483600, 100));
+
+  for (Integer i = 0; i < 10; ++i)
+  {
+    Integer scaled = i * 3 + 1;
+    if (scaled < 14)
+      total = WrapAdd(total, scaled);
+    else if (scaled >= 20)
+      total = WrapSubtract(total, scaled * 2);
+
+    if (i != 4)
+      total = WrapAdd(total, 1);
+  }
+
+  Real step = 0.5f;
+  Real counter = 0.0f;
+  while (counter <= 4.0f)
+  {
+    counter += step;
+    total = WrapAdd(total, 3);
+  }
+
+  if (1.5f * 2.0f == 3.0f)
+    total = WrapAdd(total, 100);
+  total = WrapAdd(total, 1000);
+
+  Integer remainder = total % 1000;
+  return WrapAdd(total, WrapMultiply(remainder, remainder));
+}
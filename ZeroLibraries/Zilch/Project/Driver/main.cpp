@@ -21,8 +21,10 @@ Integer Test09();
 Integer Test10();
 Integer Test11();
 Integer Test12();
+Integer Test13();
 
 void DiffTest01(Array<Diff>& diffs);
+void HeapSlabTest01(Array<Diff>& diffs);
 
 
 #define ZilchPrintAndFlush(...) printf(__VA_ARGS__); fflush(stdout)
@@ -181,6 +183,110 @@ void ZilchCallMe5Times(Call& call, ExceptionReport& report)
   }
 }
 
+LibraryRef CompileSanityUnitTests(Module& dependencies, bool optimizeOpcode)
+{
+  Project project;
+  project.OptimizeOpcode = optimizeOpcode;
+  EventConnect(&project, Events::CompilationError, DefaultErrorCallback);
+
+  project.AddCodeFromFile("Test01.z", nullptr);
+  project.AddCodeFromFile("Test02.z", nullptr);
+  project.AddCodeFromFile("Test03.z", nullptr);
+  project.AddCodeFromFile("Test04.z", nullptr);
+  project.AddCodeFromFile("Test05.z", nullptr);
+  project.AddCodeFromFile("Test06.z", nullptr);
+  project.AddCodeFromFile("Test07.z", nullptr);
+  project.AddCodeFromFile("Test08.z", nullptr);
+  project.AddCodeFromFile("Test09.z", nullptr);
+  project.AddCodeFromFile("Test10.z", nullptr);
+  project.AddCodeFromFile("Test11.z", nullptr);
+  project.AddCodeFromFile("Test12.z", nullptr);
+  project.AddCodeFromFile("Test13.z", nullptr);
+
+  return project.Compile("UnitTests", dependencies, EvaluationMode::Project);
+}
+
+void RunSanityUnitTests(ExecutableState* state)
+{
+  UnitTest("UnitTest01", "Test01", Test01, state, CheckEqual<TypeOf(Test01())>);
+  UnitTest("UnitTest02", "Test02", Test02, state, CheckEqual<TypeOf(Test02())>);
+  UnitTest("UnitTest03", "Test03", Test03, state, CheckEqual<TypeOf(Test03())>);
+  UnitTest("UnitTest04", "Test04", Test04, state, CheckEqual<TypeOf(Test04())>);
+  UnitTest("UnitTest05", "Test05", Test05, state, CheckEqual<TypeOf(Test05())>);
+  UnitTest("UnitTest06", "Test06", Test06, state, CheckEqual<TypeOf(Test06())>);
+  UnitTest("UnitTest07", "Test07", Test07, state, CheckEqual<TypeOf(Test07())>);
+  UnitTest("UnitTest08", "Test08", Test08, state, CheckEqual<TypeOf(Test08())>);
+  UnitTest("UnitTest09", "Test09", Test09, state, CheckEqual<TypeOf(Test09())>);
+  UnitTest("UnitTest10", "Test10", Test10, state, CheckEqual<TypeOf(Test10())>);
+  UnitTest("UnitTest11", "Test11", Test11, state, CheckEqual<TypeOf(Test11())>);
+  UnitTest("UnitTest12", "Test12", Test12, state, CheckEqual<TypeOf(Test12())>);
+  UnitTest("UnitTest13", "Test13", Test13, state, CheckEqual<TypeOf(Test13())>);
+}
+
+// Gets every line that the opcode of a function maps back to
+void GetFunctionLines(Function* function, HashSet<size_t>& linesOut)
+{
+  typedef HashMap<size_t, CodeLocation> OpcodeLocationMap;
+  ZilchForEach(OpcodeLocationMap::pair& pair, function->OpcodeLocationToCodeLocation)
+  {
+    linesOut.Insert(pair.second.StartLine);
+  }
+}
+
+// The optimizer only removes or rewrites opcode, so the debugger must never map an optimized
+// program counter to a line that the unoptimized opcode didn't have, and every function must still map somewhere
+void CompareOptimizedLineMappings(LibraryRef unoptimized, LibraryRef optimized)
+{
+  ZilchPrintAndFlush("#BEGIN: OptimizedLineMappings\n");
+
+  bool success = unoptimized->OwnedFunctions.Size() == optimized->OwnedFunctions.Size();
+  for (size_t i = 0; success && i < unoptimized->OwnedFunctions.Size(); ++i)
+  {
+    // Both libraries were generated from the same code, so their functions are in the same order
+    Function* unoptimizedFunction = unoptimized->OwnedFunctions[i];
+    Function* optimizedFunction = optimized->OwnedFunctions[i];
+    if (unoptimizedFunction->Name != optimizedFunction->Name)
+    {
+      ZilchPrintAndFlush("#FAILED: Function '%s' did not line up with '%s'\n", unoptimizedFunction->Name.c_str(), optimizedFunction->Name.c_str());
+      success = false;
+      break;
+    }
+
+    HashSet<size_t> unoptimizedLines;
+    HashSet<size_t> optimizedLines;
+    GetFunctionLines(unoptimizedFunction, unoptimizedLines);
+    GetFunctionLines(optimizedFunction, optimizedLines);
+
+    if (unoptimizedLines.Empty() != optimizedLines.Empty())
+    {
+      ZilchPrintAndFlush("#FAILED: Function '%s' lost all of its debug locations\n", optimizedFunction->Name.c_str());
+      success = false;
+    }
+
+    ZilchForEach(size_t line, optimizedLines)
+    {
+      if (unoptimizedLines.Contains(line) == false)
+      {
+        ZilchPrintAndFlush("#FAILED: Function '%s' maps opcode to line %d which it never had\n", optimizedFunction->Name.c_str(), (int)line);
+        success = false;
+        break;
+      }
+    }
+  }
+
+  if (success)
+  {
+    ZilchPrintAndFlush("#SUCCESS\n");
+  }
+  else
+  {
+    ZilchPrintAndFlush("#FAILED: The optimized opcode did not map to the same lines\n");
+    ZilchPauseInDebugger();
+  }
+
+  ZilchPrintAndFlush("#END\n\n");
+}
+
 void RunSanityTests()
 {
   // Create a scripting engine
@@ -215,49 +321,39 @@ void RunSanityTests()
   
     // Unit Tests
     {
-      Project project;
-      EventConnect(&project, Events::CompilationError, DefaultErrorCallback);
-
-      project.AddCodeFromFile("Test01.z", nullptr);
-      project.AddCodeFromFile("Test02.z", nullptr);
-      project.AddCodeFromFile("Test03.z", nullptr);
-      project.AddCodeFromFile("Test04.z", nullptr);
-      project.AddCodeFromFile("Test05.z", nullptr);
-      project.AddCodeFromFile("Test06.z", nullptr);
-      project.AddCodeFromFile("Test07.z", nullptr);
-      project.AddCodeFromFile("Test08.z", nullptr);
-      project.AddCodeFromFile("Test09.z", nullptr);
-      project.AddCodeFromFile("Test10.z", nullptr);
-      project.AddCodeFromFile("Test11.z", nullptr);
-      project.AddCodeFromFile("Test12.z", nullptr);
-
-      LibraryRef lib = project.Compile("UnitTests", dependencies, EvaluationMode::Project);
+      LibraryRef lib = CompileSanityUnitTests(dependencies, false);
       ErrorIf(lib == nullptr, "Unit test 'UnitTests' library did not compile");
 
       if (lib != nullptr)
       {
-        dependencies.PushBack(lib);
-        //auto html = dependencies.BuildDocumentationHtml();
+        Module unitTestDependencies = dependencies;
+        unitTestDependencies.PushBack(lib);
+        //auto html = unitTestDependencies.BuildDocumentationHtml();
 
-        ExecutableState* state = dependencies.Link();
+        ExecutableState* state = unitTestDependencies.Link();
         EventConnect(state, Events::UnhandledException, DefaultExceptionCallback);
         //StateCreated(state);
         ErrorIf(state == nullptr, "Unit tests did not link");
-        
-        UnitTest("UnitTest01", "Test01", Test01, state, CheckEqual<TypeOf(Test01())>);
-        UnitTest("UnitTest02", "Test02", Test02, state, CheckEqual<TypeOf(Test02())>);
-        UnitTest("UnitTest03", "Test03", Test03, state, CheckEqual<TypeOf(Test03())>);
-        UnitTest("UnitTest04", "Test04", Test04, state, CheckEqual<TypeOf(Test04())>);
-        UnitTest("UnitTest05", "Test05", Test05, state, CheckEqual<TypeOf(Test05())>);
-        UnitTest("UnitTest06", "Test06", Test06, state, CheckEqual<TypeOf(Test06())>);
-        UnitTest("UnitTest07", "Test07", Test07, state, CheckEqual<TypeOf(Test07())>);
-        UnitTest("UnitTest08", "Test08", Test08, state, CheckEqual<TypeOf(Test08())>);
-        UnitTest("UnitTest09", "Test09", Test09, state, CheckEqual<TypeOf(Test09())>);
-        UnitTest("UnitTest10", "Test10", Test10, state, CheckEqual<TypeOf(Test10())>);
-        UnitTest("UnitTest11", "Test11", Test11, state, CheckEqual<TypeOf(Test11())>);
-        UnitTest("UnitTest12", "Test12", Test12, state, CheckEqual<TypeOf(Test12())>);
-
+        RunSanityUnitTests(state);
         delete state;
+
+        // Run the exact same scripts again through the opcode optimizer, they must still produce the same results
+        LibraryRef optimizedLib = CompileSanityUnitTests(dependencies, true);
+        ErrorIf(optimizedLib == nullptr, "Unit test 'UnitTests' library did not compile with the opcode optimizer");
+
+        if (optimizedLib != nullptr)
+        {
+          CompareOptimizedLineMappings(lib, optimizedLib);
+
+          Module optimizedDependencies = dependencies;
+          optimizedDependencies.PushBack(optimizedLib);
+
+          ExecutableState* optimizedState = optimizedDependencies.Link();
+          EventConnect(optimizedState, Events::UnhandledException, DefaultExceptionCallback);
+          ErrorIf(optimizedState == nullptr, "Optimized unit tests did not link");
+          RunSanityUnitTests(optimizedState);
+          delete optimizedState;
+        }
       }
     }
   }
@@ -387,6 +483,11 @@ void RunDiffTests()
   EvaluateDiffs(DiffTest01, "DiffTest01");
 }
 
+void RunAllocatorTests()
+{
+  EvaluateDiffs(HeapSlabTest01, "HeapSlabTest01");
+}
+
 int ValueUnitTestConstantResult()
 {
   return 98234756;
@@ -544,6 +645,7 @@ int main()
 
   //RunDiffTests();
   RunStressTests();
+  RunAllocatorTests();
   RunUnitTests();
   RunSanityTests();
   RunErrorTests();
@@ -1087,7 +1087,9 @@ namespace Zilch
         ZilchTodo("We MUST respect the HeapManagerExtraPatchSize to make sure we don't go outside! What do we do in that case though... fail patching?");
 
         // Loop through all heap objects and check if any of them are the old type
-        ZilchForEach(const byte* object, this->HeapObjects->LiveObjects)
+        Array<const byte*> liveObjects;
+        this->HeapObjects->GetLiveObjects(liveObjects);
+        ZilchForEach(const byte* object, liveObjects)
         {
           // Just behind the allocated object is the header
           ObjectHeader& header = *(ObjectHeader*)(object - sizeof(ObjectHeader));
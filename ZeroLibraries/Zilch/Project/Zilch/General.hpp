@@ -71,6 +71,12 @@ namespace Zilch
     #define ZilchSupportsThreadLocalStorage
   #endif
 
+  // Labels as values (computed goto) are supported by Clang and Gcc, but not by MSVC
+  // The virtual machine uses them to jump directly from one instruction to the next
+  #if defined(__clang__) || defined(__GNUC__)
+    #define ZilchSupportsComputedGoto
+  #endif
+
   // If we're running 0x features in gcc, or the C++ version is defined, or we're in VS2010 or later...
   #if defined(__GXX_EXPERIMENTAL_CXX0X__) ||  __cplusplus >= 201103L || _MSC_VER >= 1600
     #define ZilchSupportsDecltypeAuto
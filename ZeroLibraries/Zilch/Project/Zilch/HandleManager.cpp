@@ -235,7 +235,7 @@ namespace Zilch
     byte* object = ((byte*)data.Header) + sizeof(ObjectHeader);
 
     // First check if the object is even live
-    if (this->LiveObjects.Contains(object) == false)
+    if (this->Slabs.IsLive((byte*)data.Header) == false)
       return nullptr;
 
     // If the unique-ids for that slot don't match (it was reused)
@@ -255,7 +255,10 @@ namespace Zilch
     // 'ObjectToHandle' can recreate a handle via the slot data pointer
     size_t objectSize = type->GetAllocatedSize();
     size_t fullSize = sizeof(ObjectHeader) + objectSize + HeapManagerExtraPatchSize;
-    byte* memory = (byte*)Zero::zAllocate(fullSize);
+
+    // The slabs mark the memory as live and always give it back to us zeroed out
+    // (all primitives should support being zeroed out)
+    byte* memory = this->Slabs.Allocate(fullSize);
 
     // If the memory failed to allocate, early out
     if (memory == nullptr)
@@ -265,13 +268,6 @@ namespace Zilch
       return;
     }
 
-    // Make sure we mark this as a live object
-    byte* object = memory + sizeof(ObjectHeader);
-    this->LiveObjects.Insert(object);
-
-    // All primitives should support being zeroed out
-    memset(memory, 0, fullSize);
-
     // Store a pointer back to the slot on the memory itself
     ObjectHeader& header = *(ObjectHeader*)memory;
     header.Type = type;
@@ -304,7 +300,7 @@ namespace Zilch
     }
 
     // First, check if this object was even allocated through us
-    if (this->LiveObjects.Contains(object) == false)
+    if (this->IsLive(object) == false)
     {
       // Since the object that was passed in isn't managed by us, the only valid way to get a handle to it is to use the pointer manager
       // Most likely this will be fine since we're passing through binding and not typically invoking user code
@@ -345,31 +341,39 @@ namespace Zilch
     // Leak detection includes the stack frame of who allocated it
     // as well as all those still referencing it
 
-    while (this->LiveObjects.Empty() == false)
+    Array<const byte*> objects;
+    while (this->Slabs.GetLiveCount() != 0)
     {
-      // Just get the first object and attempt to free it
-      const byte* object = this->LiveObjects.All().Front();
-
-      // Just behind the allocated object is the header
-      ObjectHeader& header = *(ObjectHeader*)(object - sizeof(ObjectHeader));
-
-      // Create a temporary handle to point at the object
-      Handle handle(object, header.Type, this);
-
-      // Send out an event letting the user know that a memory leak occurred
-      MemoryLeakEvent toSend;
-      toSend.State = state;
-      toSend.LeakedObject = &handle;
-      EventSend(state, Events::MemoryLeak, &toSend);
-
-      // Delete the object forcibly
-      // Note that this Delete should call HeapManager::Delete, which will remove this from LiveObjects!
-      bool deleted = handle.Delete();
-      ErrorIf(deleted != true,
-        "Delete on the handle returned that the object was not deleted (it always should be deletable)");
+      objects.Clear();
+      this->GetLiveObjects(objects);
+
+      ZilchForEach(const byte* object, objects)
+      {
+        // Deleting one object may have deleted others that it referenced
+        if (this->IsLive(object) == false)
+          continue;
+
+        // Just behind the allocated object is the header
+        ObjectHeader& header = *(ObjectHeader*)(object - sizeof(ObjectHeader));
+
+        // Create a temporary handle to point at the object
+        Handle handle(object, header.Type, this);
+
+        // Send out an event letting the user know that a memory leak occurred
+        MemoryLeakEvent toSend;
+        toSend.State = state;
+        toSend.LeakedObject = &handle;
+        EventSend(state, Events::MemoryLeak, &toSend);
+
+        // Delete the object forcibly
+        // Note that this Delete should call HeapManager::Delete, which will mark the object as no longer live!
+        bool deleted = handle.Delete();
+        ErrorIf(deleted != true,
+          "Delete on the handle returned that the object was not deleted (it always should be deletable)");
+      }
     }
 
-    ErrorIf(this->LiveObjects.Empty() == false,
+    ErrorIf(this->Slabs.GetLiveCount() != 0,
       "All objects should be cleared by this point");
   }
   
@@ -379,14 +383,28 @@ namespace Zilch
     // Get the associated slot
     HeapHandleData& data = *(HeapHandleData*)handle.Data;
 
-    // The pointer to the object is just after the header
-    byte* object = ((byte*)data.Header) + sizeof(ObjectHeader);
-    
-    // Remove the object from the list of live objects
-    this->LiveObjects.Erase(object);
+    // Giving the memory back to the slab also marks the object as no longer live
+    this->Slabs.Deallocate((byte*)data.Header);
+  }
+
+  //***************************************************************************
+  bool HeapManager::IsLive(const byte* object)
+  {
+    // Liveness is tracked by the header, which is just behind the object
+    return this->Slabs.IsLive(object - sizeof(ObjectHeader));
+  }
+
+  //***************************************************************************
+  void HeapManager::GetLiveObjects(Array<const byte*>& objectsOut)
+  {
+    Array<byte*> headers;
+    this->Slabs.GetLiveBlocks(headers);
 
-    // Delete the data in the slot and null it out
-    Zero::zDeallocate(data.Header);
+    objectsOut.Reserve(objectsOut.Size() + headers.Size());
+    ZilchForEach(byte* header, headers)
+    {
+      objectsOut.PushBack(header + sizeof(ObjectHeader));
+    }
   }
 
   //***************************************************************************
@@ -285,15 +285,21 @@ namespace Zilch
     void SetNativeTypeFullyConstructed(const Handle& handle, bool value) override;
     bool GetNativeTypeFullyConstructed(const Handle& handle) override;
 
+    // Checks if an object was allocated by us and has not yet been deleted (this is NOT a pointer to the header)
+    bool IsLive(const byte* object);
+
+    // Collects pointers to every live object (not the header)
+    void GetLiveObjects(Array<const byte*>& objectsOut);
+
     // A unique ID counter (so we can Assign objects unique IDs...)
     Uid UidCount;
 
-    // When we validate a handle, we first check if the object is live (this is NOT a pointer to the header)
+    // When we validate a handle, we first check if the object is live (the slab that the header lives in knows)
     // Because a completely different object could have been allocated in the exact same place (pointer)
     // then we also have to check the version stored in the handle against the version in the object's header
-    // If the pointer given to 'ObjectToHandle' does not exist here, we implicitly allocate a new object and
+    // If the pointer given to 'ObjectToHandle' is not live here, we implicitly allocate a new object and
     // invoke the copy constructor on the object
-    HashSet<const byte*> LiveObjects;
+    HeapSlabAllocator Slabs;
   };
 
   // The structure of our stack handle's inner data
@@ -0,0 +1,374 @@
+/**************************************************************\
+* Copyright 2017, DigiPen Institute of Technology
+\**************************************************************/
+
+#include "Zilch.hpp"
+
+namespace Zilch
+{
+  // The number of bits in each word of a slab's live bitmap
+  static const size_t LiveBitsPerWord = sizeof(size_t) * 8;
+
+  // The memory statistics of every slab allocator (these mirror Zero::Memory::Stats)
+  // Allocators on different threads all add to these, so every counter is atomic
+  struct HeapSlabStats
+  {
+    Zero::Atomic<Zero::MemCounterType> Allocations;
+    Zero::Atomic<Zero::MemCounterType> Active;
+    Zero::Atomic<Zero::MemCounterType> BytesAllocated;
+    Zero::Atomic<Zero::MemCounterType> BytesDedicated;
+    Zero::Atomic<Zero::MemCounterType> PeakAllocated;
+  };
+  static HeapSlabStats SlabStats;
+
+  //***************************************************************************
+  static void StatsAddAllocation(size_t bytes)
+  {
+    ++SlabStats.Active;
+    ++SlabStats.Allocations;
+    Zero::MemCounterType allocated = SlabStats.BytesAllocated.FetchAdd(bytes) + bytes;
+
+    // Raise the peak, unless another thread already raised it past us
+    Zero::MemCounterType peak = SlabStats.PeakAllocated;
+    while (allocated > peak && SlabStats.PeakAllocated.CompareExchangeBool(allocated, peak) == false)
+      peak = SlabStats.PeakAllocated;
+  }
+
+  //***************************************************************************
+  static void StatsRemoveAllocation(size_t bytes)
+  {
+    --SlabStats.Active;
+    SlabStats.BytesAllocated.FetchSubtract(bytes);
+  }
+
+  //***************************************************************************
+  static void StatsAddDedicated(size_t bytes)
+  {
+    SlabStats.BytesDedicated.FetchAdd(bytes);
+  }
+
+  //***************************************************************************
+  static void StatsRemoveDedicated(size_t bytes)
+  {
+    SlabStats.BytesDedicated.FetchSubtract(bytes);
+  }
+
+  //***************************************************************************
+  HeapSlab::HeapSlab() :
+    Memory(nullptr),
+    BlockSize(0),
+    BlockCount(0),
+    LiveCount(0),
+    SizeClass(0),
+    HasFreeBlocks(false),
+    FreeList(nullptr)
+  {
+  }
+
+  //***************************************************************************
+  bool HeapSlab::Contains(const byte* block) const
+  {
+    return block >= this->Memory && block < this->Memory + this->BlockSize * this->BlockCount;
+  }
+
+  //***************************************************************************
+  HeapSlabAllocator::HeapSlabAllocator() :
+    LiveCount(0)
+  {
+  }
+
+  //***************************************************************************
+  HeapSlabAllocator::~HeapSlabAllocator()
+  {
+    ErrorIf(this->LiveCount != 0,
+      "All heap objects should have been deleted before the allocator is destroyed");
+
+    // Give back any memory we're still holding onto (normally just the empty slabs we kept around)
+    ZilchForEach(HeapSlab* slab, this->SortedSlabs)
+    {
+      StatsRemoveDedicated(slab->BlockSize * slab->BlockCount);
+      Zero::zDeallocate(slab->Memory);
+      delete slab;
+    }
+
+    ZilchForEach(LargeBlockMap::pair& pair, this->LargeBlocks)
+    {
+      StatsRemoveAllocation(pair.second);
+      StatsRemoveDedicated(pair.second);
+      Zero::zDeallocate((byte*)pair.first);
+    }
+  }
+
+  //***************************************************************************
+  size_t HeapSlabAllocator::GetSizeClass(size_t size)
+  {
+    if (size > HeapSlabMaxBlockSize)
+      return HeapSlabClassCount;
+
+    // We never get asked for zero bytes since the object header is always allocated
+    return (size + HeapSlabGranularity - 1) / HeapSlabGranularity - 1;
+  }
+
+  //***************************************************************************
+  byte* HeapSlabAllocator::Allocate(size_t size)
+  {
+    size_t sizeClass = GetSizeClass(size);
+
+    // Large objects are rare, so they just go straight to the system allocator
+    if (sizeClass == HeapSlabClassCount)
+    {
+      byte* block = (byte*)Zero::zAllocate(size);
+      if (block == nullptr)
+        return nullptr;
+
+      memset(block, 0, size);
+      this->LargeBlocks.Insert(block, size);
+      StatsAddDedicated(size);
+      StatsAddAllocation(size);
+      ++this->LiveCount;
+      return block;
+    }
+
+    // Grab any slab of this size class that still has room (or make a new one)
+    Array<HeapSlab*>& freeSlabs = this->FreeSlabs[sizeClass];
+    HeapSlab* slab = nullptr;
+    if (freeSlabs.Empty())
+      slab = this->CreateSlab(sizeClass);
+    else
+      slab = freeSlabs.Back();
+
+    if (slab == nullptr)
+      return nullptr;
+
+    // Pop a block off the slab's free list
+    byte* block = slab->FreeList;
+    slab->FreeList = *(byte**)block;
+
+    // Mark the block as live
+    size_t index = (block - slab->Memory) / slab->BlockSize;
+    slab->LiveBits[index / LiveBitsPerWord] |= ((size_t)1 << (index % LiveBitsPerWord));
+    ++slab->LiveCount;
+    ++this->LiveCount;
+
+    // If the slab is now full then it can't be used for the next allocation
+    if (slab->LiveCount == slab->BlockCount)
+    {
+      freeSlabs.PopBack();
+      slab->HasFreeBlocks = false;
+    }
+
+    memset(block, 0, slab->BlockSize);
+    StatsAddAllocation(slab->BlockSize);
+    return block;
+  }
+
+  //***************************************************************************
+  void HeapSlabAllocator::Deallocate(byte* block)
+  {
+    HeapSlab* slab = this->FindSlab(block);
+
+    // If the block wasn't in a slab, it must have been a large block
+    if (slab == nullptr)
+    {
+      size_t size = this->LargeBlocks.FindValue(block, 0);
+      ErrorIf(size == 0, "The block being deallocated was never allocated by this allocator");
+      if (size == 0)
+        return;
+
+      this->LargeBlocks.Erase(block);
+      StatsRemoveAllocation(size);
+      StatsRemoveDedicated(size);
+      --this->LiveCount;
+      Zero::zDeallocate(block);
+      return;
+    }
+
+    size_t index = (block - slab->Memory) / slab->BlockSize;
+    size_t& word = slab->LiveBits[index / LiveBitsPerWord];
+    size_t bit = ((size_t)1 << (index % LiveBitsPerWord));
+    ErrorIf((word & bit) == 0, "The block being deallocated is not live (was it deleted twice?)");
+    word &= ~bit;
+
+#ifdef ZeroDebug
+    // 0xFAFAFAFA is our own byte pattern used to show that we deallocated the memory, but have not
+    // yet released it to the os (this is the same pattern as the memory pools)
+    memset(block, 0xFA, slab->BlockSize);
+#endif
+
+    // Push the block back on the slab's free list
+    *(byte**)block = slab->FreeList;
+    slab->FreeList = block;
+    --slab->LiveCount;
+    --this->LiveCount;
+    StatsRemoveAllocation(slab->BlockSize);
+
+    Array<HeapSlab*>& freeSlabs = this->FreeSlabs[slab->SizeClass];
+
+    // If the slab was full, it now has room again
+    if (slab->HasFreeBlocks == false)
+    {
+      freeSlabs.PushBack(slab);
+      slab->HasFreeBlocks = true;
+    }
+
+    // Once a slab is completely empty we give it back, unless it's the last slab of its size class
+    // (this keeps us from repeatedly creating and destroying a slab when one object is created and destroyed in a loop)
+    if (slab->LiveCount == 0 && freeSlabs.Size() > 1)
+      this->DestroySlab(slab);
+  }
+
+  //***************************************************************************
+  bool HeapSlabAllocator::IsLive(const byte* block)
+  {
+    HeapSlab* slab = this->FindSlab(block);
+
+    // The pointer isn't in any of our slabs, so it's only live if it's a large block
+    if (slab == nullptr)
+      return this->LargeBlocks.Empty() == false && this->LargeBlocks.ContainsKey(block);
+
+    // The pointer must be at the very start of a block
+    size_t offset = block - slab->Memory;
+    if (offset % slab->BlockSize != 0)
+      return false;
+
+    size_t index = offset / slab->BlockSize;
+    return (slab->LiveBits[index / LiveBitsPerWord] & ((size_t)1 << (index % LiveBitsPerWord))) != 0;
+  }
+
+  //***************************************************************************
+  void HeapSlabAllocator::GetLiveBlocks(Array<byte*>& blocksOut)
+  {
+    blocksOut.Reserve(blocksOut.Size() + this->LiveCount);
+
+    ZilchForEach(HeapSlab* slab, this->SortedSlabs)
+    {
+      // Skip slabs that have nothing in them (we only keep one around per size class)
+      if (slab->LiveCount == 0)
+        continue;
+
+      for (size_t i = 0; i < slab->LiveBits.Size(); ++i)
+      {
+        // Stop as soon as there are no more live blocks in the word
+        size_t word = slab->LiveBits[i];
+        size_t bitIndex = 0;
+        while (word != 0)
+        {
+          if (word & 1)
+            blocksOut.PushBack(slab->Memory + (i * LiveBitsPerWord + bitIndex) * slab->BlockSize);
+
+          word >>= 1;
+          ++bitIndex;
+        }
+      }
+    }
+
+    ZilchForEach(LargeBlockMap::pair& pair, this->LargeBlocks)
+    {
+      blocksOut.PushBack((byte*)pair.first);
+    }
+  }
+
+  //***************************************************************************
+  size_t HeapSlabAllocator::GetLiveCount()
+  {
+    return this->LiveCount;
+  }
+
+  //***************************************************************************
+  size_t HeapSlabAllocator::GetSlabCount()
+  {
+    return this->SortedSlabs.Size();
+  }
+
+  //***************************************************************************
+  void HeapSlabAllocator::UpdateMemoryStats()
+  {
+    static Zero::Memory::Graph* memoryNode = Zero::Memory::GetNamedHeap("ZilchHeap");
+
+    // We're the only one that writes to this node, so the totals simply replace what was there
+    Zero::Memory::Stats& stats = memoryNode->mData;
+    stats.Allocations = SlabStats.Allocations;
+    stats.Active = SlabStats.Active;
+    stats.BytesAllocated = SlabStats.BytesAllocated;
+    stats.BytesDedicated = SlabStats.BytesDedicated;
+    stats.PeakAllocated = SlabStats.PeakAllocated;
+  }
+
+  //***************************************************************************
+  HeapSlab* HeapSlabAllocator::FindSlab(const byte* block)
+  {
+    // Binary search for the last slab that starts at or before the pointer
+    size_t begin = 0;
+    size_t end = this->SortedSlabs.Size();
+    while (begin < end)
+    {
+      size_t middle = begin + (end - begin) / 2;
+      if (this->SortedSlabs[middle]->Memory <= block)
+        begin = middle + 1;
+      else
+        end = middle;
+    }
+
+    // No slab starts before the pointer
+    if (begin == 0)
+      return nullptr;
+
+    HeapSlab* slab = this->SortedSlabs[begin - 1];
+    if (slab->Contains(block) == false)
+      return nullptr;
+
+    return slab;
+  }
+
+  //***************************************************************************
+  HeapSlab* HeapSlabAllocator::CreateSlab(size_t sizeClass)
+  {
+    size_t blockSize = (sizeClass + 1) * HeapSlabGranularity;
+    size_t blockCount = HeapSlabPageSize / blockSize;
+    size_t slabSize = blockSize * blockCount;
+
+    byte* memory = (byte*)Zero::zAllocate(slabSize);
+    if (memory == nullptr)
+      return nullptr;
+
+    HeapSlab* slab = new HeapSlab();
+    slab->Memory = memory;
+    slab->BlockSize = blockSize;
+    slab->BlockCount = blockCount;
+    slab->SizeClass = sizeClass;
+    slab->HasFreeBlocks = true;
+    slab->LiveBits.Resize((blockCount + LiveBitsPerWord - 1) / LiveBitsPerWord, 0);
+
+    // Thread every block onto the free list (in reverse so we hand out the lowest addresses first)
+    for (size_t i = blockCount; i > 0; --i)
+    {
+      byte* block = memory + (i - 1) * blockSize;
+      *(byte**)block = slab->FreeList;
+      slab->FreeList = block;
+    }
+
+    // Insert the slab so that the slabs stay sorted by their memory address
+    size_t insertIndex = this->SortedSlabs.Size();
+    while (insertIndex > 0 && this->SortedSlabs[insertIndex - 1]->Memory > memory)
+      --insertIndex;
+    this->SortedSlabs.InsertAt(insertIndex, slab);
+
+    this->FreeSlabs[sizeClass].PushBack(slab);
+    StatsAddDedicated(slabSize);
+    return slab;
+  }
+
+  //***************************************************************************
+  void HeapSlabAllocator::DestroySlab(HeapSlab* slab)
+  {
+    ErrorIf(slab->LiveCount != 0, "Only empty slabs can be destroyed");
+
+    // Slabs that have room are always in the free list for their size class
+    this->FreeSlabs[slab->SizeClass].EraseValueError(slab);
+    this->SortedSlabs.EraseValueError(slab);
+
+    StatsRemoveDedicated(slab->BlockSize * slab->BlockCount);
+    Zero::zDeallocate(slab->Memory);
+    delete slab;
+  }
+}
@@ -0,0 +1,125 @@
+/**************************************************************\
+* Copyright 2017, DigiPen Institute of Technology
+\**************************************************************/
+
+#pragma once
+#ifndef ZILCH_HEAP_SLAB_ALLOCATOR_HPP
+#define ZILCH_HEAP_SLAB_ALLOCATOR_HPP
+
+namespace Zilch
+{
+  // Every block size is rounded up to a multiple of this
+  const size_t HeapSlabGranularity = 64;
+
+  // Blocks larger than this are not put in slabs and are allocated directly
+  const size_t HeapSlabMaxBlockSize = 2048;
+
+  // The size of the memory page that each slab divides into blocks
+  const size_t HeapSlabPageSize = 32768;
+
+  // The number of size classes (each class is a multiple of the granularity)
+  const size_t HeapSlabClassCount = HeapSlabMaxBlockSize / HeapSlabGranularity;
+
+  // A single page of memory divided into blocks of the same size
+  class ZeroShared HeapSlab
+  {
+  public:
+    // Constructor
+    HeapSlab();
+
+    // Checks if a pointer is within the memory of this slab
+    bool Contains(const byte* block) const;
+
+    // The memory of the slab (BlockSize * BlockCount bytes)
+    byte* Memory;
+
+    // The size of every block and how many blocks fit in the slab
+    size_t BlockSize;
+    size_t BlockCount;
+
+    // How many of the blocks currently hold live objects
+    size_t LiveCount;
+
+    // The size class this slab belongs to
+    size_t SizeClass;
+
+    // Whether this slab is in its size class's list of slabs with free blocks
+    bool HasFreeBlocks;
+
+    // Free blocks are kept in an intrusive list (the next pointer is stored in the block)
+    byte* FreeList;
+
+    // One bit per block, set when the block holds a live object
+    Array<size_t> LiveBits;
+  };
+
+  // Allocates the memory for heap objects out of size classed slabs
+  // Liveness of a block is tracked by the bitmap of the slab it lives in (rather than a set of every object),
+  // so we can still validate any pointer, even one that was never allocated by us
+  // Every executable state owns its own allocator, and because a state only ever runs on one thread
+  // the slabs never need to be locked
+  // Memory statistics of every allocator are summed with atomics (states on different threads share them),
+  // and are only copied into the 'ZilchHeap' memory graph node by UpdateMemoryStats, where the dedicated
+  // bytes are the slab pages we're holding onto and the allocated bytes are the blocks that hold live objects
+  class ZeroShared HeapSlabAllocator
+  {
+  public:
+    // Constructor / destructor
+    HeapSlabAllocator();
+    ~HeapSlabAllocator();
+
+    // Allocates a block of at least the given size (the block is zeroed)
+    byte* Allocate(size_t size);
+
+    // Frees a block that was returned from Allocate
+    void Deallocate(byte* block);
+
+    // Checks if the pointer is the start of a block that is currently allocated
+    // This is safe to call with any pointer
+    bool IsLive(const byte* block);
+
+    // Collects every block that is currently allocated
+    void GetLiveBlocks(Array<byte*>& blocksOut);
+
+    // How many blocks are currently allocated
+    size_t GetLiveCount();
+
+    // How many slabs we're currently holding onto
+    size_t GetSlabCount();
+
+    // Copies the summed statistics of every allocator into the 'ZilchHeap' memory graph node
+    // The memory graph isn't thread safe, so this should only be called from the main thread
+    static void UpdateMemoryStats();
+
+  private:
+
+    // Get the size class for a block size (or HeapSlabClassCount if it's too large for a slab)
+    static size_t GetSizeClass(size_t size);
+
+    // Finds the slab that contains a pointer (or null if no slab does)
+    HeapSlab* FindSlab(const byte* block);
+
+    // Allocates a new slab for a size class and adds it to the free slabs for that class
+    HeapSlab* CreateSlab(size_t sizeClass);
+
+    // Removes an empty slab and gives its memory back
+    void DestroySlab(HeapSlab* slab);
+
+  private:
+
+    // All slabs, sorted by the address of their memory so we can binary search a pointer
+    Array<HeapSlab*> SortedSlabs;
+
+    // For each size class, the slabs that have at least one free block
+    Array<HeapSlab*> FreeSlabs[HeapSlabClassCount];
+
+    // Blocks that are too large for a slab are allocated directly and tracked here (along with their size)
+    typedef HashMap<const byte*, size_t> LargeBlockMap;
+    LargeBlockMap LargeBlocks;
+
+    // How many blocks are live (including large blocks)
+    size_t LiveCount;
+  };
+}
+
+#endif
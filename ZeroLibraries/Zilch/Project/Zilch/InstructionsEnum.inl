@@ -74,6 +74,16 @@
   ZilchEnumValue(AssignmentBitwiseXor##Type)      \
   ZilchEnumValue(AssignmentBitwiseAnd##Type)
 
+// A comparison fused with the IfFalseRelativeGoTo that reads its result
+// These are never generated directly, only by the OpcodeOptimizer
+#define ZilchCompareJumpInstructions(Type)                          \
+  ZilchEnumValue(TestInequality##Type##IfFalseRelativeGoTo)         \
+  ZilchEnumValue(TestEquality##Type##IfFalseRelativeGoTo)           \
+  ZilchEnumValue(TestLessThan##Type##IfFalseRelativeGoTo)           \
+  ZilchEnumValue(TestLessThanOrEqualTo##Type##IfFalseRelativeGoTo)  \
+  ZilchEnumValue(TestGreaterThan##Type##IfFalseRelativeGoTo)        \
+  ZilchEnumValue(TestGreaterThanOrEqualTo##Type##IfFalseRelativeGoTo)
+
 
 // Core instructions
 ZilchEnumValue(InvalidInstruction)
@@ -203,3 +213,7 @@ ZilchEnumValue(ConvertToAny)
 ZilchEnumValue(ConvertFromAny)
 ZilchEnumValue(AnyDynamicMemberGet)
 ZilchEnumValue(AnyDynamicMemberSet)
+
+// Superinstructions (kept last so the other instructions never change value)
+ZilchCompareJumpInstructions(Integer)
+ZilchCompareJumpInstructions(Real)
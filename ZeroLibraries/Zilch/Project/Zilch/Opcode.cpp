@@ -125,6 +125,33 @@ namespace Zilch
       DebugInstruction& info = debugOut[Instruction::RelativeGoTo];
       info.OpcodeOffsets.PushBack(offsetof(RelativeJumpOpcode, JumpOffset));
     }
+
+    // Compare and IfFalseRelativeGoTo superinstructions
+    {
+      // The instruction list macro (from InstructionsEnum) expands to each instruction's name
+      #define ZilchEnumValue(Name) Instruction::Name,
+      Instruction::Enum integerInstructions[] = { ZilchCompareJumpInstructions(Integer) };
+      Instruction::Enum realInstructions[] = { ZilchCompareJumpInstructions(Real) };
+      #undef ZilchEnumValue
+
+      for (size_t i = 0; i < ZilchCArrayCount(integerInstructions); ++i)
+      {
+        DebugInstruction& info = debugOut[integerInstructions[i]];
+        ZilchOperand(info.ReadOperands, CompareJumpOpcode, Left, DebugPrimitive::Integer, false);
+        ZilchOperand(info.ReadOperands, CompareJumpOpcode, Right, DebugPrimitive::Integer, false);
+        ZilchOperand(info.WriteOperands, CompareJumpOpcode, Output, DebugPrimitive::Boolean, true);
+        info.OpcodeOffsets.PushBack(offsetof(CompareJumpOpcode, JumpOffset));
+      }
+
+      for (size_t i = 0; i < ZilchCArrayCount(realInstructions); ++i)
+      {
+        DebugInstruction& info = debugOut[realInstructions[i]];
+        ZilchOperand(info.ReadOperands, CompareJumpOpcode, Left, DebugPrimitive::Real, false);
+        ZilchOperand(info.ReadOperands, CompareJumpOpcode, Right, DebugPrimitive::Real, false);
+        ZilchOperand(info.WriteOperands, CompareJumpOpcode, Output, DebugPrimitive::Boolean, true);
+        info.OpcodeOffsets.PushBack(offsetof(CompareJumpOpcode, JumpOffset));
+      }
+    }
     
     // PrepForFunctionCall
     {
@@ -191,6 +191,20 @@ namespace Zilch
     ByteCodeOffset JumpOffset;
   };
 
+  // Opcode for a comparison that is fused with the if-instruction after it
+  class ZeroShared CompareJumpOpcode : public Opcode
+  {
+  public:
+    Operand Left;
+    Operand Right;
+
+    // The result of the comparison is still written out in case anyone else reads it
+    OperandLocal Output;
+
+    // Where we jump to if the comparison was false (relative to this opcode)
+    ByteCodeOffset JumpOffset;
+  };
+
   // Opcode for the relative jump instruction
   class ZeroShared RelativeJumpOpcode : public Opcode
   {
@@ -0,0 +1,971 @@
+/**************************************************************\
+* Copyright 2017, DigiPen Institute of Technology
+\**************************************************************/
+
+#include "Zilch.hpp"
+
+namespace Zilch
+{
+  //***************************************************************************
+  InstructionInfo::InstructionInfo() :
+    Layout(OperandLayout::Unknown),
+    LeftSize(0),
+    RightSize(0),
+    OperandCopy(Instruction::InvalidInstruction),
+    OutputCopy(Instruction::InvalidInstruction)
+  {
+  }
+
+  //***************************************************************************
+  OptimizerOpcode::OptimizerOpcode() :
+    OriginalOffset(0),
+    NewOffset(0),
+    JumpTarget(OpcodeOptimizer::NoJump),
+    IsJumpTarget(false),
+    Removed(false)
+  {
+  }
+
+  //***************************************************************************
+  Instruction::Enum OptimizerOpcode::GetInstruction()
+  {
+    return (Instruction::Enum)this->As<Opcode>().Instruction;
+  }
+
+  // Note: These macros mirror those inside of InstructionEnum and VirtualMachine
+
+  // Operations on scalars that we fully understand (and can fold into copies)
+  #define ZilchScalarBinaryInfo(Name, Type, ResultType)                                                   \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::BinaryRValue, sizeof(Type), sizeof(Type),       \
+      Instruction::Copy##Type, Instruction::Copy##ResultType);
+
+  #define ZilchScalarUnaryInfo(Name, Type)                                                                \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::UnaryRValue, sizeof(Type), 0,                   \
+      Instruction::Copy##Type, Instruction::Copy##Type);
+
+  #define ZilchScalarConversionInfo(FromType, ToType)                                                     \
+    this->SetInfo(Instruction::Convert##FromType##To##ToType, OperandLayout::Conversion,                  \
+      sizeof(FromType), 0, Instruction::Copy##FromType, Instruction::Copy##ToType);
+
+  // Operations where we only know what is read
+  #define ZilchBinaryInfo(Name, Type, RightType)                                                          \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::BinaryRValue, sizeof(Type), sizeof(RightType));
+
+  #define ZilchBinaryLValueInfo(Name, Type, RightType)                                                    \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::BinaryLValue, sizeof(Type), sizeof(RightType));
+
+  #define ZilchUnaryInfo(Name, Type)                                                                      \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::UnaryRValue, sizeof(Type), 0);
+
+  #define ZilchUnaryLValueInfo(Name, Type)                                                                \
+    this->SetInfo(Instruction::Name##Type, OperandLayout::UnaryLValue, sizeof(Type), 0);
+
+  #define ZilchConversionInfo(FromType, ToType)                                                           \
+    this->SetInfo(Instruction::Convert##FromType##To##ToType, OperandLayout::Conversion, sizeof(FromType), 0);
+
+  // Generic numeric operators, copy, equality (the scalar versions)
+  #define ZilchScalarNumericInfo(Type)                                                                    \
+    this->SetInfo(Instruction::Copy##Type, OperandLayout::Copy, 0, 0,                                     \
+      Instruction::Copy##Type, Instruction::Copy##Type);                                                  \
+    ZilchScalarBinaryInfo(TestInequality,           Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(TestEquality,             Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(TestLessThan,             Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(TestLessThanOrEqualTo,    Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(TestGreaterThan,          Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(TestGreaterThanOrEqualTo, Type, Boolean)                                        \
+    ZilchScalarBinaryInfo(Add,                      Type, Type)                                           \
+    ZilchScalarBinaryInfo(Subtract,                 Type, Type)                                           \
+    ZilchScalarBinaryInfo(Multiply,                 Type, Type)                                           \
+    ZilchScalarBinaryInfo(Divide,                   Type, Type)                                           \
+    ZilchScalarBinaryInfo(Modulo,                   Type, Type)                                           \
+    ZilchScalarBinaryInfo(Pow,                      Type, Type)                                           \
+    ZilchScalarUnaryInfo(Negate,                    Type)                                                 \
+    ZilchAssignmentInfo(Type, Type)
+
+  // Generic numeric operators, copy, equality (the vector versions)
+  #define ZilchVectorNumericInfo(Type, ScalarType)                                                        \
+    this->SetInfo(Instruction::Copy##Type, OperandLayout::Copy, 0, 0);                                    \
+    ZilchBinaryInfo(TestInequality,                 Type, Type)                                           \
+    ZilchBinaryInfo(TestEquality,                   Type, Type)                                           \
+    ZilchBinaryInfo(TestLessThan,                   Type, Type)                                           \
+    ZilchBinaryInfo(TestLessThanOrEqualTo,          Type, Type)                                           \
+    ZilchBinaryInfo(TestGreaterThan,                Type, Type)                                           \
+    ZilchBinaryInfo(TestGreaterThanOrEqualTo,       Type, Type)                                           \
+    ZilchBinaryInfo(Add,                            Type, Type)                                           \
+    ZilchBinaryInfo(Subtract,                       Type, Type)                                           \
+    ZilchBinaryInfo(Multiply,                       Type, Type)                                           \
+    ZilchBinaryInfo(Divide,                         Type, Type)                                           \
+    ZilchBinaryInfo(Modulo,                         Type, Type)                                           \
+    ZilchBinaryInfo(Pow,                            Type, Type)                                           \
+    ZilchBinaryInfo(ScalarMultiply,                 Type, ScalarType)                                     \
+    ZilchBinaryInfo(ScalarDivide,                   Type, ScalarType)                                     \
+    ZilchBinaryInfo(ScalarModulo,                   Type, ScalarType)                                     \
+    ZilchBinaryInfo(ScalarPow,                      Type, ScalarType)                                     \
+    ZilchBinaryLValueInfo(AssignmentScalarMultiply, Type, ScalarType)                                     \
+    ZilchBinaryLValueInfo(AssignmentScalarDivide,   Type, ScalarType)                                     \
+    ZilchBinaryLValueInfo(AssignmentScalarModulo,   Type, ScalarType)                                     \
+    ZilchBinaryLValueInfo(AssignmentScalarPow,      Type, ScalarType)                                     \
+    ZilchUnaryInfo(Negate,                          Type)                                                 \
+    ZilchAssignmentInfo(Type, Type)
+
+  // Compound assignment, increment and decrement
+  #define ZilchAssignmentInfo(Type, RightType)                                                            \
+    ZilchUnaryLValueInfo(Increment,                 Type)                                                 \
+    ZilchUnaryLValueInfo(Decrement,                 Type)                                                 \
+    ZilchBinaryLValueInfo(AssignmentAdd,            Type, RightType)                                      \
+    ZilchBinaryLValueInfo(AssignmentSubtract,       Type, RightType)                                      \
+    ZilchBinaryLValueInfo(AssignmentMultiply,       Type, RightType)                                      \
+    ZilchBinaryLValueInfo(AssignmentDivide,         Type, RightType)                                      \
+    ZilchBinaryLValueInfo(AssignmentModulo,         Type, RightType)                                      \
+    ZilchBinaryLValueInfo(AssignmentPow,            Type, RightType)
+
+  // Special integral operators
+  #define ZilchIntegralInfo(Type)                                                                         \
+    ZilchUnaryInfo(BitwiseNot,                      Type)                                                 \
+    ZilchBinaryInfo(BitshiftLeft,                   Type, Type)                                           \
+    ZilchBinaryInfo(BitshiftRight,                  Type, Type)                                           \
+    ZilchBinaryInfo(BitwiseOr,                      Type, Type)                                           \
+    ZilchBinaryInfo(BitwiseXor,                     Type, Type)                                           \
+    ZilchBinaryInfo(BitwiseAnd,                     Type, Type)                                           \
+    ZilchBinaryLValueInfo(AssignmentBitshiftLeft,   Type, Type)                                           \
+    ZilchBinaryLValueInfo(AssignmentBitshiftRight,  Type, Type)                                           \
+    ZilchBinaryLValueInfo(AssignmentBitwiseOr,      Type, Type)                                           \
+    ZilchBinaryLValueInfo(AssignmentBitwiseXor,     Type, Type)                                           \
+    ZilchBinaryLValueInfo(AssignmentBitwiseAnd,     Type, Type)
+
+  //***************************************************************************
+  OpcodeOptimizer::OpcodeOptimizer()
+  {
+    // By default every instruction is unknown
+    this->Infos.Resize(Instruction::Count);
+
+    // Instructions that never read a local
+    Instruction::Enum noReads[] =
+    {
+      Instruction::InternalDebugBreakpoint,
+      Instruction::BeginTimeout,
+      Instruction::EndTimeout,
+      Instruction::BeginScope,
+      Instruction::EndScope,
+      Instruction::BeginStringBuilder,
+      Instruction::EndStringBuilder,
+      Instruction::CreateStaticDelegate,
+      Instruction::RelativeGoTo,
+      Instruction::Return,
+      Instruction::FunctionCall,
+      Instruction::NewObject
+    };
+    for (size_t i = 0; i < ZilchCArrayCount(noReads); ++i)
+      this->SetInfo(noReads[i], OperandLayout::None, 0, 0);
+
+    // Instructions with special opcode classes
+    this->SetInfo(Instruction::IfFalseRelativeGoTo,     OperandLayout::If,                      sizeof(Boolean), 0, Instruction::CopyBoolean);
+    this->SetInfo(Instruction::IfTrueRelativeGoTo,      OperandLayout::If,                      sizeof(Boolean), 0, Instruction::CopyBoolean);
+    this->SetInfo(Instruction::PrepForFunctionCall,     OperandLayout::PrepForFunctionCall,     sizeof(Delegate), 0);
+    this->SetInfo(Instruction::CreateInstanceDelegate,  OperandLayout::CreateInstanceDelegate,  sizeof(Handle), 0);
+    this->SetInfo(Instruction::AddToStringBuilder,      OperandLayout::AddToStringBuilder,      0, 0);
+    this->SetInfo(Instruction::ThrowException,          OperandLayout::ThrowException,          sizeof(Handle), 0);
+    this->SetInfo(Instruction::DeleteObject,            OperandLayout::DeleteObject,            sizeof(Handle), 0);
+    this->SetInfo(Instruction::ConvertDowncast,         OperandLayout::Conversion,              sizeof(Handle), 0);
+    this->SetInfo(Instruction::ConvertFromAny,          OperandLayout::Conversion,              sizeof(Any), 0);
+
+    // Copies of types with destructors (we can read through them, but never remove them)
+    this->SetInfo(Instruction::CopyAny,       OperandLayout::Copy, 0, 0);
+    this->SetInfo(Instruction::CopyHandle,    OperandLayout::Copy, 0, 0);
+    this->SetInfo(Instruction::CopyDelegate,  OperandLayout::Copy, 0, 0);
+    this->SetInfo(Instruction::CopyValue,     OperandLayout::Copy, 0, 0);
+
+    // Primitive type instructions
+    ZilchScalarNumericInfo(Byte);
+    ZilchScalarNumericInfo(Integer);
+    ZilchScalarNumericInfo(Real);
+    ZilchScalarNumericInfo(DoubleInteger);
+    ZilchScalarNumericInfo(DoubleReal);
+    ZilchVectorNumericInfo(Integer2, Integer);
+    ZilchVectorNumericInfo(Integer3, Integer);
+    ZilchVectorNumericInfo(Integer4, Integer);
+    ZilchVectorNumericInfo(Real2, Real);
+    ZilchVectorNumericInfo(Real3, Real);
+    ZilchVectorNumericInfo(Real4, Real);
+    ZilchIntegralInfo(Byte);
+    ZilchIntegralInfo(Integer);
+    ZilchIntegralInfo(Integer2);
+    ZilchIntegralInfo(Integer3);
+    ZilchIntegralInfo(Integer4);
+    ZilchIntegralInfo(DoubleInteger);
+
+    this->SetInfo(Instruction::CopyBoolean, OperandLayout::Copy, 0, 0, Instruction::CopyBoolean, Instruction::CopyBoolean);
+    ZilchScalarBinaryInfo(TestInequality, Boolean, Boolean);
+    ZilchScalarBinaryInfo(TestEquality, Boolean, Boolean);
+    ZilchScalarUnaryInfo(LogicalNot, Boolean);
+    ZilchBinaryInfo(TestInequality, Handle, Handle);
+    ZilchBinaryInfo(TestEquality, Handle, Handle);
+    ZilchBinaryInfo(TestInequality, Delegate, Delegate);
+    ZilchBinaryInfo(TestEquality, Delegate, Delegate);
+    ZilchBinaryInfo(TestInequality, Any, Any);
+    ZilchBinaryInfo(TestEquality, Any, Any);
+
+    ZilchScalarConversionInfo(Byte, Real);
+    ZilchScalarConversionInfo(Byte, Boolean);
+    ZilchScalarConversionInfo(Byte, Integer);
+    ZilchScalarConversionInfo(Byte, DoubleInteger);
+    ZilchScalarConversionInfo(Byte, DoubleReal);
+    ZilchScalarConversionInfo(Integer, Real);
+    ZilchScalarConversionInfo(Integer, Boolean);
+    ZilchScalarConversionInfo(Integer, Byte);
+    ZilchScalarConversionInfo(Integer, DoubleInteger);
+    ZilchScalarConversionInfo(Integer, DoubleReal);
+    ZilchScalarConversionInfo(Real, Integer);
+    ZilchScalarConversionInfo(Real, Boolean);
+    ZilchScalarConversionInfo(Real, Byte);
+    ZilchScalarConversionInfo(Real, DoubleInteger);
+    ZilchScalarConversionInfo(Real, DoubleReal);
+    ZilchScalarConversionInfo(Boolean, Integer);
+    ZilchScalarConversionInfo(Boolean, Real);
+    ZilchScalarConversionInfo(Boolean, Byte);
+    ZilchScalarConversionInfo(Boolean, DoubleInteger);
+    ZilchScalarConversionInfo(Boolean, DoubleReal);
+    ZilchScalarConversionInfo(DoubleInteger, Real);
+    ZilchScalarConversionInfo(DoubleInteger, Boolean);
+    ZilchScalarConversionInfo(DoubleInteger, Byte);
+    ZilchScalarConversionInfo(DoubleInteger, Integer);
+    ZilchScalarConversionInfo(DoubleInteger, DoubleReal);
+    ZilchScalarConversionInfo(DoubleReal, Real);
+    ZilchScalarConversionInfo(DoubleReal, Boolean);
+    ZilchScalarConversionInfo(DoubleReal, Byte);
+    ZilchScalarConversionInfo(DoubleReal, Integer);
+    ZilchScalarConversionInfo(DoubleReal, DoubleInteger);
+
+    ZilchConversionInfo(Integer2, Real2);
+    ZilchConversionInfo(Integer2, Boolean2);
+    ZilchConversionInfo(Real2, Integer2);
+    ZilchConversionInfo(Real2, Boolean2);
+    ZilchConversionInfo(Boolean2, Integer2);
+    ZilchConversionInfo(Boolean2, Real2);
+    ZilchConversionInfo(Integer3, Real3);
+    ZilchConversionInfo(Integer3, Boolean3);
+    ZilchConversionInfo(Real3, Integer3);
+    ZilchConversionInfo(Real3, Boolean3);
+    ZilchConversionInfo(Boolean3, Integer3);
+    ZilchConversionInfo(Boolean3, Real3);
+    ZilchConversionInfo(Integer4, Real4);
+    ZilchConversionInfo(Integer4, Boolean4);
+    ZilchConversionInfo(Real4, Integer4);
+    ZilchConversionInfo(Real4, Boolean4);
+    ZilchConversionInfo(Boolean4, Integer4);
+    ZilchConversionInfo(Boolean4, Real4);
+
+    // The superinstructions read the same operands as the comparison they came from
+    #define ZilchEnumValue(Name) this->SetInfo(Instruction::Name, OperandLayout::BinaryRValue, sizeof(Integer), sizeof(Integer));
+    ZilchCompareJumpInstructions(Integer)
+    #undef ZilchEnumValue
+    #define ZilchEnumValue(Name) this->SetInfo(Instruction::Name, OperandLayout::BinaryRValue, sizeof(Real), sizeof(Real));
+    ZilchCompareJumpInstructions(Real)
+    #undef ZilchEnumValue
+  }
+
+  #undef ZilchScalarBinaryInfo
+  #undef ZilchScalarUnaryInfo
+  #undef ZilchScalarConversionInfo
+  #undef ZilchBinaryInfo
+  #undef ZilchBinaryLValueInfo
+  #undef ZilchUnaryInfo
+  #undef ZilchUnaryLValueInfo
+  #undef ZilchConversionInfo
+  #undef ZilchScalarNumericInfo
+  #undef ZilchVectorNumericInfo
+  #undef ZilchAssignmentInfo
+  #undef ZilchIntegralInfo
+
+  //***************************************************************************
+  void OpcodeOptimizer::SetInfo
+  (
+    Instruction::Enum instruction,
+    OperandLayout::Enum layout,
+    size_t leftSize,
+    size_t rightSize,
+    Instruction::Enum operandCopy,
+    Instruction::Enum outputCopy
+  )
+  {
+    InstructionInfo& info = this->Infos[instruction];
+    info.Layout = layout;
+    info.LeftSize = leftSize;
+    info.RightSize = rightSize;
+    info.OperandCopy = operandCopy;
+    info.OutputCopy = outputCopy;
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::Optimize(Library* library)
+  {
+    // Walk through all the functions that were compiled into the library
+    for (size_t i = 0; i < library->OwnedFunctions.Size(); ++i)
+    {
+      // Native functions and functions without code have no opcode to optimize
+      Function* function = library->OwnedFunctions[i];
+      if (function->CompactedOpcode.Empty())
+        continue;
+
+      this->Optimize(function);
+    }
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::Optimize(Function* function)
+  {
+    // If we couldn't make sense of the function's jumps, then leave it alone
+    if (this->Decode(function) == false)
+      return;
+
+    // Folding constants and fusing compares only look at adjacent opcodes, so they're always safe
+    this->FoldConstants(function);
+
+    // Removing a temporary requires that we know every place it's read from
+    if (this->CollectReads(function))
+    {
+      this->PropagateCopies(function);
+      this->RemoveDeadTemporaries(function);
+    }
+
+    this->FuseCompareJumps();
+
+    // Write the optimized opcode back to the function
+    this->Encode(function);
+  }
+
+  //***************************************************************************
+  bool OpcodeOptimizer::Decode(Function* function)
+  {
+    this->Opcodes.Clear();
+    this->Reads.Clear();
+
+    Array<size_t>& indices = function->OpcodeCompactedIndices;
+    size_t opcodeSize = function->CompactedOpcode.Size();
+
+    // We need to map offsets back to opcodes so we can find jump targets
+    HashMap<size_t, size_t> offsetToIndex;
+
+    // Copy every opcode out of the compacted opcode
+    for (size_t i = 0; i < indices.Size(); ++i)
+    {
+      size_t start = indices[i];
+      size_t end = (i + 1 < indices.Size()) ? indices[i + 1] : opcodeSize;
+
+      OptimizerOpcode& opcode = this->Opcodes.PushBack();
+      opcode.OriginalOffset = start;
+      opcode.Data.Resize(end - start);
+      memcpy(opcode.Data.Data(), function->CompactedOpcode.Data() + start, end - start);
+
+      // Every opcode should have a location, but if not we just won't map one
+      CodeLocation* location = function->OpcodeLocationToCodeLocation.FindPointer(start);
+      if (location != nullptr)
+        opcode.Location = *location;
+
+      offsetToIndex.Insert(start, i);
+    }
+
+    // Jumping to the very end of the function is the same as returning
+    offsetToIndex.Insert(opcodeSize, this->Opcodes.Size());
+
+    // Resolve all the jumps to the opcode they point at
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      ByteCodeOffset* jumpOffset = this->GetJumpOffset(opcode);
+      if (jumpOffset == nullptr)
+        continue;
+
+      // If a jump lands anywhere other than the start of an opcode, we don't understand this function
+      size_t* targetIndex = offsetToIndex.FindPointer(opcode.OriginalOffset + *jumpOffset);
+      if (targetIndex == nullptr)
+        return false;
+
+      opcode.JumpTarget = *targetIndex;
+      if (opcode.JumpTarget < this->Opcodes.Size())
+        this->Opcodes[opcode.JumpTarget].IsJumpTarget = true;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::Encode(Function* function)
+  {
+    size_t opcodeCount = this->Opcodes.Size();
+
+    // Lay out all the opcodes that are left
+    size_t totalSize = 0;
+    for (size_t i = 0; i < opcodeCount; ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      if (opcode.Removed)
+        continue;
+
+      opcode.NewOffset = totalSize;
+      totalSize += opcode.Data.Size();
+    }
+
+    // Anyone that jumped to a removed opcode now lands on the next opcode that's left
+    // The extra entry is the end of the function
+    Array<size_t> newOffsets;
+    newOffsets.Resize(opcodeCount + 1);
+    newOffsets[opcodeCount] = totalSize;
+    for (size_t i = opcodeCount; i > 0; --i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i - 1];
+      newOffsets[i - 1] = opcode.Removed ? newOffsets[i] : opcode.NewOffset;
+    }
+
+    function->CompactedOpcode.Resize(totalSize);
+    function->OpcodeCompactedIndices.Clear();
+    function->OpcodeLocationToCodeLocation.Clear();
+
+#ifdef ZeroDebug
+    function->OpcodeDebug.Clear();
+#endif
+
+    for (size_t i = 0; i < opcodeCount; ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      if (opcode.Removed)
+        continue;
+
+      // Jumps are always relative to the start of the jump opcode
+      ByteCodeOffset* jumpOffset = this->GetJumpOffset(opcode);
+      if (jumpOffset != nullptr)
+        *jumpOffset = (ByteCodeOffset)(newOffsets[opcode.JumpTarget] - opcode.NewOffset);
+
+      byte* destination = function->CompactedOpcode.Data() + opcode.NewOffset;
+      memcpy(destination, opcode.Data.Data(), opcode.Data.Size());
+
+      // The debugger looks up locations by the exact offset of each opcode
+      function->OpcodeCompactedIndices.PushBack(opcode.NewOffset);
+      if (opcode.Location.IsValid())
+        function->OpcodeLocationToCodeLocation.Insert(opcode.NewOffset, opcode.Location);
+
+#ifdef ZeroDebug
+      function->OpcodeDebug.PushBack((Opcode*)destination);
+#endif
+    }
+
+    this->Opcodes.Clear();
+    this->Reads.Clear();
+  }
+
+  //***************************************************************************
+  ByteCodeOffset* OpcodeOptimizer::GetJumpOffset(OptimizerOpcode& opcode)
+  {
+    switch (opcode.GetInstruction())
+    {
+      case Instruction::IfFalseRelativeGoTo:
+      case Instruction::IfTrueRelativeGoTo:
+        return &opcode.As<IfOpcode>().JumpOffset;
+
+      case Instruction::RelativeGoTo:
+        return &opcode.As<RelativeJumpOpcode>().JumpOffset;
+
+      case Instruction::PrepForFunctionCall:
+        return &opcode.As<PrepForFunctionCallOpcode>().JumpOffsetIfStatic;
+
+      #define ZilchEnumValue(Name) case Instruction::Name:
+      ZilchCompareJumpInstructions(Integer)
+      ZilchCompareJumpInstructions(Real)
+      #undef ZilchEnumValue
+        return &opcode.As<CompareJumpOpcode>().JumpOffset;
+
+      default:
+        return nullptr;
+    }
+  }
+
+  //***************************************************************************
+  bool OpcodeOptimizer::CollectReads(Function* function)
+  {
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      InstructionInfo& info = this->Infos[opcode.GetInstruction()];
+
+      switch (info.Layout)
+      {
+        case OperandLayout::Unknown:
+          return false;
+
+        case OperandLayout::None:
+          break;
+
+        case OperandLayout::Copy:
+        {
+          CopyOpcode& op = opcode.As<CopyOpcode>();
+
+          // Returns are read out of the called function's stack frame, not ours
+          if (op.Mode != CopyMode::FromReturn)
+            this->AddRead(op.Source, op.Size);
+
+          // Writing to a field still reads the handle on our stack
+          // Parameters are written to the called function's stack frame
+          if (op.Destination.Type != OperandType::Local)
+            this->AddRead(op.Destination, op.Size);
+          break;
+        }
+
+        case OperandLayout::BinaryRValue:
+        {
+          BinaryRValueOpcode& op = opcode.As<BinaryRValueOpcode>();
+          this->AddRead(op.Left, info.LeftSize);
+          this->AddRead(op.Right, info.RightSize);
+          break;
+        }
+
+        case OperandLayout::BinaryLValue:
+        {
+          BinaryLValueOpcode& op = opcode.As<BinaryLValueOpcode>();
+          this->AddRead(op.Output, info.LeftSize);
+          this->AddRead(op.Right, info.RightSize);
+          break;
+        }
+
+        case OperandLayout::UnaryRValue:
+          this->AddRead(opcode.As<UnaryRValueOpcode>().SingleOperand, info.LeftSize);
+          break;
+
+        case OperandLayout::UnaryLValue:
+          this->AddRead(opcode.As<UnaryLValueOpcode>().SingleOperand, info.LeftSize);
+          break;
+
+        case OperandLayout::Conversion:
+          this->AddRead(opcode.As<ConversionOpcode>().ToConvert, info.LeftSize);
+          break;
+
+        case OperandLayout::If:
+          this->AddRead(opcode.As<IfOpcode>().Condition, info.LeftSize);
+          break;
+
+        case OperandLayout::PrepForFunctionCall:
+          this->AddRead(opcode.As<PrepForFunctionCallOpcode>().Delegate, info.LeftSize);
+          break;
+
+        case OperandLayout::CreateInstanceDelegate:
+          this->AddRead(opcode.As<CreateInstanceDelegateOpcode>().ThisHandle, info.LeftSize);
+          break;
+
+        case OperandLayout::AddToStringBuilder:
+        {
+          AddToStringBuilderOpcode& op = opcode.As<AddToStringBuilderOpcode>();
+          this->AddRead(op.Value, op.TypeToConvert->GetCopyableSize());
+          break;
+        }
+
+        case OperandLayout::ThrowException:
+          this->AddRead(opcode.As<ThrowExceptionOpcode>().Exception, info.LeftSize);
+          break;
+
+        case OperandLayout::DeleteObject:
+          this->AddRead(opcode.As<DeleteObjectOpcode>().Object, info.LeftSize);
+          break;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::AddRead(const Operand& operand, size_t size)
+  {
+    LocalRange range;
+
+    switch (operand.Type)
+    {
+      case OperandType::Local:
+        range.Local = operand.HandleConstantLocal;
+        range.Size = size;
+        break;
+
+      // Fields read the handle (or the delegate's handle) that lives on our stack
+      case OperandType::Field:
+        range.Local = operand.HandleConstantLocal;
+        range.Size = sizeof(Delegate);
+        break;
+
+      // Constants and statics never touch our stack
+      default:
+        return;
+    }
+
+    this->Reads.PushBack(range);
+  }
+
+  //***************************************************************************
+  size_t OpcodeOptimizer::CountReads(OperandIndex local, size_t size)
+  {
+    size_t count = 0;
+    for (size_t i = 0; i < this->Reads.Size(); ++i)
+    {
+      LocalRange& range = this->Reads[i];
+      if (range.Local < (OperandIndex)(local + size) && (OperandIndex)(range.Local + range.Size) > local)
+        ++count;
+    }
+    return count;
+  }
+
+  //***************************************************************************
+  bool OpcodeOptimizer::IsTemporary(Function* function, OperandIndex local, size_t size)
+  {
+    // The return, parameters and this handle all live at the start of the stack frame
+    size_t firstRegister = function->FunctionType->ThisHandleStackOffset + sizeof(Handle);
+    if (local < (OperandIndex)firstRegister)
+      return false;
+
+    // Variables may share a register with the expression that initialized them (and the debugger can see them)
+    for (size_t i = 0; i < function->Variables.Size(); ++i)
+    {
+      Variable* variable = function->Variables[i];
+      OperandIndex variableEnd = (OperandIndex)(variable->Local + variable->ResultType->GetCopyableSize());
+      if (variable->Local < (OperandIndex)(local + size) && variableEnd > local)
+        return false;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  OptimizerOpcode* OpcodeOptimizer::GetNextOpcode(size_t index)
+  {
+    for (size_t i = index + 1; i < this->Opcodes.Size(); ++i)
+    {
+      if (this->Opcodes[i].Removed == false)
+        return &this->Opcodes[i];
+    }
+    return nullptr;
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::RemoveOpcode(size_t index)
+  {
+    OptimizerOpcode& opcode = this->Opcodes[index];
+    opcode.Removed = true;
+
+    // Whatever jumped here will now land on the next opcode
+    if (opcode.IsJumpTarget)
+    {
+      OptimizerOpcode* next = this->GetNextOpcode(index);
+      if (next != nullptr)
+        next->IsJumpTarget = true;
+    }
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void OpcodeOptimizer::ReplaceWithConstant(Function* function, OptimizerOpcode& opcode, const T& value, Instruction::Enum copyInstruction)
+  {
+    OperandLocal output = opcode.As<BinaryRValueOpcode>().Output;
+
+    // Store the result in the function's constants
+    OperandIndex constantIndex;
+    function->AllocateConstant<T>(sizeof(T), constantIndex) = value;
+
+    // Copy the constant into the same place the operation would have written to
+    CopyOpcode& copy = opcode.Replace<CopyOpcode>(copyInstruction);
+    copy.Source = Operand(constantIndex, 0, OperandType::Constant);
+    copy.Destination = Operand(output);
+    copy.Size = sizeof(T);
+    copy.Mode = CopyMode::Initialize;
+  }
+
+  // Folds an operation that can never throw an exception into a constant
+  // Note: The result must be computed before the constant is allocated (allocating may move the constants)
+  #define ZilchFoldCase(Name, Type, ResultType, expression)                                               \
+    case Instruction::Name##Type:                                                                         \
+    {                                                                                                     \
+      const Type& left = *(const Type*)function->Constants.GetElement(op.Left.HandleConstantLocal);       \
+      const Type& right = *(const Type*)function->Constants.GetElement(op.Right.HandleConstantLocal);     \
+      ResultType result = expression;                                                                     \
+      this->ReplaceWithConstant<ResultType>(function, opcode, result, Instruction::Copy##ResultType);     \
+      break;                                                                                              \
+    }
+
+  #define ZilchFoldComparisonCases(Type)                                                                  \
+    ZilchFoldCase(TestInequality,           Type, Boolean, left != right)                                 \
+    ZilchFoldCase(TestEquality,             Type, Boolean, left == right)                                 \
+    ZilchFoldCase(TestLessThan,             Type, Boolean, left < right)                                  \
+    ZilchFoldCase(TestLessThanOrEqualTo,    Type, Boolean, left <= right)                                 \
+    ZilchFoldCase(TestGreaterThan,          Type, Boolean, left > right)                                  \
+    ZilchFoldCase(TestGreaterThanOrEqualTo, Type, Boolean, left >= right)
+
+  #define ZilchFoldArithmeticCases(Type)                                                                  \
+    ZilchFoldCase(Add,                      Type, Type, left + right)                                     \
+    ZilchFoldCase(Subtract,                 Type, Type, left - right)                                     \
+    ZilchFoldCase(Multiply,                 Type, Type, left * right)
+
+  // Signed overflow is undefined in C++, so integers are folded in unsigned arithmetic which
+  // wraps around the same way the virtual machine's results do on every platform we run on
+  #define ZilchFoldIntegerArithmeticCases(Type, UnsignedType)                                            \
+    ZilchFoldCase(Add,      Type, Type, (Type)((UnsignedType)left + (UnsignedType)right))                 \
+    ZilchFoldCase(Subtract, Type, Type, (Type)((UnsignedType)left - (UnsignedType)right))                 \
+    ZilchFoldCase(Multiply, Type, Type, (Type)((UnsignedType)left * (UnsignedType)right))
+
+  //***************************************************************************
+  void OpcodeOptimizer::FoldConstants(Function* function)
+  {
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+
+      // We only fold operations where both sides are constants
+      InstructionInfo& info = this->Infos[opcode.GetInstruction()];
+      if (info.Layout != OperandLayout::BinaryRValue || info.OutputCopy == Instruction::InvalidInstruction)
+        continue;
+
+      BinaryRValueOpcode& op = opcode.As<BinaryRValueOpcode>();
+      if (op.Left.Type != OperandType::Constant || op.Right.Type != OperandType::Constant)
+        continue;
+
+      // Divide, modulo and pow are left alone since they can throw or depend on the runtime
+      switch (opcode.GetInstruction())
+      {
+        ZilchFoldComparisonCases(Integer)
+        ZilchFoldIntegerArithmeticCases(Integer, unsigned int)
+        ZilchFoldComparisonCases(Real)
+        ZilchFoldArithmeticCases(Real)
+        ZilchFoldCase(TestInequality, Boolean, Boolean, left != right)
+        ZilchFoldCase(TestEquality, Boolean, Boolean, left == right)
+
+        default:
+          break;
+      }
+    }
+  }
+
+  #undef ZilchFoldCase
+  #undef ZilchFoldComparisonCases
+  #undef ZilchFoldArithmeticCases
+  #undef ZilchFoldIntegerArithmeticCases
+
+  //***************************************************************************
+  // Checks if an operand reads exactly a given local
+  static bool IsLocal(const Operand& operand, OperandIndex local)
+  {
+    return operand.Type == OperandType::Local && operand.HandleConstantLocal == local;
+  }
+
+  //***************************************************************************
+  // Checks if reading an operand (of a given size) touches anything in a range of our stack
+  static bool TouchesLocal(const Operand& operand, size_t operandSize, OperandIndex local, size_t size)
+  {
+    // Fields only touch the handle (or the delegate's handle) on our stack
+    if (operand.Type == OperandType::Field)
+      operandSize = sizeof(Delegate);
+    else if (operand.Type != OperandType::Local)
+      return false;
+
+    // The local could be a member of a value on the stack, so check for any overlap
+    return operand.HandleConstantLocal < (OperandIndex)(local + size) && (OperandIndex)(operand.HandleConstantLocal + operandSize) > local;
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::PropagateCopies(Function* function)
+  {
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& copyOpcode = this->Opcodes[i];
+      if (copyOpcode.Removed)
+        continue;
+
+      // We only look at copies of simple values into a local
+      Instruction::Enum copyInstruction = copyOpcode.GetInstruction();
+      InstructionInfo& copyInfo = this->Infos[copyInstruction];
+      if (copyInfo.Layout != OperandLayout::Copy || copyInfo.OperandCopy != copyInstruction)
+        continue;
+
+      CopyOpcode& copy = copyOpcode.As<CopyOpcode>();
+      if (copy.Mode != CopyMode::Initialize && copy.Mode != CopyMode::Assignment)
+        continue;
+      if (copy.Destination.Type != OperandType::Local)
+        continue;
+
+      OperandIndex temporary = copy.Destination.HandleConstantLocal;
+      if (TouchesLocal(copy.Source, copy.Size, temporary, copy.Size))
+        continue;
+
+      // The opcode that reads the temporary must be right after us (and nothing can jump into the middle)
+      OptimizerOpcode* user = this->GetNextOpcode(i);
+      if (user == nullptr || user->IsJumpTarget)
+        continue;
+
+      InstructionInfo& userInfo = this->Infos[user->GetInstruction()];
+      if (userInfo.OperandCopy != copyInstruction)
+        continue;
+
+      // Find the operand that reads the temporary
+      Operand* read = nullptr;
+      switch (userInfo.Layout)
+      {
+        case OperandLayout::BinaryRValue:
+        {
+          BinaryRValueOpcode& op = user->As<BinaryRValueOpcode>();
+          if (IsLocal(op.Left, temporary))
+            read = &op.Left;
+          else if (IsLocal(op.Right, temporary))
+            read = &op.Right;
+          break;
+        }
+
+        case OperandLayout::UnaryRValue:
+        {
+          UnaryRValueOpcode& op = user->As<UnaryRValueOpcode>();
+          if (IsLocal(op.SingleOperand, temporary))
+            read = &op.SingleOperand;
+          break;
+        }
+
+        case OperandLayout::Conversion:
+        {
+          ConversionOpcode& op = user->As<ConversionOpcode>();
+          if (IsLocal(op.ToConvert, temporary))
+            read = &op.ToConvert;
+          break;
+        }
+
+        case OperandLayout::If:
+        {
+          IfOpcode& op = user->As<IfOpcode>();
+          if (IsLocal(op.Condition, temporary))
+            read = &op.Condition;
+          break;
+        }
+
+        default:
+          break;
+      }
+
+      // The temporary can only go away if this was the only place it's ever read from
+      if (read == nullptr || this->IsTemporary(function, temporary, copy.Size) == false)
+        continue;
+      if (this->CountReads(temporary, copy.Size) != 1)
+        continue;
+
+      // Read straight from where the copy read from (this is how field loads fold into arithmetic)
+      *read = copy.Source;
+      this->RemoveOpcode(i);
+    }
+  }
+
+  //***************************************************************************
+  void OpcodeOptimizer::RemoveDeadTemporaries(Function* function)
+  {
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      if (opcode.Removed)
+        continue;
+
+      InstructionInfo& info = this->Infos[opcode.GetInstruction()];
+      if (info.OutputCopy == Instruction::InvalidInstruction)
+        continue;
+
+      // Find where the operation writes to
+      OperandLocal* output = nullptr;
+      switch (info.Layout)
+      {
+        case OperandLayout::BinaryRValue:
+          output = &opcode.As<BinaryRValueOpcode>().Output;
+          break;
+
+        case OperandLayout::UnaryRValue:
+          output = &opcode.As<UnaryRValueOpcode>().Output;
+          break;
+
+        case OperandLayout::Conversion:
+          output = &opcode.As<ConversionOpcode>().Output;
+          break;
+
+        default:
+          continue;
+      }
+
+      // The next opcode must be a copy of our output into another local
+      OptimizerOpcode* copyOpcode = this->GetNextOpcode(i);
+      if (copyOpcode == nullptr || copyOpcode->IsJumpTarget || copyOpcode->GetInstruction() != info.OutputCopy)
+        continue;
+
+      CopyOpcode& copy = copyOpcode->As<CopyOpcode>();
+      if (copy.Mode != CopyMode::Initialize && copy.Mode != CopyMode::Assignment)
+        continue;
+      if (IsLocal(copy.Source, *output) == false || copy.Destination.Type != OperandType::Local)
+        continue;
+
+      // Note: Scalar operations read their operands entirely before writing the output,
+      // so it's fine if the destination is also one of the operands (eg 'a = a + b')
+      OperandIndex destination = copy.Destination.HandleConstantLocal;
+
+      // The temporary can only go away if the copy was the only place it's ever read from
+      if (this->IsTemporary(function, *output, copy.Size) == false)
+        continue;
+      if (this->CountReads(*output, copy.Size) != 1)
+        continue;
+
+      *output = destination;
+      this->RemoveOpcode((size_t)(copyOpcode - this->Opcodes.Data()));
+    }
+  }
+
+  // Maps each comparison to its superinstruction
+  #define ZilchFuseCase(Name, Type)                                                                       \
+    case Instruction::Name##Type:                                                                         \
+      fused = Instruction::Name##Type##IfFalseRelativeGoTo;                                               \
+      break;
+
+  #define ZilchFuseCases(Type)                                                                            \
+    ZilchFuseCase(TestInequality,           Type)                                                         \
+    ZilchFuseCase(TestEquality,             Type)                                                         \
+    ZilchFuseCase(TestLessThan,             Type)                                                         \
+    ZilchFuseCase(TestLessThanOrEqualTo,    Type)                                                         \
+    ZilchFuseCase(TestGreaterThan,          Type)                                                         \
+    ZilchFuseCase(TestGreaterThanOrEqualTo, Type)
+
+  //***************************************************************************
+  void OpcodeOptimizer::FuseCompareJumps()
+  {
+    for (size_t i = 0; i < this->Opcodes.Size(); ++i)
+    {
+      OptimizerOpcode& opcode = this->Opcodes[i];
+      if (opcode.Removed)
+        continue;
+
+      Instruction::Enum fused = Instruction::InvalidInstruction;
+      switch (opcode.GetInstruction())
+      {
+        ZilchFuseCases(Integer)
+        ZilchFuseCases(Real)
+
+        default:
+          continue;
+      }
+
+      // The if must immediately read our result, and nothing else can jump to it
+      OptimizerOpcode* ifOpcode = this->GetNextOpcode(i);
+      if (ifOpcode == nullptr || ifOpcode->IsJumpTarget || ifOpcode->GetInstruction() != Instruction::IfFalseRelativeGoTo)
+        continue;
+
+      BinaryRValueOpcode compare = opcode.As<BinaryRValueOpcode>();
+      if (IsLocal(ifOpcode->As<IfOpcode>().Condition, compare.Output) == false)
+        continue;
+
+      // We jump wherever the if would have jumped (the offset is fixed up when we encode)
+      opcode.JumpTarget = ifOpcode->JumpTarget;
+
+      // Note: We still write out the result since we don't know if anyone else reads it
+      CompareJumpOpcode& compareJump = opcode.Replace<CompareJumpOpcode>(fused);
+      compareJump.Left = compare.Left;
+      compareJump.Right = compare.Right;
+      compareJump.Output = compare.Output;
+      compareJump.JumpOffset = 0;
+
+      this->RemoveOpcode((size_t)(ifOpcode - this->Opcodes.Data()));
+    }
+  }
+
+  #undef ZilchFuseCase
+  #undef ZilchFuseCases
+}
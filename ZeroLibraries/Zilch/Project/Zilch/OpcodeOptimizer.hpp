@@ -0,0 +1,213 @@
+/**************************************************************\
+* Copyright 2017, DigiPen Institute of Technology
+\**************************************************************/
+
+#pragma once
+#ifndef ZILCH_OPCODE_OPTIMIZER_HPP
+#define ZILCH_OPCODE_OPTIMIZER_HPP
+
+namespace Zilch
+{
+  // How the operands of an instruction are laid out (which opcode class it uses)
+  namespace OperandLayout
+  {
+    enum Enum
+    {
+      // We don't know what the instruction reads, so we can't reason about locals
+      Unknown,
+      // The instruction doesn't read any locals
+      None,
+      Copy,
+      BinaryRValue,
+      BinaryLValue,
+      UnaryRValue,
+      UnaryLValue,
+      Conversion,
+      If,
+      PrepForFunctionCall,
+      CreateInstanceDelegate,
+      AddToStringBuilder,
+      ThrowException,
+      DeleteObject
+    };
+  }
+
+  // Everything the optimizer needs to know about a single instruction
+  class ZeroShared InstructionInfo
+  {
+  public:
+    // Constructor
+    InstructionInfo();
+
+    // The opcode class that the instruction uses
+    OperandLayout::Enum Layout;
+
+    // The size of the values read by the first and second operands
+    size_t LeftSize;
+    size_t RightSize;
+
+    // The copy instruction for the type of the read operands (or InvalidInstruction if there isn't one)
+    // Only set when both operands have the same type
+    Instruction::Enum OperandCopy;
+
+    // The copy instruction for the type of the output (or InvalidInstruction if there isn't one)
+    Instruction::Enum OutputCopy;
+  };
+
+  // A single decoded opcode that the optimizer is allowed to rewrite
+  class ZeroShared OptimizerOpcode
+  {
+  public:
+    // Constructor
+    OptimizerOpcode();
+
+    // Get the opcode as a particular opcode class
+    template <typename T>
+    T& As()
+    {
+      return *(T*)this->Data.Data();
+    }
+
+    // Get the instruction that the opcode runs
+    Instruction::Enum GetInstruction();
+
+    // Replaces the opcode with a new opcode of type T (the debug origin is kept)
+    template <typename T>
+    T& Replace(Instruction::Enum instruction)
+    {
+#ifdef ZeroDebug
+      DebugOrigin::Enum debugOrigin = this->As<Opcode>().DebugOrigin;
+#endif
+
+      this->Data.Resize(sizeof(T));
+      T& opcode = *new (this->Data.Data()) T();
+      opcode.Instruction = instruction;
+
+#ifdef ZeroDebug
+      opcode.DebugOrigin = debugOrigin;
+#endif
+      return opcode;
+    }
+
+    // A copy of the opcode's memory
+    Array<byte> Data;
+
+    // Where the opcode was in the original compacted opcode
+    size_t OriginalOffset;
+
+    // Where the opcode will be after it is written back out
+    size_t NewOffset;
+
+    // The index of the opcode this opcode jumps to (or NoJump)
+    size_t JumpTarget;
+
+    // Whether any opcode jumps to this one (it cannot be folded into the opcode before it)
+    bool IsJumpTarget;
+
+    // Removed opcodes are not written back out
+    bool Removed;
+
+    // The code location we map this opcode to for the debugger
+    CodeLocation Location;
+  };
+
+  // Rewrites the opcode of functions after code generation. The code generator emits
+  // one opcode per syntax node, which leaves behind many temporaries and copies. This
+  // performs constant folding, copy propagation and dead temporary elimination, and fuses
+  // comparisons with the if that reads them into a single superinstruction
+  // Any function that uses an instruction we don't fully understand skips the passes
+  // that need to know every read of a local
+  class ZeroShared OpcodeOptimizer
+  {
+  public:
+    // Constructor
+    OpcodeOptimizer();
+
+    // Optimizes all the functions that were compiled into the library
+    void Optimize(Library* library);
+
+    // Optimizes a single function (its opcode must already be compacted)
+    void Optimize(Function* function);
+
+    // The index used when an opcode does not jump
+    static const size_t NoJump = (size_t)-1;
+
+  private:
+
+    // Sets the info for an instruction
+    void SetInfo
+    (
+      Instruction::Enum instruction,
+      OperandLayout::Enum layout,
+      size_t leftSize,
+      size_t rightSize,
+      Instruction::Enum operandCopy = Instruction::InvalidInstruction,
+      Instruction::Enum outputCopy = Instruction::InvalidInstruction
+    );
+
+    // Reads the function's opcode into our own list (returns false if we couldn't understand the jumps)
+    bool Decode(Function* function);
+
+    // Writes our list of opcodes back into the function and fixes up jumps and debug locations
+    void Encode(Function* function);
+
+    // Returns a pointer to the jump offset of an opcode, or null if it doesn't jump
+    ByteCodeOffset* GetJumpOffset(OptimizerOpcode& opcode);
+
+    // Walks every opcode and records all the locals that are read
+    // Returns false if there was any instruction we don't understand
+    bool CollectReads(Function* function);
+
+    // Records a read of an operand with a given size
+    void AddRead(const Operand& operand, size_t size);
+
+    // Counts how many reads touch a range of locals
+    size_t CountReads(OperandIndex local, size_t size);
+
+    // Checks if a range of locals is only used as a temporary (not a variable, parameter or return)
+    bool IsTemporary(Function* function, OperandIndex local, size_t size);
+
+    // Get the next opcode that has not been removed (or null if there is none)
+    OptimizerOpcode* GetNextOpcode(size_t index);
+
+    // Removes an opcode, and anyone that jumped to it will now jump to the next opcode
+    void RemoveOpcode(size_t index);
+
+    // Replaces binary operations on two constants with a copy of the result
+    void FoldConstants(Function* function);
+
+    // Removes copies into temporaries that are immediately read by the next opcode
+    void PropagateCopies(Function* function);
+
+    // Writes results directly to their destination rather than to a temporary that is then copied
+    void RemoveDeadTemporaries(Function* function);
+
+    // Fuses comparisons with the IfFalseRelativeGoTo that reads them
+    void FuseCompareJumps();
+
+    // Replaces an opcode with a copy from a new constant into the opcode's output
+    template <typename T>
+    void ReplaceWithConstant(Function* function, OptimizerOpcode& opcode, const T& value, Instruction::Enum copyInstruction);
+
+  private:
+
+    // Information about every instruction (indexed by instruction)
+    Array<InstructionInfo> Infos;
+
+    // The opcodes of the function we're optimizing
+    Array<OptimizerOpcode> Opcodes;
+
+    // A range of locals that was read by an opcode
+    class LocalRange
+    {
+    public:
+      OperandIndex Local;
+      size_t Size;
+    };
+
+    // Every read of a local in the function we're optimizing
+    Array<LocalRange> Reads;
+  };
+}
+
+#endif
@@ -224,7 +224,9 @@ namespace Zilch
   Project::Project() :
     CursorPosition(NoCursor),
     UserData(nullptr),
-    VariableUniqueIdCounter(0)
+    VariableUniqueIdCounter(0),
+    OptimizeOpcode(false),
+    TokenizeCount(0)
   {
     ZilchErrorIfNotStarted(Project);
   }
@@ -306,16 +308,41 @@ namespace Zilch
     // The tokenizer that parses the input stream into a list of tokens
     Tokenizer tokenizer(*this);
 
+    ++this->TokenizeCount;
+
     // Loop through all the project entries
     for (size_t i = 0; i < this->Entries.Size(); ++i)
     {
       // Grab the current project entry
       CodeEntry& entry = this->Entries[i];
 
+      // If this code was tokenized before and hasn't changed, just append the same tokens
+      TokenizedEntry* tokenized = this->TokenizedEntries.FindPointer(entry.Origin);
+      if (tokenized != nullptr && tokenizer.Append(entry, *tokenized, tokensOut, commentsOut))
+      {
+        tokenized->LastUsed = this->TokenizeCount;
+        continue;
+      }
+
       // Keep parsing all code into the same token stream
-      tokenizer.Parse(entry, tokensOut, commentsOut);
+      TokenizedEntry& newTokenized = this->TokenizedEntries[entry.Origin];
+      if (tokenizer.Parse(entry, tokensOut, commentsOut, newTokenized))
+        newTokenized.LastUsed = this->TokenizeCount;
+      else
+        this->TokenizedEntries.Erase(entry.Origin);
     }
 
+    // Forget the tokens of any code that is no longer part of the project
+    Array<String> unusedOrigins;
+    typedef HashMap<String, TokenizedEntry>::value_type TokenizedPair;
+    ZilchForEach(TokenizedPair& pair, this->TokenizedEntries)
+    {
+      if (pair.second.LastUsed != this->TokenizeCount)
+        unusedOrigins.PushBack(pair.first);
+    }
+    for (size_t i = 0; i < unusedOrigins.Size(); ++i)
+      this->TokenizedEntries.Erase(unusedOrigins[i]);
+
     // Finalize the token stream
     tokenizer.Finalize(tokensOut);
 
@@ -541,6 +568,13 @@ namespace Zilch
 
       // Check that the library was valid
       ErrorIf(library == nullptr, "Somehow the library returned from code generation was not valid!");
+
+      // Optionally rewrite the generated opcode (debug locations are remapped to the new opcode)
+      if (this->OptimizeOpcode)
+      {
+        OpcodeOptimizer optimizer;
+        optimizer.Optimize(library);
+      }
       return library;
     }
     else
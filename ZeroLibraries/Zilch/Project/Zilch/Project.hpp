@@ -229,6 +229,7 @@ namespace Zilch
     bool AddCodeFromFile(StringParam fileName, void* codeUserData = nullptr);
 
     // Clears out the project (removes all code strings/files, plugin directories, plugin files, etc)
+    // The tokens of previously tokenized code are kept so that code added again unchanged is not tokenized again
     void Clear();
 
     // Reads a text file into a string, returns true on success, false on failure
@@ -284,6 +285,10 @@ namespace Zilch
     // any other local variables within the function, then we use this counter as a unique id
     size_t VariableUniqueIdCounter;
 
+    // If set, generated opcode is run through the OpcodeOptimizer (constant folding, copy propagation, superinstructions)
+    // This is off by default since optimized code no longer maps one-to-one with the syntax tree
+    bool OptimizeOpcode;
+
     // Setup the location and the name for a found definition
     void InitializeDefinitionInfo(CodeDefinition& resultOut, ReflectionObject* object);
 
@@ -306,6 +311,14 @@ namespace Zilch
     // All the code that makes up this project
     Array<CodeEntry> Entries;
 
+    // The tokens of each entry from the last time the project was tokenized (by origin)
+    // Editing a script usually only changes one entry, so all the other entries just copy their tokens
+    // Only tokenizing is reused, parsing, type checking, and code generation always run on the whole project
+    // (the syntaxer resolves types into the one tree in place and a single library is generated from it)
+    // This costs a copy of every token and comment, and entries that had errors are never kept
+    HashMap<String, TokenizedEntry> TokenizedEntries;
+    size_t TokenizeCount;
+
     // A special constant that means we don't have a cursor
     static const size_t NoCursor = (size_t)-1;
 
@@ -35,6 +35,34 @@ namespace Zilch
     size_t Length;
   };
 
+  // The tokens parsed from a single code entry
+  // These are kept so that code that did not change does not need to be tokenized again
+  class ZeroShared TokenizedEntry
+  {
+  public:
+    // Constructor
+    TokenizedEntry();
+
+    // The entry that was tokenized
+    String Code;
+    String Origin;
+    const void* CodeUserData;
+
+    // A carriage return at the end of the previous entry changes how a newline at the start of this entry is counted
+    bool StartedAfterCarriageReturn;
+    bool EndedWithCarriageReturn;
+
+    // Where the tokenizer was once it reached the end of the entry
+    CodeLocation EndLocation;
+
+    // All the tokens and comments that were parsed from the entry
+    Array<UserToken> Tokens;
+    Array<UserToken> Comments;
+
+    // Used by the owner to know when an entry was last used
+    size_t LastUsed;
+  };
+
   // A classifcation of tokens (not the specific token, but rather a category)
   namespace TokenCategory
   {
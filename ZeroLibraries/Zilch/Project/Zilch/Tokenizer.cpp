@@ -53,6 +53,15 @@ namespace Zilch
     return this->Token.c_str();
   }
 
+  //***************************************************************************
+  TokenizedEntry::TokenizedEntry() :
+    CodeUserData(nullptr),
+    StartedAfterCarriageReturn(false),
+    EndedWithCarriageReturn(false),
+    LastUsed(0)
+  {
+  }
+
   //***************************************************************************
   Tokenizer::Tokenizer(CompilationErrors& errors) :
     WasCarriageReturn(false),
@@ -146,6 +155,48 @@ namespace Zilch
     return ParseInternal(tokensOut, commentsOut);
   }
 
+  //***************************************************************************
+  bool Tokenizer::Parse(const CodeEntry& entry, Array<UserToken>& tokensOut, Array<UserToken>& commentsOut, TokenizedEntry& tokenizedOut)
+  {
+    // Remember where this entry's tokens start so we can copy them out afterwards
+    size_t tokensStart = tokensOut.Size();
+    size_t commentsStart = commentsOut.Size();
+    bool startedAfterCarriageReturn = this->WasCarriageReturn;
+
+    // An entry that had errors is never kept since the errors must be reported every time
+    if (this->Parse(entry, tokensOut, commentsOut) == false || this->Errors.WasError)
+      return false;
+
+    tokenizedOut.Code = entry.Code;
+    tokenizedOut.Origin = entry.Origin;
+    tokenizedOut.CodeUserData = entry.CodeUserData;
+    tokenizedOut.StartedAfterCarriageReturn = startedAfterCarriageReturn;
+    tokenizedOut.EndedWithCarriageReturn = this->WasCarriageReturn;
+    tokenizedOut.EndLocation = this->Location;
+    tokenizedOut.Tokens.Assign(tokensOut.SubRange(tokensStart, tokensOut.Size() - tokensStart));
+    tokenizedOut.Comments.Assign(commentsOut.SubRange(commentsStart, commentsOut.Size() - commentsStart));
+    return true;
+  }
+
+  //***************************************************************************
+  bool Tokenizer::Append(const CodeEntry& entry, const TokenizedEntry& tokenized, Array<UserToken>& tokensOut, Array<UserToken>& commentsOut)
+  {
+    // Every token stores the code, origin, and user-data in its location, so all of them must match
+    if (tokenized.StartedAfterCarriageReturn != this->WasCarriageReturn ||
+        tokenized.CodeUserData != entry.CodeUserData ||
+        tokenized.Origin != entry.Origin ||
+        tokenized.Code != entry.Code)
+      return false;
+
+    tokensOut.Append(tokenized.Tokens.All());
+    commentsOut.Append(tokenized.Comments.All());
+
+    // Leave the tokenizer in the same state parsing the entry would have
+    this->Location = tokenized.EndLocation;
+    this->WasCarriageReturn = tokenized.EndedWithCarriageReturn;
+    return true;
+  }
+
   //***************************************************************************
   bool Tokenizer::ParseInternal(Array<UserToken>& tokensOut, Array<UserToken>& commentsOut)
   {
@@ -20,6 +20,14 @@ namespace Zilch
     // Parse data from a null terminated memory pointer
     bool Parse(const CodeEntry& entry, Array<UserToken>& tokensOut, Array<UserToken>& commentsOut);
 
+    // Parse data and also store the parsed tokens so the same entry can be appended later without parsing it again
+    // Returns true if it succeeded (the tokenized entry is only valid on success)
+    bool Parse(const CodeEntry& entry, Array<UserToken>& tokensOut, Array<UserToken>& commentsOut, TokenizedEntry& tokenizedOut);
+
+    // Appends the tokens of a previously tokenized entry as if the entry was parsed again
+    // Returns false (and appends nothing) if the tokenized entry was not parsed from the same code in the same state
+    bool Append(const CodeEntry& entry, const TokenizedEntry& tokenized, Array<UserToken>& tokensOut, Array<UserToken>& commentsOut);
+
     // Finalizes a token stream
     void Finalize(Array<UserToken>& tokensOut);
 
@@ -1048,6 +1048,39 @@ namespace Zilch
     return;
   }
 
+  //*****************************************************************************
+  #define ZilchCaseCompareJump(WithType, operation, expression)                                           \
+    ZilchVirtualInstruction(operation##WithType##IfFalseRelativeGoTo)                                     \
+    {                                                                                                     \
+      /* Validate the timeout just like the if instruction that was fused into us */                      \
+      if (state->ThrowExceptionOnTimeout(report))                                                         \
+        longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);                                            \
+                                                                                                          \
+      const CompareJumpOpcode& op = (const CompareJumpOpcode&) opcode;                                    \
+      const WithType& left = GetOperand<WithType>(ourFrame, ourFrame, op.Left);                           \
+      const WithType& right = GetOperand<WithType>(ourFrame, ourFrame, op.Right);                         \
+      Boolean& output = GetLocal<Boolean>(ourFrame->Frame, op.Output);                                    \
+      expression;                                                                                         \
+                                                                                                          \
+      /* Jump only when the comparison failed (the same as IfFalseRelativeGoTo) */                        \
+      if (output)                                                                                         \
+        programCounter += sizeof(CompareJumpOpcode);                                                      \
+      else                                                                                                \
+        programCounter += op.JumpOffset;                                                                  \
+    }
+
+  // Note: This macro mirrors the one inside of InstructionEnum
+  #define ZilchCompareJumpCases(WithType)                                                                 \
+    ZilchCaseCompareJump(WithType, TestInequality,            output = left != right);                    \
+    ZilchCaseCompareJump(WithType, TestEquality,              output = left == right);                    \
+    ZilchCaseCompareJump(WithType, TestLessThan,              output = left < right);                     \
+    ZilchCaseCompareJump(WithType, TestLessThanOrEqualTo,     output = left <= right);                    \
+    ZilchCaseCompareJump(WithType, TestGreaterThan,           output = left > right);                     \
+    ZilchCaseCompareJump(WithType, TestGreaterThanOrEqualTo,  output = left >= right);
+
+  ZilchCompareJumpCases(Integer)
+  ZilchCompareJumpCases(Real)
+
   //***************************************************************************
   ZilchVirtualInstruction(Return)
   {
@@ -1668,6 +1701,79 @@ namespace Zilch
     #undef ZilchEnumValue
   }
 
+  //***************************************************************************
+  // Whether debug events being enabled needs to be checked for after the instruction runs
+  // We only check after calls (the only way other code can attach a debugger) and jumps (so loops can be broken into)
+  // The fused compare and jump superinstructions are all at the end of the instruction list
+  #define ZilchIsDebugCheckpoint(Name)                                              \
+    (Instruction::Name == Instruction::FunctionCall        ||                       \
+     Instruction::Name == Instruction::RelativeGoTo        ||                       \
+     Instruction::Name == Instruction::IfFalseRelativeGoTo ||                       \
+     Instruction::Name == Instruction::IfTrueRelativeGoTo  ||                       \
+     (Instruction::Name >= Instruction::TestInequalityIntegerIfFalseRelativeGoTo && \
+      Instruction::Name <= Instruction::TestGreaterThanOrEqualToRealIfFalseRelativeGoTo))
+
+  // Runs a single instruction and then handles leaving the fast loop
+  // Note: The instruction is a constant so all the checks after it are folded away for most instructions
+  #define ZilchExecuteFastInstruction(Name)                                                 \
+    Instruction##Name(state, call, report, programCounter, ourFrame, *opcode);              \
+    if (Instruction::Name == Instruction::Return)                                           \
+      return true;                                                                          \
+    if (ZilchIsDebugCheckpoint(Name) && state->EnableDebugEvents)                           \
+      return false;
+
+  //***************************************************************************
+  bool VirtualMachine::ExecuteNextFast(ExecutableState* state, Call& call, ExceptionReport& report, size_t& programCounter, PerFrameData* ourFrame, byte* compactedOpcode)
+  {
+    const Opcode* opcode = nullptr;
+
+  #ifdef ZilchSupportsComputedGoto
+    // Every instruction jumps straight to the next instruction's label (no loop, no function pointer)
+    static void* InstructionLabels[Instruction::Count] =
+    {
+      #define ZilchEnumValue(Name) &&Label##Name,
+      #include "InstructionsEnum.inl"
+      #undef ZilchEnumValue
+    };
+
+    #define ZilchDispatchNext()                                         \
+      opcode = (const Opcode*)(compactedOpcode + programCounter);       \
+      goto *InstructionLabels[opcode->Instruction];
+
+    ZilchDispatchNext();
+
+    #define ZilchEnumValue(Name)              \
+      Label##Name:                            \
+      {                                       \
+        ZilchExecuteFastInstruction(Name);    \
+        ZilchDispatchNext();                  \
+      }
+    #include "InstructionsEnum.inl"
+    #undef ZilchEnumValue
+    #undef ZilchDispatchNext
+  #else
+    // A switch lets the compiler build a jump table and inline the instructions (unlike the function table)
+    ZilchLoop
+    {
+      opcode = (const Opcode*)(compactedOpcode + programCounter);
+      switch (opcode->Instruction)
+      {
+        #define ZilchEnumValue(Name)              \
+          case Instruction::Name:                 \
+          {                                       \
+            ZilchExecuteFastInstruction(Name);    \
+            break;                                \
+          }
+        #include "InstructionsEnum.inl"
+        #undef ZilchEnumValue
+      }
+    }
+  #endif
+  }
+
+  #undef ZilchExecuteFastInstruction
+  #undef ZilchIsDebugCheckpoint
+
   //***************************************************************************
   void VirtualMachine::ExecuteNext(Call& call, ExceptionReport& report)
   {
@@ -1699,6 +1805,14 @@ namespace Zilch
     ZilchLastRunningFunction = ourFrame->CurrentFunction;
     ZilchLastRunningOpcodeLength = ourFrame->CurrentFunction->CompactedOpcode.Size();
 
+    // If nobody can be listening to opcode events then skip sending them entirely
+    // If a debugger attaches part way through the function, we finish it below with the events enabled
+    if (state->EnableDebugEvents == false)
+    {
+      if (ExecuteNextFast(state, call, report, programCounter, ourFrame, compactedOpcode))
+        return;
+    }
+
     // Loop through all the opcodes in the function
     // We don't need to check for the end since the return opcode will exit this function
     ZilchLoop
@@ -19,6 +19,11 @@ namespace Zilch
     // Execute a function, starting from a given stack frame
     static void ExecuteNext(Call& call, ExceptionReport& report);
 
+    // Executes the opcode of a function without sending any opcode events (used when no debugger is attached)
+    // Returns true if the function returned, or false if debug events were enabled part way through,
+    // in which case the caller must finish executing the function (from the current program counter)
+    static bool ExecuteNextFast(ExecutableState* state, Call& call, ExceptionReport& report, size_t& programCounter, PerFrameData* ourFrame, byte* compactedOpcode);
+
     // Return the value of an enum property (the user data Contains the value)
     static void EnumerationProperty(Call& call, ExceptionReport& report);
 
@@ -271,11 +271,13 @@ namespace Zilch
 #include "Events.hpp"
 #include "ArrayClass.hpp"
 #include "CodeGenerator.hpp"
+#include "OpcodeOptimizer.hpp"
 #include "ErrorDatabase.hpp"
 #include "CompilationErrors.hpp"
 #include "ConsoleClass.hpp"
 #include "WebSocket.hpp"
 #include "Debugging.hpp"
+#include "HeapSlabAllocator.hpp"
 #include "HandleManager.hpp"
 #include "Timer.hpp"
 #include "ExecutableState.hpp"